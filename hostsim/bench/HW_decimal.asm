@@ -0,0 +1,131 @@
+;-------------------------------------------------------------------------------
+; File:         HW_decimal.asm
+; Description:  Binary to decimal text without division, on the MPY32 (F5529):
+;               every digit is value - 10 * q with q = value / 10 taken from a
+;               multiply by the reciprocal, 0xCCCCCCCD / 2^35 (exact for every
+;               32-bit value) while the value needs 32 bits, 0xCCCD / 2^19 (exact
+;               below 65536) after that. C prototypes:
+;
+;                   unsigned int HW_utoa32(unsigned long value, char* buf);
+;                   unsigned int HW_itoa32(long value, char* buf);
+;                   unsigned int HW_utoa16(unsigned int value, char* buf);
+;                   unsigned int HW_itoa16(int value, char* buf);
+;
+;               buf gets the digits (with '-' when negative) and a NUL, the
+;               return value is their count. 8-bit values go through the
+;               16-bit routines (the caller's conversion to int extends them).
+;               The MPY32 must be in its reset mode (no MPYFRAC/MPYSAT)
+; Author(s):    Polickoski, Nick
+; Date:         October 17, 2026
+;-------------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    HW_utoa32               ; unsigned long to decimal
+            .def    HW_itoa32               ; long to decimal
+            .def    HW_utoa16               ; unsigned int to decimal
+            .def    HW_itoa16               ; int to decimal
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutines
+;-------------------------------------------------------------------------------
+HW_itoa16:
+            mov.w   R13,    R14             ; buf
+            clr.w   R13                     ; value as a long
+            tst.w   R12
+            jge     HW_utoa32
+            inv.w   R12                     ; -value fits the unsigned routine
+            inc.w   R12
+            jmp     minus
+
+HW_itoa32:
+            tst.w   R13
+            jge     HW_utoa32
+            inv.w   R12                     ; -value: R13:R12 negated
+            inv.w   R13
+            inc.w   R12
+            adc.w   R13
+minus:
+            mov.b   #'-',   0(R14)
+            inc.w   R14
+            call    #HW_utoa32
+            inc.w   R12                     ; count the sign
+            ret
+
+HW_utoa16:
+            mov.w   R13,    R14             ; buf
+            clr.w   R13                     ; value as an unsigned long
+
+HW_utoa32:
+            push    R10                     ; 10 * q
+            clr.w   R15                     ; digits pushed, last one first
+
+wideLoop:
+            tst.w   R13
+            jz      narrowLoop              ; the rest fits in 16 bits
+            mov.w   R12,    &MPY32L         ; unsigned 32 x 32: value * 0xCCCCCCCD
+            mov.w   R13,    &MPY32H
+            mov.w   #0CCCDh, &OP2L
+            mov.w   #0CCCCh, &OP2H          ; starts the multiply
+            mov.w   R12,    R11             ; low word of value: the digit only needs that
+            inc.w   R15                     ; 2cc so far: RES2 is ready after 10, RES3 after 11
+            nop
+            nop
+            nop
+            nop
+            nop
+            mov.w   &RES2,  R12
+            mov.w   &RES3,  R13
+            clrc                            ; q = RES3:RES2 >> 3
+            rrc.w   R13
+            rrc.w   R12
+            rra.w   R13
+            rrc.w   R12
+            rra.w   R13
+            rrc.w   R12
+            mov.w   R12,    R10             ; digit = value - 10 * q, in the low word
+            rla.w   R10
+            rla.w   R10
+            add.w   R12,    R10
+            rla.w   R10
+            sub.w   R10,    R11
+            add.w   #'0',   R11
+            push.w  R11
+            jmp     wideLoop
+
+narrowLoop:
+            mov.w   R12,    &MPY            ; unsigned 16 x 16: value * 0xCCCD
+            mov.w   #0CCCDh, &OP2           ; starts the multiply, RESHI is ready after 3
+            mov.w   R12,    R11
+            inc.w   R15
+            nop
+            mov.w   &RESHI, R12
+            clrc                            ; q = RESHI >> 3
+            rrc.w   R12
+            rra.w   R12
+            rra.w   R12
+            mov.w   R12,    R10             ; digit = value - 10 * q
+            rla.w   R10
+            rla.w   R10
+            add.w   R12,    R10
+            rla.w   R10
+            sub.w   R10,    R11
+            add.w   #'0',   R11
+            push.w  R11
+            tst.w   R12
+            jnz     narrowLoop
+
+            mov.w   R15,    R12             ; count
+popLoop:
+            pop.w   R11                     ; most significant first
+            mov.b   R11,    0(R14)
+            inc.w   R14
+            dec.w   R15
+            jnz     popLoop
+            clr.b   0(R14)
+
+            pop     R10
+            ret
+            .end
@@ -0,0 +1,148 @@
+;-------------------------------------------------------------------------------
+; File:         SW_decimal.asm
+; Description:  Binary to decimal text without division or multiplier, for every
+;               MSP430 (F2013, FG4618 ...): double dabble with DADD, which doubles
+;               the BCD digits and adds the bit shifted out of the value in one
+;               instruction per BCD word. Values that fit 16 or 8 bits take 16 or 8
+;               rounds instead of 32. C prototypes:
+;
+;                   unsigned int SW_utoa32(unsigned long value, char* buf);
+;                   unsigned int SW_itoa32(long value, char* buf);
+;                   unsigned int SW_utoa16(unsigned int value, char* buf);
+;                   unsigned int SW_itoa16(int value, char* buf);
+;
+;               buf gets the digits (with '-' when negative) and a NUL, the
+;               return value is their count. 8-bit values go through the
+;               16-bit routines (the caller's conversion to int extends them)
+; Author(s):    Polickoski, Nick
+; Date:         October 17, 2026
+;-------------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    SW_utoa32               ; unsigned long to decimal
+            .def    SW_itoa32               ; long to decimal
+            .def    SW_utoa16               ; unsigned int to decimal
+            .def    SW_itoa16               ; int to decimal
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutines
+;-------------------------------------------------------------------------------
+SW_itoa16:
+            mov.w   R13,    R14             ; buf
+            clr.w   R13                     ; value as a long
+            tst.w   R12
+            jge     SW_utoa32
+            inv.w   R12                     ; -value fits the unsigned routine
+            inc.w   R12
+            jmp     minus
+
+SW_itoa32:
+            tst.w   R13
+            jge     SW_utoa32
+            inv.w   R12                     ; -value: R13:R12 negated
+            inv.w   R13
+            inc.w   R12
+            adc.w   R13
+minus:
+            mov.b   #'-',   0(R14)
+            inc.w   R14
+            call    #SW_utoa32
+            inc.w   R12                     ; count the sign
+            ret
+
+SW_utoa16:
+            mov.w   R13,    R14             ; buf
+            clr.w   R13                     ; value as an unsigned long
+
+SW_utoa32:
+            push    R8                      ; round / digit counter
+            push    R9                      ; digit
+            push    R10                     ; BCD digits 9..8
+            clr.w   R15                     ; BCD digits 3..0
+            clr.w   R11                     ; BCD digits 7..4
+            clr.w   R10
+
+            mov.w   #32,    R8
+            tst.w   R13
+            jnz     dabble
+            mov.w   R12,    R13             ; 16 bits: only R13 is shifted out
+            mov.w   #16,    R8
+            cmp.w   #256,   R13
+            jhs     dabble
+            swpb    R13                     ; 8 bits: from the high byte
+            mov.w   #8,     R8
+
+dabble:
+            rla.w   R12                     ; next bit of the value into C
+            rlc.w   R13
+            dadd.w  R15,    R15             ; BCD * 2 + C
+            dadd.w  R11,    R11
+            dadd.w  R10,    R10
+            dec.w   R8
+            jnz     dabble
+
+            mov.w   R14,    R12             ; start of the digits: nothing written while R14 == R12
+            tst.w   R10
+            jz      middle
+            mov.w   R10,    R13
+            swpb    R13                     ; digits 9..8 to the top
+            mov.w   #2,     R8
+            call    #bcdDigits
+middle:
+            cmp.w   R12,    R14
+            jne     middleDigits            ; digits 9..8 written: all of these count
+            tst.w   R11
+            jz      low                     ; still leading zeros
+middleDigits:
+            mov.w   R11,    R13
+            mov.w   #4,     R8
+            call    #bcdDigits
+low:
+            mov.w   R15,    R13
+            mov.w   #4,     R8
+            call    #bcdDigits
+
+            cmp.w   R12,    R14
+            jne     done
+            mov.b   #'0',   0(R14)          ; value 0
+            inc.w   R14
+done:
+            clr.b   0(R14)
+            sub.w   R12,    R14
+            mov.w   R14,    R12             ; count
+
+            pop     R10
+            pop     R9
+            pop     R8
+            ret
+
+;-------------------------------------------------------------------------------
+; writes the R8 BCD digits at the top of R13 to R14+, skipping zeros while no
+; digit is written yet (R14 == R12)
+;-------------------------------------------------------------------------------
+bcdDigits:
+            clr.w   R9
+            rla.w   R13                     ; top digit into R9
+            rlc.w   R9
+            rla.w   R13
+            rlc.w   R9
+            rla.w   R13
+            rlc.w   R9
+            rla.w   R13
+            rlc.w   R9
+            cmp.w   R12,    R14
+            jne     bcdStore                ; digits written: zeros count
+            tst.w   R9
+            jz      bcdNext                 ; leading zero
+bcdStore:
+            add.w   #'0',   R9
+            mov.b   R9,     0(R14)
+            inc.w   R14
+bcdNext:
+            dec.w   R8
+            jnz     bcdDigits
+            ret
+            .end
@@ -0,0 +1,141 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        classwork.cpp
+ * Description:     Benchmark bindings for the class assignment routines:
+ *              COMPUTEPARITY (cpe232_hw3/q4.asm: even parity of bits 0..13
+ *              into bit 15, R4 = array, R5 = length) and findDelta
+ *              (cpe323_quiz3: max - min of a signed array, arguments on the
+ *              stack; run up to endLoop because its epilogue pops its own
+ *              arguments)
+ *
+ * Distributions:   random, zero, ones (parity); random, sorted, reverse (delta)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+
+#include <algorithm>
+
+
+
+//// Kernels
+namespace
+{
+
+using namespace hostsim;
+
+void generateParity(Input& in, Rng& rng)
+{
+    in.a.resize(in.n);
+    for (int32_t& w : in.a)
+    {
+        w = in.dist == "zero" ? 0 : in.dist == "ones" ? 0x3FFF : rng.range(0, 0xFFFF);
+    }
+}
+
+
+void setupParity(Target& t, const Input& in)
+{
+    t.out = t.words(in.a);
+    t.cpu().setReg(4, t.out);
+    t.cpu().setReg(5, (uint32_t)in.n);
+}
+
+
+uint64_t resultParity(Target& t, const Input& in)
+{
+    std::vector<uint16_t> w(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        w[i] = t.peek16(t.out + 2 * (uint32_t)i);
+    }
+    return checksum(w.data(), 2 * w.size());
+}
+
+
+uint64_t hostParity(const Input& in)
+{
+    std::vector<uint16_t> w(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        w[i] = (uint16_t)in.a[i];
+        if (!(__builtin_popcount(w[i] & 0x3FFF) & 1))
+        {
+            w[i] |= 0x8000;
+        }
+    }
+    return checksum(w.data(), 2 * w.size());
+}
+
+
+void generateDelta(Input& in, Rng& rng)
+{
+    in.a.resize(in.n);
+    for (int32_t& v : in.a)
+    {
+        v = rng.range(-1000, 1000);
+    }
+    if (in.dist == "sorted")
+    {
+        std::sort(in.a.begin(), in.a.end());
+    }
+    else if (in.dist == "reverse")
+    {
+        std::sort(in.a.rbegin(), in.a.rend());
+    }
+}
+
+
+// push #arr, push length, call (the return address is never used: stopped at endLoop)
+void setupDelta(Target& t, const Input& in)
+{
+    uint32_t a = t.words(in.a);
+    t.cpu().push(a);
+    t.cpu().push((uint16_t)in.n);
+    t.cpu().push(0);
+}
+
+
+uint64_t resultDelta(Target& t, const Input& in)
+{
+    (void)in;
+    uint16_t d = (uint16_t)(t.cpu().reg(6) - t.cpu().reg(7));
+    return checksum(&d, sizeof(d));
+}
+
+
+uint64_t hostDelta(const Input& in)
+{
+    // same comparisons as the routine: the N flag of a 16-bit subtraction
+    uint16_t max = (uint16_t)in.a[0], min = (uint16_t)in.a[0];
+    for (size_t i = 1; i < in.n; i++)
+    {
+        uint16_t v = (uint16_t)in.a[i];
+        if ((uint16_t)(max - v) & 0x8000)
+        {
+            max = v;
+        }
+        if (!((uint16_t)(min - v) & 0x8000))
+        {
+            min = v;
+        }
+    }
+    uint16_t d = (uint16_t)(max - min);
+    return checksum(&d, sizeof(d));
+}
+
+
+const TargetSpec parity{Device::F5529, {"cpe325_classAssignments/cpe232_hw3/q4.asm"}, "COMPUTEPARITY", nullptr,
+                        setupParity, resultParity};
+const TargetSpec delta{Device::F5529, {"cpe325_classAssignments/cpe323_quiz3/cpe323_quiz3.asm"}, "findDelta",
+                       "endLoop", setupDelta, resultDelta};
+
+}   // namespace
+
+HOSTSIM_KERNEL(compute_parity, {"COMPUTEPARITY", "cpe325_classAssignments/cpe232_hw3/q4.asm", {4, 64, 512},
+                                {"random", "zero", "ones"}, generateParity, hostParity, &parity});
+HOSTSIM_KERNEL(find_delta, {"findDelta", "cpe325_classAssignments/cpe323_quiz3/cpe323_quiz3.asm", {8, 64, 512},
+                            {"random", "sorted", "reverse"}, generateDelta, hostDelta, &delta});
@@ -0,0 +1,222 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        decimal.cpp
+ * Description:     Benchmark bindings for the division-free binary to decimal
+ *              routines: HW_utoa32/HW_itoa32/HW_utoa16/HW_itoa16
+ *              (HW_decimal.asm, reciprocal multiply on the MPY32) and the SW_
+ *              versions (SW_decimal.asm, DADD double dabble, no multiplier).
+ *              The size is the width of the value in bits (8-bit values go
+ *              through the 16-bit routines); one call converts one value and
+ *              the per-element figures are per digit written. The host runs a
+ *              port of each routine (the same reciprocal and BCD arithmetic)
+ *
+ * Distributions:   uniform (any value of the width), small (magnitudes below 100)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+
+#include <cstdio>
+
+
+
+//// Kernels
+namespace
+{
+
+using namespace hostsim;
+
+template <bool Signed, bool Wide>
+void generate(Input& in, Rng& rng)
+{
+    const unsigned bits = (unsigned)in.n;
+    uint32_t v;
+
+    if (in.dist == "small")
+    {
+        v = (uint32_t)rng.range(Signed ? -99 : 0, 99);
+    }
+    else
+    {
+        v = (uint32_t)rng.next() & (bits == 32 ? 0xFFFFFFFFu : (1u << bits) - 1);
+        if (Signed && bits < 32 && (v >> (bits - 1)) & 1)
+        {
+            v |= ~0u << bits;                       // sign-extended like the caller's conversion to int
+        }
+    }
+    if (!Wide)
+    {
+        v &= 0xFFFF;                                // passed in one register
+    }
+    in.x = (int32_t)v;
+
+    char text[16];
+    if (Signed)
+    {
+        in.elements = (size_t)snprintf(text, sizeof(text), "%d", Wide ? (int)v : (int)(int16_t)v);
+    }
+    else
+    {
+        in.elements = (size_t)snprintf(text, sizeof(text), "%u", v);
+    }
+}
+
+
+size_t reciprocal(uint32_t v, char* out)
+/* HW_utoa32: q = v * 0xCCCCCCCD >> 35 while v needs 32 bits, then v * 0xCCCD >> 19
+ */
+{
+    char digits[10];
+    size_t n = 0;
+    while (v > 0xFFFF)
+    {
+        uint32_t q = (uint32_t)(((uint64_t)v * 0xCCCCCCCDu) >> 35);
+        digits[n++] = (char)('0' + (uint16_t)(v - 10 * q));
+        v = q;
+    }
+    do
+    {
+        uint16_t q = (uint16_t)((v * 0xCCCDu) >> 19);
+        digits[n++] = (char)('0' + (uint16_t)(v - 10 * q));
+        v = q;
+    } while (v);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        out[i] = digits[n - 1 - i];
+    }
+    out[n] = '\0';
+    return n;
+}
+
+
+uint16_t dadd(uint16_t a, uint16_t b, bool& carry)
+/* DADD.W: four BCD digits, carry in and out
+ */
+{
+    uint16_t r = 0;
+    unsigned c = carry;
+    for (int shift = 0; shift < 16; shift += 4)
+    {
+        unsigned d = ((a >> shift) & 0xF) + ((b >> shift) & 0xF) + c;
+        c = d > 9;
+        r |= (uint16_t)((c ? d - 10 : d) << shift);
+    }
+    carry = c;
+    return r;
+}
+
+
+size_t dabble(uint32_t v, char* out)
+/* SW_utoa32: 32, 16 or 8 rounds of shift-and-DADD, then the BCD digits without
+ * leading zeros
+ */
+{
+    uint16_t bcd[3] = {0, 0, 0};                    // digits 3..0, 7..4, 9..8
+    int rounds = v > 0xFFFF ? 32 : v > 0xFF ? 16 : 8;
+
+    v <<= 32 - rounds;
+    for (int i = 0; i < rounds; i++)
+    {
+        bool carry = (v >> 31) & 1;
+        v <<= 1;
+        for (uint16_t& w : bcd)
+        {
+            w = dadd(w, w, carry);
+        }
+    }
+
+    size_t n = 0;
+    for (int d = 9; d >= 0; d--)
+    {
+        unsigned digit = (bcd[d / 4] >> (4 * (d % 4))) & 0xF;
+        if (digit || n || d == 0)
+        {
+            out[n++] = (char)('0' + digit);
+        }
+    }
+    out[n] = '\0';
+    return n;
+}
+
+
+template <size_t (*Convert)(uint32_t, char*), bool Signed, bool Wide>
+uint64_t host(const Input& in)
+{
+    char text[16];
+    uint32_t v = (uint32_t)in.x;
+    size_t n = 0;
+
+    if (Signed && (Wide ? (int32_t)v < 0 : (int16_t)v < 0))
+    {
+        text[n++] = '-';
+        v = Wide ? 0u - v : (uint16_t)(0u - v);
+    }
+    n += Convert(v, text + n);
+    return checksum(text, n);
+}
+
+
+template <bool Wide>
+void setup(Target& t, const Input& in)
+{
+    t.out = t.alloc(16);
+    t.cpu().setReg(12, (uint32_t)in.x & 0xFFFF);
+    if (Wide)
+    {
+        t.cpu().setReg(13, (uint32_t)in.x >> 16);
+        t.cpu().setReg(14, t.out);
+    }
+    else
+    {
+        t.cpu().setReg(13, t.out);
+    }
+}
+
+
+uint64_t result(Target& t, const Input&)
+{
+    char text[16];
+    size_t n = 0;
+    while (n < sizeof(text) - 1 && (text[n] = (char)t.peek8(t.out + (uint32_t)n)))
+    {
+        n++;
+    }
+    if (t.cpu().reg(12) != n)                       // the returned count must match the text
+    {
+        return 0;
+    }
+    return checksum(text, n);
+}
+
+
+const TargetSpec hwUtoa32{Device::F5529, {"hostsim/bench/HW_decimal.asm"}, "HW_utoa32", nullptr, setup<true>, result};
+const TargetSpec hwItoa32{Device::F5529, {"hostsim/bench/HW_decimal.asm"}, "HW_itoa32", nullptr, setup<true>, result};
+const TargetSpec hwUtoa16{Device::F5529, {"hostsim/bench/HW_decimal.asm"}, "HW_utoa16", nullptr, setup<false>, result};
+const TargetSpec hwItoa16{Device::F5529, {"hostsim/bench/HW_decimal.asm"}, "HW_itoa16", nullptr, setup<false>, result};
+const TargetSpec swUtoa32{Device::F5529, {"hostsim/bench/SW_decimal.asm"}, "SW_utoa32", nullptr, setup<true>, result};
+const TargetSpec swItoa32{Device::F5529, {"hostsim/bench/SW_decimal.asm"}, "SW_itoa32", nullptr, setup<true>, result};
+const TargetSpec swUtoa16{Device::F5529, {"hostsim/bench/SW_decimal.asm"}, "SW_utoa16", nullptr, setup<false>, result};
+const TargetSpec swItoa16{Device::F5529, {"hostsim/bench/SW_decimal.asm"}, "SW_itoa16", nullptr, setup<false>, result};
+
+}   // namespace
+
+HOSTSIM_KERNEL(hw_utoa32, {"HW_utoa32", "hostsim/bench/HW_decimal.asm", {8, 16, 32}, {"uniform", "small"},
+                           generate<false, true>, host<reciprocal, false, true>, &hwUtoa32});
+HOSTSIM_KERNEL(hw_itoa32, {"HW_itoa32", "hostsim/bench/HW_decimal.asm", {8, 16, 32}, {"uniform", "small"},
+                           generate<true, true>, host<reciprocal, true, true>, &hwItoa32});
+HOSTSIM_KERNEL(hw_utoa16, {"HW_utoa16", "hostsim/bench/HW_decimal.asm", {8, 16}, {"uniform", "small"},
+                           generate<false, false>, host<reciprocal, false, false>, &hwUtoa16});
+HOSTSIM_KERNEL(hw_itoa16, {"HW_itoa16", "hostsim/bench/HW_decimal.asm", {8, 16}, {"uniform", "small"},
+                           generate<true, false>, host<reciprocal, true, false>, &hwItoa16});
+HOSTSIM_KERNEL(sw_utoa32, {"SW_utoa32", "hostsim/bench/SW_decimal.asm", {8, 16, 32}, {"uniform", "small"},
+                           generate<false, true>, host<dabble, false, true>, &swUtoa32});
+HOSTSIM_KERNEL(sw_itoa32, {"SW_itoa32", "hostsim/bench/SW_decimal.asm", {8, 16, 32}, {"uniform", "small"},
+                           generate<true, true>, host<dabble, true, true>, &swItoa32});
+HOSTSIM_KERNEL(sw_utoa16, {"SW_utoa16", "hostsim/bench/SW_decimal.asm", {8, 16}, {"uniform", "small"},
+                           generate<false, false>, host<dabble, false, false>, &swUtoa16});
+HOSTSIM_KERNEL(sw_itoa16, {"SW_itoa16", "hostsim/bench/SW_decimal.asm", {8, 16}, {"uniform", "small"},
+                           generate<true, false>, host<dabble, true, false>, &swItoa16});
@@ -0,0 +1,100 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        format.cpp
+ * Description:     Benchmark bindings for the compile-time formatter of
+ *              hostsim/format.h against the stdio calls it replaces, on the
+ *              formats of the labs: TimeStamp, the "%05d:%01d" clock of
+ *              Lab8_D3.c SendTime(), and PowerLine, the "%d raised to the power
+ *              %d is %ld\n" result line of Lab01_P1.c; TimeStampSprintf and
+ *              PowerLineSnprintf write the same text with the C library (the
+ *              checksums of each pair must match). One call formats n lines
+ *
+ * Distributions:   uniform (any int / 32-bit long), small (values below 100)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+#include "hostsim/format.h"
+
+#include <cstdio>
+
+
+
+//// Kernels
+namespace
+{
+
+using namespace hostsim;
+
+void generate(Input& in, Rng& rng)
+{
+    const int32_t limit = in.dist == "small" ? 99 : 2147483647;
+    in.a.resize(in.n);
+    in.b.resize(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        in.a[i] = rng.range(in.dist == "small" ? 0 : -limit, limit);
+        in.b[i] = rng.range(0, in.dist == "small" ? 9 : limit);
+    }
+    in.elements = in.n;                                                 // lines
+}
+
+
+template <bool Stdio>
+uint64_t hostTime(const Input& in)
+{
+    char time[16];
+    uint64_t h = 0;
+    for (size_t i = 0; i < in.n; i++)
+    {
+        size_t n;
+        if (Stdio)
+        {
+            n = (size_t)snprintf(time, sizeof(time), "%05d:%01d", in.a[i], in.b[i]);
+        }
+        else
+        {
+            n = formatTo(time, sizeof(time), HOSTSIM_FMT("%05d:%01d"), in.a[i], in.b[i]);
+        }
+        h = checksum(time, n, h);
+    }
+    return h;
+}
+
+
+template <bool Stdio>
+uint64_t hostPower(const Input& in)
+{
+    char line[64];
+    uint64_t h = 0;
+    for (size_t i = 0; i < in.n; i++)
+    {
+        const int a = in.a[i] % 100, p = (int)(in.b[i] % 32);
+        const long b = (long)in.a[i] * in.b[i] % 2147483647L;
+        size_t n;
+        if (Stdio)
+        {
+            n = (size_t)snprintf(line, sizeof(line), "%d raised to the power %d is %ld\n", a, p, b);
+        }
+        else
+        {
+            n = formatTo(line, sizeof(line), HOSTSIM_FMT("%d raised to the power %d is %ld\n"), a, p, b);
+        }
+        h = checksum(line, n, h);
+    }
+    return h;
+}
+
+}   // namespace
+
+HOSTSIM_KERNEL(time_stamp, {"TimeStamp", "lab08/Lab8_D3.c", {1, 64}, {"uniform", "small"},
+                            generate, hostTime<false>, nullptr});
+HOSTSIM_KERNEL(time_stamp_sprintf, {"TimeStampSprintf", "lab08/Lab8_D3.c", {1, 64}, {"uniform", "small"},
+                                    generate, hostTime<true>, nullptr});
+HOSTSIM_KERNEL(power_line, {"PowerLine", "lab01/lab1_pt1/Lab01_P1.c", {1, 64}, {"uniform", "small"},
+                            generate, hostPower<false>, nullptr});
+HOSTSIM_KERNEL(power_line_snprintf, {"PowerLineSnprintf", "lab01/lab1_pt1/Lab01_P1.c", {1, 64}, {"uniform", "small"},
+                                     generate, hostPower<true>, nullptr});
@@ -0,0 +1,78 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab01_p1.cpp
+ * Description:     Benchmark binding for CalcPower in lab01/lab1_pt1/Lab01_P1.c:
+ *              CalcPowerBatch over 16 bases raised to the case's exponent (host
+ *              only). The lab is built without its MPY32 path here, so the host
+ *              figure is the native multiply rather than the multiplier model
+ *
+ * Distributions:   small (bases 2..3), uniform (bases -9..9)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/bench.h"
+
+#undef __MSP430_HAS_MPY32__             // no machine behind the kernels' host calls
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab01_p1
+{
+#include "../../lab01/lab1_pt1/Lab01_P1.c"
+}
+#undef main
+
+
+
+//// Kernel
+namespace
+{
+
+using namespace hostsim;
+
+constexpr int BATCH = 16;
+
+void generate(Input& in, Rng& rng)
+{
+    in.a.clear();
+    for (int i = 0; i < BATCH; i++)
+    {
+        in.a.push_back(in.dist == "small" ? rng.range(2, 3) : rng.range(-9, 9));
+    }
+    in.x = (int32_t)in.n;
+    in.elements = BATCH;
+}
+
+
+uint64_t host(const Input& in)
+{
+    lab01_p1::PowerPair pairs[BATCH];
+    long int results[BATCH];
+    unsigned char overflow[BATCH];
+    for (int i = 0; i < BATCH; i++)
+    {
+        pairs[i] = {in.a[i], in.x};
+    }
+
+    unsigned int overflows = lab01_p1::CalcPowerBatch(pairs, results, overflow, BATCH);
+    uint64_t h = checksum(&overflows, sizeof(overflows));
+    for (int i = 0; i < BATCH; i++)
+    {
+        int32_t r = (int32_t)results[i];
+        h = checksum(&r, sizeof(r), h);
+    }
+    return checksum(overflow, sizeof(overflow), h);
+}
+
+}   // namespace
+
+HOSTSIM_KERNEL(calc_power, {"CalcPower", "lab01/lab1_pt1/Lab01_P1.c", {1, 4, 16, 31}, {"small", "uniform"},
+                            generate, host, nullptr});
@@ -0,0 +1,123 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab01_p2.cpp
+ * Description:     Benchmark binding for get_prime_factors in
+ *              lab01/lab1_pt2/Lab01_P2.c: one value of the case's size in
+ *              bits, up to 32 (host only)
+ *
+ * Distributions:   random (uniform n-bit value), prime (largest prime below
+ *                  2^n), smooth (product of primes below 32), semiprime
+ *                  (product of two random n/2-bit primes)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/bench.h"
+
+#undef __MSP430_HAS_MPY32__             // no machine behind the kernels' host calls
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab01_p2
+{
+#include "../../lab01/lab1_pt2/Lab01_P2.c"
+}
+#undef main
+#undef true
+#undef false
+
+
+
+//// Kernel
+namespace
+{
+
+using namespace hostsim;
+
+bool isPrime(int64_t v)
+{
+    if (v < 2)
+    {
+        return false;
+    }
+    for (int64_t d = 2; d * d <= v; d++)
+    {
+        if (v % d == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+
+void generate(Input& in, Rng& rng)
+{
+    int64_t top = (int64_t)1 << in.n;
+    int64_t v;
+
+    if (in.dist == "prime")
+    {
+        for (v = top - 1; !isPrime(v); v--)
+        {
+        }
+    }
+    else if (in.dist == "semiprime")
+    {
+        int64_t half = (int64_t)1 << (in.n / 2), p, q;
+        for (p = half / 2 + (int64_t)(rng.next() % (uint64_t)(half / 2)); !isPrime(p); p--)
+        {
+        }
+        for (q = half / 2 + (int64_t)(rng.next() % (uint64_t)(half / 2)); !isPrime(q); q--)
+        {
+        }
+        v = p * q;
+    }
+    else if (in.dist == "smooth")
+    {
+        static const int small[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31};
+        v = 1;
+        while (true)
+        {
+            int p = small[rng.next() % 11];
+            if (v * p >= top)
+            {
+                break;
+            }
+            v *= p;
+        }
+    }
+    else
+    {
+        v = (int64_t)(top / 2 + rng.next() % (uint64_t)(top / 2));
+    }
+    in.x = (int32_t)(uint32_t)v;
+    in.elements = 1;
+}
+
+
+uint64_t host(const Input& in)
+{
+    lab01_p2::PrimePower factors[MAX_PRIME_POWERS] = {};
+    int n = lab01_p2::get_prime_factors(factors, (uint32_t)in.x);
+    uint64_t h = checksum(&n, sizeof(n));
+    for (int i = 0; i < n; i++)
+    {
+        uint32_t p = (uint32_t)factors[i].prime;
+        h = checksum(&p, sizeof(p), h);
+        h = checksum(&factors[i].exponent, 1, h);
+    }
+    return h;
+}
+
+}   // namespace
+
+HOSTSIM_KERNEL(get_prime_factors, {"get_prime_factors", "lab01/lab1_pt2/Lab01_P2.c", {8, 16, 24, 32},
+                                   {"random", "prime", "smooth", "semiprime"}, generate, host, nullptr});
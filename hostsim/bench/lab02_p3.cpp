@@ -0,0 +1,272 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab02_p3.cpp
+ * Description:     Benchmark bindings for lab02/lab2_pt3/Lab02_P3.c: MatrixMul,
+ *              one SIZE x SIZE float product (host only; SIZE is fixed at 8 by
+ *              the lab source), MatrixMulAuto, the same product through the
+ *              structure-detecting engine (identity and circulant operands take
+ *              its copy and rotation kernels, random ones fall back to dense),
+ *              MatrixMulQ15, the same products in Q15 with
+ *              the size set per case. The host runs the lab's C fallback; the
+ *              target runs lab02_p3_q15.asm, the MACS loop written out in assembly
+ *              (there is no C compiler for the instruction-set model); and
+ *              MatrixMulTiled, the host matmul() of hostsim/matrix.h on the same
+ *              inputs from 8x8 to 1024x1024, with the kernel picked at run time
+ *              and forced to SSE and scalar for comparison (integer inputs keep
+ *              every sum exact, so all of them match MatrixMul's checksum);
+ *              FormatMatrix, the n x n float print of PrintMatrixView() through
+ *              FormatFloat() into a buffer, against FormatMatrixPrintf, the same
+ *              text from snprintf("%10f, ") (the two must match)
+ *
+ * Distributions:   identity (circulant times identity, as in the lab),
+ *                  circulant (two circulants), random (values -8..8); in Q15
+ *                  every value is divided by 32 (Q15_SCALE); for the formatters
+ *                  integer (products of random matrices) and fraction (six
+ *                  random decimals, magnitudes below 1000)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <float.h>
+
+#include "hostsim/bench.h"
+#include "hostsim/matrix.h"
+
+#undef __MSP430_HAS_MPY32__             // no machine behind the kernels' host calls
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab02_p3
+{
+#include "../../lab02/lab2_pt3/Lab02_P3.c"
+}
+#undef main
+
+
+
+//// Kernel
+namespace
+{
+
+using namespace hostsim;
+
+constexpr int N = SIZE;
+
+void fill(Input& in, Rng& rng, int n)
+{
+    in.a.assign(n * n, 0);
+    in.b.assign(n * n, 0);
+    for (int r = 0; r < n; r++)
+    {
+        for (int c = 0; c < n; c++)
+        {
+            in.a[r * n + c] = (c - r + n) % n % 8 + 1;                  // matrix1 of the lab
+            if (in.dist == "identity")
+            {
+                in.b[r * n + c] = r == c;
+            }
+            else if (in.dist == "circulant")
+            {
+                in.b[r * n + c] = (c + r) % n % 8 + 2;
+            }
+            else
+            {
+                in.a[r * n + c] = rng.range(-8, 8);
+                in.b[r * n + c] = rng.range(-8, 8);
+            }
+        }
+    }
+    in.elements = (size_t)n * n * n;                                    // multiply-adds
+}
+
+
+void generate(Input& in, Rng& rng)
+{
+    fill(in, rng, N);
+}
+
+
+void generateQ15(Input& in, Rng& rng)
+{
+    fill(in, rng, (int)in.n);
+    for (size_t i = 0; i < in.a.size(); i++)
+    {
+        in.a[i] = lab02_p3::FloatToQ15(in.a[i] / Q15_SCALE);
+        in.b[i] = lab02_p3::FloatToQ15(in.b[i] / Q15_SCALE);
+    }
+}
+
+
+uint64_t host(const Input& in)
+{
+    float m1[N][N], m2[N][N], r[N][N];
+    for (int i = 0; i < N * N; i++)
+    {
+        m1[i / N][i % N] = (float)in.a[i];
+        m2[i / N][i % N] = (float)in.b[i];
+    }
+    lab02_p3::MatrixMul(m1, m2, r);
+    return checksum(r, sizeof(r));
+}
+
+
+uint64_t hostAuto(const Input& in)
+{
+    float m1[N][N], m2[N][N], r[N][N];
+    for (int i = 0; i < N * N; i++)
+    {
+        m1[i / N][i % N] = (float)in.a[i];
+        m2[i / N][i % N] = (float)in.b[i];
+    }
+    lab02_p3::MatrixMulAuto(m1, m2, r);
+    return checksum(r, sizeof(r));
+}
+
+
+uint64_t hostQ15(const Input& in)
+{
+    std::vector<int> m1(in.a.begin(), in.a.end()), m2(in.b.begin(), in.b.end());
+    std::vector<long int> r(in.n * in.n);
+    lab02_p3::MatrixMulQ15(m1.data(), m2.data(), r.data(), (unsigned int)in.n);
+
+    std::vector<int32_t> q31(r.begin(), r.end());
+    return checksum(q31.data(), 4 * q31.size());
+}
+
+
+template <MatmulIsa Isa>
+uint64_t hostTiled(const Input& in)
+{
+    std::vector<float> m1(in.a.begin(), in.a.end()), m2(in.b.begin(), in.b.end()), r(in.n * in.n);
+    setMatmulIsa(Isa);
+    matmul(m1.data(), m2.data(), r.data(), in.n);
+    return checksum(r.data(), sizeof(float) * r.size());
+}
+
+
+void generateTiled(Input& in, Rng& rng)
+{
+    fill(in, rng, (int)in.n);
+}
+
+
+void generateFormat(Input& in, Rng& rng)
+{
+    const size_t n = in.n;
+    in.a.assign(n * n, 0);
+    for (size_t i = 0; i < n * n; i++)
+    {
+        if (in.dist == "integer")
+        {
+            for (size_t k = 0; k < SIZE; k++)
+            {
+                in.a[i] += rng.range(-8, 8) * rng.range(-8, 8);
+            }
+        }
+        else
+        {
+            in.a[i] = rng.range(-999999999, 999999999);            // millionths
+        }
+    }
+    in.elements = n * n;                                                // fields
+}
+
+
+std::vector<float> formatInput(const Input& in)
+{
+    std::vector<float> m(in.a.size());
+    for (size_t i = 0; i < m.size(); i++)
+    {
+        m[i] = in.dist == "integer" ? (float)in.a[i] : (float)(in.a[i] / 1e6);
+    }
+    return m;
+}
+
+
+uint64_t hostFormat(const Input& in)
+{
+    static std::vector<char> text;
+    std::vector<float> m = formatInput(in);
+    const lab02_p3::MatrixView view = lab02_p3::MatrixViewOf(m.data(), (unsigned short)in.n, (unsigned short)in.n);
+    size_t length = 0;
+
+    text.resize(in.n * PRINT_ROW_MAX(in.n));
+    for (size_t r = 0; r < in.n; r++)
+    {
+        length += lab02_p3::FormatMatrixRow(&text[length], &view, (unsigned short)r);
+    }
+    return checksum(text.data(), length);
+}
+
+
+uint64_t hostFormatPrintf(const Input& in)
+{
+    static std::vector<char> text;
+    std::vector<float> m = formatInput(in);
+    size_t length = 0;
+
+    text.resize(in.n * PRINT_ROW_MAX(in.n));
+    for (size_t r = 0; r < in.n; r++)
+    {
+        text[length++] = '[';
+        for (size_t c = 0; c < in.n; c++)
+        {
+            length += snprintf(&text[length], text.size() - length, "%10f, ", m[r * in.n + c]);
+        }
+        length += snprintf(&text[length], text.size() - length, "]\n");
+    }
+    return checksum(text.data(), length);
+}
+
+
+// MatrixMulQ15(mtx1, mtx2, mtxRslt, size): arguments in R12..R15
+void setupQ15(Target& t, const Input& in)
+{
+    uint32_t m1 = t.words(in.a);
+    uint32_t m2 = t.words(in.b);
+    t.out = t.alloc(4 * in.n * in.n);
+    t.cpu().setReg(12, m1);
+    t.cpu().setReg(13, m2);
+    t.cpu().setReg(14, t.out);
+    t.cpu().setReg(15, (uint32_t)in.n);
+}
+
+
+uint64_t resultQ15(Target& t, const Input& in)
+{
+    std::vector<int32_t> q31(in.n * in.n);
+    for (size_t i = 0; i < q31.size(); i++)
+    {
+        uint32_t addr = t.out + 4 * (uint32_t)i;
+        q31[i] = (int32_t)((uint32_t)t.peek16(addr + 2) << 16 | t.peek16(addr));
+    }
+    return checksum(q31.data(), 4 * q31.size());
+}
+
+
+const TargetSpec q15{Device::F5529, {"hostsim/bench/lab02_p3_q15.asm"}, "MatrixMulQ15", nullptr, setupQ15, resultQ15};
+
+}   // namespace
+
+HOSTSIM_KERNEL(matrix_mul, {"MatrixMul", "lab02/lab2_pt3/Lab02_P3.c", {SIZE}, {"identity", "circulant", "random"},
+                            generate, host, nullptr});
+HOSTSIM_KERNEL(matrix_mul_auto, {"MatrixMulAuto", "lab02/lab2_pt3/Lab02_P3.c", {SIZE}, {"identity", "circulant", "random"},
+                                 generate, hostAuto, nullptr});
+HOSTSIM_KERNEL(matrix_mul_q15, {"MatrixMulQ15", "lab02/lab2_pt3/Lab02_P3.c", {4, 8, 16}, {"identity", "circulant", "random"},
+                                generateQ15, hostQ15, &q15});
+HOSTSIM_KERNEL(matrix_mul_tiled, {"MatrixMulTiled", "hostsim/src/matrix.cpp", {8, 64, 256, 1024},
+                                  {"identity", "circulant", "random"}, generateTiled, hostTiled<MatmulIsa::Auto>, nullptr});
+HOSTSIM_KERNEL(matrix_mul_sse, {"MatrixMulSse", "hostsim/src/matrix.cpp", {8, 64, 256, 1024},
+                                {"identity", "circulant", "random"}, generateTiled, hostTiled<MatmulIsa::Sse>, nullptr});
+HOSTSIM_KERNEL(matrix_mul_scalar, {"MatrixMulScalar", "hostsim/src/matrix.cpp", {8, 64, 256, 1024},
+                                   {"identity", "circulant", "random"}, generateTiled, hostTiled<MatmulIsa::Scalar>, nullptr});
+HOSTSIM_KERNEL(format_matrix, {"FormatMatrix", "lab02/lab2_pt3/Lab02_P3.c", {SIZE, 64}, {"integer", "fraction"},
+                               generateFormat, hostFormat, nullptr});
+HOSTSIM_KERNEL(format_matrix_printf, {"FormatMatrixPrintf", "lab02/lab2_pt3/Lab02_P3.c", {SIZE, 64}, {"integer", "fraction"},
+                                      generateFormat, hostFormatPrintf, nullptr});
@@ -0,0 +1,74 @@
+;-------------------------------------------------------------------------------
+; File:         lab02_p3_q15.asm
+; Description:  MatrixMulQ15 of lab02/lab2_pt3/Lab02_P3.c written out in assembly,
+;               so the benchmark can count its cycles on the instruction-set model.
+;               Same arguments as the C prototype (R12 = mtx1, R13 = mtx2,
+;               R14 = mtxRslt, R15 = size) and the same MACS chain per element
+; Author(s):    Polickoski, Nick
+; Date:         October 17, 2026
+;-------------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    MatrixMulQ15            ; Q15 x Q15 -> Q31 matrix product
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutine
+;-------------------------------------------------------------------------------
+MatrixMulQ15:
+            push    R4                      ; row pointer into mtx1
+            push    R5                      ; column pointer into mtx2
+            push    R6                      ; inner counter
+            push    R7                      ; column start in mtx2
+            push    R8                      ; column counter
+            push    R9                      ; row counter
+            push    R10                     ; row stride in bytes
+            push    &MPY32CTL0              ; restored on return
+
+            bis.w   #MPYFRAC+MPYSAT, &MPY32CTL0     ; read RESHI:RESLO as saturated Q31
+            mov.w   R15,    R10
+            rla.w   R10                     ; stride = 2 * size
+            mov.w   R15,    R9
+
+rowLoop:
+            mov.w   R13,    R7              ; column 0 of mtx2
+            mov.w   R15,    R8
+
+colLoop:
+            clr.w   &RESLO                  ; the MACS chain accumulates into RESHI:RESLO
+            clr.w   &RESHI
+            mov.w   R12,    R4
+            mov.w   R7,     R5
+            mov.w   R15,    R6
+
+macLoop:
+            mov.w   @R4+,   &MACS           ; mtx1[row][temp]
+            mov.w   @R5,    &OP2            ; mtx2[temp][col], starts the MAC
+            add.w   R10,    R5              ; next row of mtx2
+            dec.w   R6                      ; add + dec + jnz = 4cc before the next operand
+            jnz     macLoop
+
+            mov.w   &RESLO, 0(R14)          ; Q31 result, low word first
+            mov.w   &RESHI, 2(R14)
+            add.w   #4,     R14
+
+            incd.w  R7                      ; next column
+            dec.w   R8
+            jnz     colLoop
+
+            add.w   R10,    R12             ; next row of mtx1
+            dec.w   R9
+            jnz     rowLoop
+
+            pop     &MPY32CTL0
+            pop     R10
+            pop     R9
+            pop     R8
+            pop     R7
+            pop     R6
+            pop     R5
+            pop     R4
+            ret
+            .end
@@ -0,0 +1,515 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab04.cpp
+ * Description:     Benchmark bindings for the lab04 string filters. Both are
+ *              written inline in main, so the target runs them from the loop
+ *              label to the label after it with the registers main would have
+ *              set up:
+ *              - lab4_p1 (alnum_filter): copy alphanumerics into newStr, count
+ *                the rest (R6, 8-bit), for .. output
+ *              - lab4_p3 (digit_rotate): '9' -> '0', other digits + 1, in place,
+ *                now Translate (lab4_p3/Translate.asm) with the lab's digitRotate
+ *                map, run from its entry with R12 = buf, R13 = length, R14 = map
+ *              AlnumFilter (lab4_p1/AlnumFilter.asm) is the C-callable,
+ *              table-driven filter for buffers of any length; it runs from
+ *              its entry with the buffer in R12-R14 and returns the count.
+ *              AlnumStream is the host alnumFilter() of textfilter.h from 1 KB
+ *              to 16 MB, with the kernel picked at run time and forced to
+ *              SSE4.2 and to the byte-at-a-time scalar loop for comparison.
+ *              TranslateC is the C fallback of lab4_p3/translate.c: the lab
+ *              source on the host, its byte loop written out in
+ *              bench/translate_c.asm on the target.
+ *              Evaluate (lab4_p2/Evaluate.asm) evaluates one expression of
+ *              size operands per call, from its entry with R12 = line, R13 =
+ *              length, R14 = value; RepeatMul is the "d*d" check and add.b
+ *              loop lab4_p2 had before (bench/repeat_mul.asm), run in-line
+ *              from main to output with R4 = the string
+ *
+ * Distributions:   text (printable ASCII), alnum (letters and digits only),
+ *                  special (no alphanumerics) / digits (digits only),
+ *                  unaligned (text at an odd address, for the translators) /
+ *                  digit (single digits and '*', for the expressions), mixed
+ *                  (1..999, + - * /, unary minus, parentheses, blanks)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+#include "hostsim/textfilter.h"
+
+#include <algorithm>
+
+
+
+//// Lab Source
+#define TRANSLATE_NO_ASM
+namespace lab4_p3
+{
+#include "../../lab04/lab4_p3/translate.c"
+}
+#undef TRANSLATE_NO_ASM
+
+
+
+//// Kernels
+namespace
+{
+
+using namespace hostsim;
+
+bool alnum(char c)
+{
+    return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+}
+
+
+void generate(Input& in, Rng& rng)
+{
+    in.text.clear();
+    while (in.text.size() < in.n)
+    {
+        char c = (char)rng.range(0x20, 0x7E);       // printable: the filters compare signed bytes
+        bool keep = in.dist == "text" || in.dist == "unaligned" || (in.dist == "alnum" && alnum(c)) || (in.dist == "special" && !alnum(c)) ||
+                    (in.dist == "digits" && c >= '0' && c <= '9');
+        if (keep)
+        {
+            in.text += c;
+        }
+    }
+}
+
+
+// lab4_p1: R4 = string, R5 = newStr, R6 = specCount, R8 = byte flag
+void setupFilter(Target& t, const Input& in)
+{
+    uint32_t s = t.string(in.text);
+    t.out = t.alloc(in.n + 2);
+    t.cpu().setReg(4, s);
+    t.cpu().setReg(5, t.out);
+    t.cpu().setReg(6, 0);
+    t.cpu().setReg(8, 1);
+}
+
+
+uint64_t resultFilter(Target& t, const Input& in)
+{
+    (void)in;
+    std::string kept;
+    for (uint32_t a = t.out; t.peek8(a); a++)
+    {
+        kept += (char)t.peek8(a);
+    }
+    uint8_t count = (uint8_t)t.cpu().reg(6);
+    return checksum(kept.data(), kept.size(), count + 1);
+}
+
+
+uint64_t hostFilter(const Input& in)
+{
+    std::string kept;
+    uint8_t count = 0;
+    for (char c : in.text)
+    {
+        if (alnum(c))
+        {
+            kept += c;
+        }
+        else
+        {
+            count++;
+        }
+    }
+    return checksum(kept.data(), kept.size(), count + 1);
+}
+
+
+// AlnumFilter: R12 = src, R13 = length, R14 = dst; returns the special count
+struct ClassTable
+{
+    uint8_t cls[256];
+
+    ClassTable() : cls()
+    {
+        for (int c = 1; c < 256; c++)
+        {
+            cls[c] = alnum((char)c) ? 0x08 : 0x10;  // CC_ALNUM, CC_SPECIAL
+        }
+    }
+};
+
+const ClassTable classTable;
+
+
+void setupTable(Target& t, const Input& in)
+{
+    uint32_t s = t.string(in.text);
+    t.out = t.alloc(in.n + 1);
+    t.cpu().setReg(12, s);
+    t.cpu().setReg(13, (uint16_t)in.n);
+    t.cpu().setReg(14, t.out);
+}
+
+
+uint64_t resultTable(Target& t, const Input& in)
+{
+    (void)in;
+    std::string kept;
+    for (uint32_t a = t.out; t.peek8(a); a++)
+    {
+        kept += (char)t.peek8(a);
+    }
+    return checksum(kept.data(), kept.size(), (uint16_t)t.cpu().reg(12) + 1);
+}
+
+
+uint64_t hostTable(const Input& in)
+/* the routine's loop: one table load and test per byte, a 16-bit count
+ */
+{
+    std::string kept;
+    uint16_t count = 0;
+    for (char c : in.text)
+    {
+        if (classTable.cls[(uint8_t)c] & 0x08)
+        {
+            kept += c;
+        }
+        else
+        {
+            count++;
+        }
+    }
+    return checksum(kept.data(), kept.size(), count + 1);
+}
+
+
+// AlnumStream: the host filter of textfilter.h over long text, in place of the
+// lab's 30-byte string; the byte-at-a-time AlnumStreamScalar is the reference
+// (all three return the same checksum)
+template <FilterIsa Isa>
+uint64_t hostStream(const Input& in)
+{
+    static thread_local std::string kept;
+    kept.resize(in.n);
+    setFilterIsa(Isa);
+    size_t n = alnumFilter(in.text.data(), in.n, &kept[0]);
+
+    // a byte-serial checksum of megabytes would be most of the time measured:
+    // the count and 64 bytes every 64 KB stand for the output
+    uint64_t sum = checksum(&n, sizeof(n));
+    for (size_t i = 0; i < n; i += 65536)
+    {
+        sum = checksum(kept.data() + i, std::min<size_t>(64, n - i), sum);
+    }
+    return sum;
+}
+
+
+// lab4_p3: R12 = buf, R13 = length, R14 = map
+struct RotateMap
+{
+    unsigned char map[256];
+
+    RotateMap() : map()
+    {
+        for (int c = 0; c < 256; c++)
+        {
+            map[c] = (unsigned char)(c >= '0' && c <= '8' ? c + 1 : c == '9' ? '0' : c);
+        }
+    }
+};
+
+const RotateMap rotateMap;
+
+
+template <bool LabMap>
+void setupRotate(Target& t, const Input& in)
+{
+    const bool odd = in.dist == "unaligned";
+    t.out = t.string((odd ? " " : "") + in.text) + odd;
+    t.cpu().setReg(12, t.out);
+    t.cpu().setReg(13, (uint16_t)in.n);
+    if (LabMap)
+    {
+        t.cpu().setReg(14, t.label("digitRotate"));
+    }
+    else
+    {
+        uint32_t map = t.alloc(256);
+        for (int c = 0; c < 256; c++)
+        {
+            t.poke8(map + (uint32_t)c, rotateMap.map[c]);
+        }
+        t.cpu().setReg(14, map);
+    }
+}
+
+
+uint64_t resultRotate(Target& t, const Input& in)
+{
+    std::string s;
+    for (size_t i = 0; i < in.n; i++)
+    {
+        s += (char)t.peek8(t.out + (uint32_t)i);
+    }
+    return checksum(s.data(), s.size());
+}
+
+
+uint64_t hostRotate(const Input& in)
+{
+    std::string s = in.text;
+    for (char& c : s)
+    {
+        if (c >= '0' && c <= '9')
+        {
+            c = c == '9' ? '0' : c + 1;
+        }
+    }
+    return checksum(s.data(), s.size());
+}
+
+
+uint64_t hostTranslateC(const Input& in)
+{
+    static thread_local std::string s;
+    s = in.text;
+    lab4_p3::TranslateC(&s[0], (unsigned int)in.n, rotateMap.map);
+    return checksum(s.data(), s.size());
+}
+
+
+// lab4_p2: expressions of in.n operands
+void generateExpr(Input& in, Rng& rng)
+{
+    static const char ops[] = "+-*/";
+    const bool mixed = in.dist == "mixed";
+    int open = 0;
+
+    in.text.clear();
+    for (size_t i = 0; i < in.n; i++)
+    {
+        if (mixed && open < 4 && i + 1 < in.n && rng.range(0, 3) == 0)
+        {
+            in.text += '(';
+            open++;
+        }
+        if (mixed && rng.range(0, 4) == 0)
+        {
+            in.text += '-';
+        }
+        in.text += std::to_string(mixed ? rng.range(1, 999) : rng.range(0, 9));
+        if (open && rng.range(0, 2) == 0)
+        {
+            in.text += ')';
+            open--;
+        }
+        if (i + 1 < in.n)
+        {
+            if (mixed && rng.range(0, 3) == 0)
+            {
+                in.text += ' ';
+            }
+            in.text += mixed ? ops[rng.range(0, 3)] : '*';
+        }
+    }
+    in.text.append((size_t)open, ')');
+    in.elements = 1;
+}
+
+
+uint64_t exprSum(uint16_t status, int16_t value)
+{
+    uint64_t h = checksum(&status, sizeof(status));
+    return status ? h : checksum(&value, sizeof(value), h);
+}
+
+
+void setupEval(Target& t, const Input& in)
+{
+    uint32_t s = t.string(in.text);
+    t.out = t.alloc(2);
+    t.cpu().setReg(12, s);
+    t.cpu().setReg(13, (uint16_t)in.text.size());
+    t.cpu().setReg(14, t.out);
+}
+
+
+uint64_t resultEval(Target& t, const Input& in)
+{
+    (void)in;
+    return exprSum((uint16_t)t.cpu().reg(12), (int16_t)t.peek16(t.out));
+}
+
+
+uint64_t hostEval(const Input& in)
+/* Evaluate.asm's shunting yard: operator entries are precedence << 8 | char,
+ * 16 per stack with the sentinel, int16_t arithmetic
+ */
+{
+    enum : unsigned { SENTINEL = 0x0000, OPEN = 0x0028, NEG = 0x0300, STACK = 16 };
+    int16_t values[STACK];
+    unsigned ops[STACK] = {SENTINEL};
+    size_t nv = 0, no = 1;
+    bool operand = false;
+
+    auto reduce = [&](unsigned least) {
+        while (ops[no - 1] >= least)
+        {
+            const unsigned op = ops[--no];
+            if (op >= NEG)
+            {
+                values[nv - 1] = (int16_t)-values[nv - 1];
+                continue;
+            }
+            const int16_t b = values[--nv];
+            int16_t& a = values[nv - 1];
+            switch (op & 0xFF)
+            {
+                case '+': a = (int16_t)(a + b); break;
+                case '-': a = (int16_t)(a - b); break;
+                case '*': a = (int16_t)(a * b); break;
+                default:
+                    if (b == 0)
+                    {
+                        return false;
+                    }
+                    a = (int16_t)(uint16_t)((int32_t)a / b);
+                    break;
+            }
+        }
+        return true;
+    };
+
+    const std::string& s = in.text;
+    for (size_t i = 0; i < s.size() && s[i] && s[i] != '\r' && s[i] != '\n'; i++)
+    {
+        const char c = s[i];
+        unsigned push = 0;
+        if (c == ' ')
+        {
+            continue;
+        }
+        if (!operand)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                uint16_t v = 0;
+                for (; i < s.size() && s[i] >= '0' && s[i] <= '9'; i++)
+                {
+                    v = (uint16_t)(v * 10 + (s[i] - '0'));
+                }
+                i--;
+                values[nv++] = (int16_t)v;
+                operand = true;
+                continue;
+            }
+            if (c == '+')
+            {
+                continue;
+            }
+            if (c != '-' && c != '(')
+            {
+                return exprSum(1, 0);
+            }
+            push = c == '-' ? NEG : OPEN;
+        }
+        else if (c == ')')
+        {
+            if (!reduce(0x100))
+            {
+                return exprSum(2, 0);
+            }
+            if (ops[no - 1] != OPEN)
+            {
+                return exprSum(1, 0);
+            }
+            no--;
+            continue;
+        }
+        else
+        {
+            const unsigned prec = c == '+' || c == '-' ? 1 : c == '*' || c == '/' ? 2 : 0;
+            if (!prec)
+            {
+                return exprSum(1, 0);
+            }
+            if (!reduce(prec << 8))
+            {
+                return exprSum(2, 0);
+            }
+            push = prec << 8 | (unsigned char)c;
+        }
+        if (no == STACK)
+        {
+            return exprSum(3, 0);
+        }
+        ops[no++] = push;
+        operand = false;
+    }
+
+    if (!operand)
+    {
+        return exprSum(1, 0);
+    }
+    if (!reduce(0x100))
+    {
+        return exprSum(2, 0);
+    }
+    return ops[no - 1] == SENTINEL ? exprSum(0, values[nv - 1]) : exprSum(1, 0);
+}
+
+
+// RepeatMul: R4 = string, product in R9 (8-bit)
+void setupRepeat(Target& t, const Input& in)
+{
+    t.cpu().setReg(4, t.string(in.text));
+}
+
+
+uint64_t resultRepeat(Target& t, const Input& in)
+{
+    (void)in;
+    return exprSum(0, (int16_t)(t.cpu().reg(9) & 0xFF));
+}
+
+
+uint64_t hostRepeat(const Input& in)
+{
+    const std::string& s = in.text;
+    const bool ok = s.size() == 3 && s[0] >= '0' && s[0] <= '9' && s[1] == '*' && s[2] >= '0' && s[2] <= '9';
+    return exprSum(0, ok ? (int16_t)((s[0] - '0') * (s[2] - '0')) : 0xFF);
+}
+
+
+const TargetSpec filter{Device::F5529, {"lab04/lab4_p1/main.asm", "lab04/lab4_p1/AlnumFilter.asm"}, "for", "output",
+                        setupFilter, resultFilter};
+const TargetSpec table{Device::F5529, {"lab04/lab4_p1/AlnumFilter.asm"}, "AlnumFilter", nullptr, setupTable, resultTable};
+const TargetSpec rotate{Device::F5529, {"lab04/lab4_p3/main.asm", "lab04/lab4_p3/Translate.asm"}, "Translate", nullptr,
+                        setupRotate<true>, resultRotate};
+const TargetSpec evaluate{Device::F5529, {"lab04/lab4_p2/Evaluate.asm"}, "Evaluate", nullptr, setupEval, resultEval};
+const TargetSpec repeat{Device::F5529, {"hostsim/bench/repeat_mul.asm"}, "main", "output", setupRepeat, resultRepeat};
+const TargetSpec rotateC{Device::F5529, {"hostsim/bench/translate_c.asm"}, "TranslateC", nullptr, setupRotate<false>,
+                         resultRotate};
+
+}   // namespace
+
+HOSTSIM_KERNEL(alnum_filter, {"alnum_filter", "lab04/lab4_p1/main.asm", {32, 256, 1024}, {"text", "alnum", "special"},
+                              generate, hostFilter, &filter});
+HOSTSIM_KERNEL(alnum_table, {"AlnumFilter", "lab04/lab4_p1/AlnumFilter.asm", {32, 256, 1024, 2048},
+                             {"text", "alnum", "special"}, generate, hostTable, &table});
+HOSTSIM_KERNEL(alnum_stream, {"AlnumStream", "hostsim/src/textfilter.cpp", {1024, 65536, 1048576, 16777216},
+                              {"text", "alnum", "special"}, generate, hostStream<FilterIsa::Auto>, nullptr, true});
+HOSTSIM_KERNEL(alnum_stream_sse, {"AlnumStreamSse", "hostsim/src/textfilter.cpp", {1024, 65536, 1048576, 16777216},
+                                  {"text", "alnum", "special"}, generate, hostStream<FilterIsa::Sse>, nullptr, true});
+HOSTSIM_KERNEL(alnum_stream_scalar, {"AlnumStreamScalar", "hostsim/src/textfilter.cpp", {1024, 65536, 1048576, 16777216},
+                                     {"text", "alnum", "special"}, generate, hostStream<FilterIsa::Scalar>, nullptr, true});
+HOSTSIM_KERNEL(digit_rotate, {"digit_rotate", "lab04/lab4_p3/main.asm", {32, 256, 1024}, {"text", "digits", "unaligned"},
+                              generate, hostRotate, &rotate});
+HOSTSIM_KERNEL(translate_c, {"TranslateC", "lab04/lab4_p3/translate.c", {32, 256, 1024}, {"text", "digits", "unaligned"},
+                             generate, hostTranslateC, &rotateC});
+HOSTSIM_KERNEL(evaluate, {"Evaluate", "lab04/lab4_p2/Evaluate.asm", {2, 4, 8, 16}, {"digit", "mixed"}, generateExpr,
+                          hostEval, &evaluate});
+HOSTSIM_KERNEL(repeat_mul, {"RepeatMul", "lab04/lab4_p2/main.asm", {2}, {"digit"}, generateExpr, hostRepeat, &repeat});
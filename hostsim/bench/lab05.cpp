@@ -0,0 +1,443 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab05.cpp
+ * Description:     Benchmark bindings for the lab05 math routines: SW_dot and
+ *              HW_dot (lab5_bonus), SW_linear and HW_linear (lab5_main). The
+ *              target runs the routines with their stack calling convention,
+ *              and the _eabi versions with the arguments in R12-R15 (the
+ *              linear output array on the stack, the dot product returned in
+ *              R12); size 0 is the call overhead alone. HW_linear_block is the
+ *              in-place, unrolled, saturating kernel. HW_dot40/HW_dot32/
+ *              HW_dotQ15 are the exact, 32-bit saturated and Q15 dot products
+ *              up to 4096 elements, with the vectors in FLASH. HW_dot_dma is
+ *              the 32-bit dot product with DMA0/DMA1 feeding the MPY32 while
+ *              the CPU sleeps, and HW_fir/HW_fir_dma a 16-tap Q15 FIR filter
+ *              (size: outputs) on the CPU and by DMA, for the CPU-busy cycles
+ *              and energy columns. The host runs a port
+ *              that does the same 16-bit arithmetic (the shift-and-add ports
+ *              loop over the multiplier's low 8 bits and correct with bit 8, as
+ *              the assembly does)
+ *
+ * Distributions:   uniform (elements -128..127), small (elements 0..15),
+ *                  adc (x 0..4095, m -64..64: HW_linear_block saturates),
+ *                  full (elements -32768..32767) and max (all -32768), for the
+ *                  wide dot products; q15 (x full range, h in -1/16..1/16) and
+ *                  max (all -32768: every output saturates) for the filters
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+
+#include <algorithm>
+
+
+
+//// Kernels
+namespace
+{
+
+using namespace hostsim;
+
+void generate(Input& in, Rng& rng)
+{
+    const bool adc = in.dist == "adc";             // 12-bit samples, products past 16 bits
+    int32_t lo = in.dist == "small" ? 0 : adc ? -64 : -128;
+    int32_t hi = in.dist == "small" ? 15 : adc ? 64 : 127;
+
+    in.a.resize(in.n);
+    in.b.resize(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        in.a[i] = adc ? rng.range(0, 4095) : rng.range(lo, hi);
+        in.b[i] = rng.range(lo, hi);
+        if (in.dist == "full")                      // the 32-bit sum wraps
+        {
+            in.a[i] = rng.range(-32768, 32767);
+            in.b[i] = rng.range(-32768, 32767);
+        }
+        else if (in.dist == "max")                  // -8000h * -8000h: every product 2^30
+        {
+            in.a[i] = in.b[i] = -32768;
+        }
+    }
+    in.x = rng.range(lo, hi);                       // slope
+    in.y = rng.range(-1000, 1000);                  // constant
+    in.elements = in.n ? in.n : 1;                  // size 0: the call alone
+}
+
+
+constexpr size_t FIR_TAPS = 16;
+
+
+void generateFir(Input& in, Rng& rng)
+/* a = x (outputs + FIR_TAPS - 1 samples), b = h
+ */
+{
+    const bool max = in.dist == "max";
+    in.a.resize(in.n + FIR_TAPS - 1);
+    in.b.resize(FIR_TAPS);
+    for (auto& x : in.a)
+    {
+        x = max ? -32768 : rng.range(-32768, 32767);
+    }
+    for (auto& h : in.b)
+    {
+        h = max ? -32768 : rng.range(-32768 / (int32_t)FIR_TAPS, 32767 / (int32_t)FIR_TAPS);
+    }
+    in.elements = in.n ? in.n * FIR_TAPS : 1;      // one MAC per element
+}
+
+
+uint16_t shiftAdd(uint16_t m, uint16_t x)
+/* m * x the way SW_dot/SW_linear compute it
+ */
+{
+    uint16_t r = 0;
+    for (int bit = 0; bit < 8; bit++)
+    {
+        if (x & 1)
+        {
+            r += m;
+        }
+        m <<= 1;
+        x = (uint16_t)((int16_t)x >> 1);
+    }
+    if (x & 1)
+    {
+        r -= m;
+    }
+    return r;
+}
+
+
+// dot products: push #arr1, push #arr2, push length, push #result, call
+void setupDot(Target& t, const Input& in)
+{
+    uint32_t a = t.words(in.a), b = t.words(in.b), r = t.alloc(2);
+    t.cpu().push(a);
+    t.cpu().push(b);
+    t.cpu().push((uint16_t)in.n);
+    t.cpu().push(r);
+    t.out = r;
+}
+
+
+uint64_t resultDot(Target& t, const Input& in)
+{
+    (void)in;
+    uint16_t r = t.peek16(t.out);
+    return checksum(&r, sizeof(r));
+}
+
+
+// dot products, EABI: R12 = arr1, R13 = arr2, R14 = length, result in R12
+void setupDotEabi(Target& t, const Input& in)
+{
+    t.cpu().setReg(12, t.words(in.a));
+    t.cpu().setReg(13, t.words(in.b));
+    t.cpu().setReg(14, (uint16_t)in.n);
+}
+
+
+uint64_t resultDotEabi(Target& t, const Input& in)
+{
+    (void)in;
+    uint16_t r = (uint16_t)t.cpu().reg(12);
+    return checksum(&r, sizeof(r));
+}
+
+
+// wide dot products: the vectors in FLASH (two of 4096 words do not fit in RAM)
+void setupWide(Target& t, const Input& in)
+{
+    t.cpu().setReg(12, t.constWords(in.a));
+    t.cpu().setReg(13, t.constWords(in.b));
+    t.cpu().setReg(14, (uint16_t)in.n);
+}
+
+
+// FIR filters: R12 = x, R13 = h, R14 = y, R15 = taps, outputs on the stack
+void setupFir(Target& t, const Input& in)
+{
+    t.out = t.alloc(2 * in.n);
+    t.cpu().setReg(12, t.words(in.a));
+    t.cpu().setReg(13, t.words(in.b));
+    t.cpu().setReg(14, t.out);
+    t.cpu().setReg(15, FIR_TAPS);
+    t.cpu().push((uint16_t)in.n);
+}
+
+
+uint64_t resultDot40(Target& t, const Input& in)
+{
+    (void)in;
+    int64_t r = 0;
+    for (int i = 3; i >= 0; i--)
+    {
+        r = (int64_t)((uint64_t)r << 16 | (uint16_t)t.cpu().reg(12 + i));
+    }
+    return checksum(&r, sizeof(r));
+}
+
+
+uint64_t resultDot32(Target& t, const Input& in)
+{
+    (void)in;
+    int32_t r = (int32_t)((uint32_t)(uint16_t)t.cpu().reg(13) << 16 | (uint16_t)t.cpu().reg(12));
+    return checksum(&r, sizeof(r));
+}
+
+
+int64_t exactDot(const Input& in)
+{
+    int64_t sum = 0;
+    for (size_t i = 0; i < in.n; i++)
+    {
+        sum += (int16_t)in.a[i] * (int16_t)in.b[i];
+    }
+    return sum;
+}
+
+
+uint64_t hostDot40(const Input& in)
+{
+    int64_t r = exactDot(in);
+    return checksum(&r, sizeof(r));
+}
+
+
+uint64_t hostDot32(const Input& in)
+{
+    int32_t r = (int32_t)std::min<int64_t>(std::max<int64_t>(exactDot(in), INT32_MIN), INT32_MAX);
+    return checksum(&r, sizeof(r));
+}
+
+
+uint64_t hostDotQ15(const Input& in)
+{
+    uint16_t r = (uint16_t)(int16_t)std::min<int64_t>(std::max<int64_t>(exactDot(in) >> 15, -32768), 32767);
+    return checksum(&r, sizeof(r));
+}
+
+
+uint64_t hostDotDma(const Input& in)
+/* HW_dot_dma returns RESHI:RESLO: the sum modulo 2^32
+ */
+{
+    int32_t r = (int32_t)(uint32_t)exactDot(in);
+    return checksum(&r, sizeof(r));
+}
+
+
+uint64_t hostFir(const Input& in)
+/* the MACS chain as the MPY32 runs it: a 32-bit accumulator, overflow flagged
+ * by the last accumulation only, then MPYSAT/MPYFRAC applied to RESHI:RESLO on
+ * the read
+ */
+{
+    std::vector<uint16_t> y(in.n);
+    for (size_t k = 0; k < in.n; k++)
+    {
+        uint32_t acc = 0;
+        bool overflow = false, negative = false;
+        for (size_t j = 0; j < FIR_TAPS; j++)
+        {
+            int64_t sum = (int64_t)(int32_t)acc + (int16_t)in.a[k + j] * (int16_t)in.b[j];
+            acc = (uint32_t)sum;
+            negative = sum < 0;
+            overflow = negative != ((acc >> 31) != 0);
+        }
+        if (overflow)
+        {
+            acc = negative ? 0x80000000u : 0x7FFFFFFFu;
+        }
+        if ((acc >> 31) != ((acc >> 30) & 1))
+        {
+            acc = (acc >> 31) ? 0x80000000u : 0x7FFFFFFFu;
+        }
+        else
+        {
+            acc <<= 1;
+        }
+        y[k] = (uint16_t)(acc >> 16);
+    }
+    return checksum(y.data(), 2 * y.size());
+}
+
+
+uint64_t hostSwDot(const Input& in)
+{
+    uint16_t r = 0;
+    for (size_t i = 0; i < in.n; i++)
+    {
+        r += shiftAdd((uint16_t)in.a[i], (uint16_t)in.b[i]);
+    }
+    return checksum(&r, sizeof(r));
+}
+
+
+uint64_t hostHwDot(const Input& in)
+{
+    int32_t sum = 0;
+    for (size_t i = 0; i < in.n; i++)
+    {
+        sum += (int16_t)in.a[i] * (int16_t)in.b[i];
+    }
+    uint16_t r = (uint16_t)sum;                     // HW_dot stores RESLO only
+    return checksum(&r, sizeof(r));
+}
+
+
+// linear: push #arrIn, push length, push slope, push constant, push #arrOut, call
+void setupLinear(Target& t, const Input& in)
+{
+    uint32_t x = t.words(in.a), y = t.alloc(2 * in.n);
+    t.cpu().push(x);
+    t.cpu().push((uint16_t)in.n);
+    t.cpu().push((uint16_t)in.x);
+    t.cpu().push((uint16_t)in.y);
+    t.cpu().push(y);
+    t.out = y;
+}
+
+
+// linear, EABI: R12 = arrIn, R13 = length, R14 = slope, R15 = constant, push #arrOut, call
+void setupLinearEabi(Target& t, const Input& in)
+{
+    uint32_t y = t.alloc(2 * in.n);
+    t.cpu().setReg(12, t.words(in.a));
+    t.cpu().setReg(13, (uint16_t)in.n);
+    t.cpu().setReg(14, (uint16_t)in.x);
+    t.cpu().setReg(15, (uint16_t)in.y);
+    t.cpu().push(y);
+    t.out = y;
+}
+
+
+// linear in place: R12 = buf, R13 = length, R14 = slope, R15 = constant
+void setupBlock(Target& t, const Input& in)
+{
+    t.out = t.words(in.a);
+    t.cpu().setReg(12, t.out);
+    t.cpu().setReg(13, (uint16_t)in.n);
+    t.cpu().setReg(14, (uint16_t)in.x);
+    t.cpu().setReg(15, (uint16_t)in.y);
+}
+
+
+uint64_t resultLinear(Target& t, const Input& in)
+{
+    std::vector<uint16_t> y(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        y[i] = t.peek16(t.out + 2 * (uint32_t)i);
+    }
+    return checksum(y.data(), 2 * y.size());
+}
+
+
+uint64_t hostSwLinear(const Input& in)
+{
+    std::vector<uint16_t> y(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        y[i] = (uint16_t)(shiftAdd((uint16_t)in.x, (uint16_t)in.a[i]) + in.y);
+    }
+    return checksum(y.data(), 2 * y.size());
+}
+
+
+uint64_t hostHwLinear(const Input& in)
+{
+    std::vector<uint16_t> y(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        y[i] = (uint16_t)((int16_t)in.x * (int16_t)in.a[i] + in.y);
+    }
+    return checksum(y.data(), 2 * y.size());
+}
+
+
+uint64_t hostHwBlock(const Input& in)
+/* HW_linear_block: the 32-bit m * x + C saturated to 16 bits
+ */
+{
+    std::vector<uint16_t> y(in.n);
+    for (size_t i = 0; i < in.n; i++)
+    {
+        int32_t v = (int16_t)in.x * (int16_t)in.a[i] + (int16_t)in.y;
+        y[i] = (uint16_t)(int16_t)std::min<int32_t>(std::max<int32_t>(v, -32768), 32767);
+    }
+    return checksum(y.data(), 2 * y.size());
+}
+
+
+const TargetSpec swDot{Device::F5529,
+                       {"lab05/lab5_bonus/lab5_bonus.asm", "lab05/lab5_bonus/SW_dot.asm", "lab05/lab5_bonus/HW_dot.asm"},
+                       "SW_dot", nullptr, setupDot, resultDot};
+const TargetSpec hwDot{Device::F5529,
+                       {"lab05/lab5_bonus/lab5_bonus.asm", "lab05/lab5_bonus/SW_dot.asm", "lab05/lab5_bonus/HW_dot.asm"},
+                       "HW_dot", nullptr, setupDot, resultDot};
+const TargetSpec swLinear{Device::F5529,
+                          {"lab05/lab5_main/lab5_main.asm", "lab05/lab5_main/SW_linear.asm",
+                           "lab05/lab5_main/HW_linear.asm"},
+                          "SW_linear", nullptr, setupLinear, resultLinear};
+const TargetSpec hwLinear{Device::F5529,
+                          {"lab05/lab5_main/lab5_main.asm", "lab05/lab5_main/SW_linear.asm",
+                           "lab05/lab5_main/HW_linear.asm"},
+                          "HW_linear", nullptr, setupLinear, resultLinear};
+const TargetSpec swDotEabi{Device::F5529, {"lab05/lab5_bonus/SW_dot.asm"}, "SW_dot_eabi", nullptr, setupDotEabi,
+                           resultDotEabi};
+const TargetSpec hwDotEabi{Device::F5529, {"lab05/lab5_bonus/HW_dot.asm"}, "HW_dot_eabi", nullptr, setupDotEabi,
+                           resultDotEabi};
+const TargetSpec swLinearEabi{Device::F5529, {"lab05/lab5_main/SW_linear.asm"}, "SW_linear_eabi", nullptr,
+                              setupLinearEabi, resultLinear};
+const TargetSpec hwLinearEabi{Device::F5529, {"lab05/lab5_main/HW_linear.asm"}, "HW_linear_eabi", nullptr,
+                              setupLinearEabi, resultLinear};
+const TargetSpec hwDot40{Device::F5529, {"lab05/lab5_bonus/HW_dot.asm"}, "HW_dot40", nullptr, setupWide, resultDot40};
+const TargetSpec hwDot32{Device::F5529, {"lab05/lab5_bonus/HW_dot.asm"}, "HW_dot32", nullptr, setupWide, resultDot32};
+const TargetSpec hwDotQ15{Device::F5529, {"lab05/lab5_bonus/HW_dot.asm"}, "HW_dotQ15", nullptr, setupWide,
+                          resultDotEabi};
+const TargetSpec hwDotDma{Device::F5529, {"lab05/lab5_bonus/HW_dot_dma.asm"}, "HW_dot_dma", nullptr, setupWide,
+                          resultDot32};
+const TargetSpec hwFir{Device::F5529, {"lab05/lab5_bonus/HW_dot.asm"}, "HW_fir", nullptr, setupFir, resultLinear};
+const TargetSpec hwFirDma{Device::F5529, {"lab05/lab5_bonus/HW_dot_dma.asm"}, "HW_fir_dma", nullptr, setupFir,
+                          resultLinear};
+const TargetSpec hwBlock{Device::F5529, {"lab05/lab5_main/HW_linear.asm"}, "HW_linear_block", nullptr, setupBlock,
+                         resultLinear};
+
+}   // namespace
+
+HOSTSIM_KERNEL(sw_dot, {"SW_dot", "lab05/lab5_bonus/SW_dot.asm", {0, 8, 64, 512}, {"uniform", "small"},
+                        generate, hostSwDot, &swDot});
+HOSTSIM_KERNEL(hw_dot, {"HW_dot", "lab05/lab5_bonus/HW_dot.asm", {0, 8, 64, 512}, {"uniform", "small"},
+                        generate, hostHwDot, &hwDot});
+HOSTSIM_KERNEL(sw_linear, {"SW_linear", "lab05/lab5_main/SW_linear.asm", {0, 8, 64, 512}, {"uniform", "small"},
+                           generate, hostSwLinear, &swLinear});
+HOSTSIM_KERNEL(hw_linear, {"HW_linear", "lab05/lab5_main/HW_linear.asm", {0, 8, 64, 512}, {"uniform", "small"},
+                           generate, hostHwLinear, &hwLinear});
+HOSTSIM_KERNEL(sw_dot_eabi, {"SW_dot_eabi", "lab05/lab5_bonus/SW_dot.asm", {0, 8, 64, 512}, {"uniform", "small"},
+                             generate, hostSwDot, &swDotEabi});
+HOSTSIM_KERNEL(hw_dot_eabi, {"HW_dot_eabi", "lab05/lab5_bonus/HW_dot.asm", {0, 8, 64, 512}, {"uniform", "small"},
+                             generate, hostHwDot, &hwDotEabi});
+HOSTSIM_KERNEL(sw_linear_eabi, {"SW_linear_eabi", "lab05/lab5_main/SW_linear.asm", {0, 8, 64, 512},
+                                {"uniform", "small"}, generate, hostSwLinear, &swLinearEabi});
+HOSTSIM_KERNEL(hw_linear_eabi, {"HW_linear_eabi", "lab05/lab5_main/HW_linear.asm", {0, 8, 64, 512},
+                                {"uniform", "small"}, generate, hostHwLinear, &hwLinearEabi});
+HOSTSIM_KERNEL(hw_linear_block, {"HW_linear_block", "lab05/lab5_main/HW_linear.asm", {0, 8, 64, 512, 2048},
+                                 {"uniform", "small", "adc"}, generate, hostHwBlock, &hwBlock});
+HOSTSIM_KERNEL(hw_dot40, {"HW_dot40", "lab05/lab5_bonus/HW_dot.asm", {0, 8, 64, 512, 4096}, {"uniform", "full", "max"},
+                          generate, hostDot40, &hwDot40});
+HOSTSIM_KERNEL(hw_dot32, {"HW_dot32", "lab05/lab5_bonus/HW_dot.asm", {0, 8, 64, 512, 4096}, {"uniform", "full", "max"},
+                          generate, hostDot32, &hwDot32});
+HOSTSIM_KERNEL(hw_dot_q15, {"HW_dotQ15", "lab05/lab5_bonus/HW_dot.asm", {0, 8, 64, 512, 4096},
+                            {"uniform", "full", "max"}, generate, hostDotQ15, &hwDotQ15});
+HOSTSIM_KERNEL(hw_dot_dma, {"HW_dot_dma", "lab05/lab5_bonus/HW_dot_dma.asm", {0, 8, 64, 512, 4096},
+                            {"uniform", "full"}, generate, hostDotDma, &hwDotDma});
+HOSTSIM_KERNEL(hw_fir, {"HW_fir", "lab05/lab5_bonus/HW_dot.asm", {0, 1, 8, 64, 256}, {"q15", "max"}, generateFir,
+                        hostFir, &hwFir});
+HOSTSIM_KERNEL(hw_fir_dma, {"HW_fir_dma", "lab05/lab5_bonus/HW_dot_dma.asm", {0, 1, 8, 64, 256}, {"q15", "max"},
+                            generateFir, hostFir, &hwFirDma});
@@ -0,0 +1,88 @@
+;-------------------------------------------------------------------------------
+; File:         repeat_mul.asm
+; Description:  The "d*d" multiply lab04/lab4_p2/main.asm ran before Evaluate,
+;               kept for the benchmark: string check, then the product by
+;               repeated add.b. Runs in-line from main to output with R4 = the
+;               string; the product (0xFF for a rejected string) is in R9
+; Author(s):    Polickoski, Nick
+; Date:         October 17, 2026
+;-------------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Main loop body
+;-------------------------------------------------------------------------------
+main		mov.b	#0xFF,		R9			; initialize total = 0xFF
+
+
+; Taking/Validating Values from String
+			mov.b	@R4,		R5			; takes contents of 'a'
+
+			; if (a < 0x30)					; num. chars 0-9
+			cmp.b 	#30h, 		R5			; ASCII: 0x30 - 0x39
+			jl 		output
+
+			; if (a >= 0x3A)
+			cmp.b 	#0x3A,		R5
+			jge		output
+
+			inc.w	R4						; increment to 2nd byte
+			mov.b	@R4,		R6			; takes in '*'
+
+			; if (R6 != '*')
+			cmp		#0x2A,		R6
+			jne		output
+
+			inc.w	R4						; increment to 3rd byte
+			mov.b	@R4,		R6			; takes contents of 'b'
+
+
+			; if (b < 0x30)
+			cmp.b 	#30h, 		R6
+			jl 		output
+
+			; if (b >= 0x3A)
+			cmp.b 	#0x3A,		R6
+			jge		output
+
+			inc.w	R4						; increment to 4th byte
+			mov.b	@R4,		R7			; takes contents of 'NULL'
+
+			; if (R7 != NULL)
+			cmp.b	#0x00,		R7
+			jne		output
+
+
+; ASCII to int Conversion
+			sub.b	#30h,		R5			; subtracting 0x30 from ASCII .
+			sub.b	#30h,		R6			;		num value = binary rep.
+			clr		R9						; total = 0
+
+; Find Smaller Number
+			cmp.b	R5,			R6			; compares a and b
+			jn		negNum					;
+
+			; if (b > a)
+			mov.b	R5, 		R7			; iter = a
+			mov.b	R6,			R8			; base = b
+			jmp 	Multi
+
+			; else if (a >= b)
+negNum		mov.b 	R6,			R7			; iter = b
+			mov.b	R5,			R8			; base = a
+
+
+; Multiplication Loop
+Multi		cmp.b	#0h,		R7			; if (iter != 0)
+			jeq 	output
+			add.b	R8,			R9			; total += base
+			dec.b	R7						; iter--
+			jmp 	Multi
+
+
+; Output
+output		mov.b	R9,			P2OUT		; move to P2 reg.
+			nop
+			.end
@@ -0,0 +1,32 @@
+;-------------------------------------------------------------------------------
+; File:         translate_c.asm
+; Description:  TranslateC of lab04/lab4_p3/translate.c written out in assembly,
+;               so the benchmark can count the C fallback's cycles on the
+;               instruction-set model: the byte loop as the compiler emits it
+;               at -O2 (R12 = buf, R13 = length, R14 = map)
+; Author(s):    Polickoski, Nick
+; Date:         October 17, 2026
+;-------------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    TranslateC              ; byte-at-a-time translation
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutine
+;-------------------------------------------------------------------------------
+TranslateC:
+            tst.w   R13
+            jz      done
+byteLoop:
+            mov.b   @R12,   R15             ; *buf
+            add.w   R14,    R15             ; &map[*buf]
+            mov.b   @R15,   0(R12)
+            inc.w   R12
+            dec.w   R13
+            jnz     byteLoop
+done:
+            ret
+            .end
@@ -0,0 +1,178 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        bench.h
+ * Description:     Kernel benchmark suite. A kernel is one compute routine of the
+ *              labs (CalcPower, MatrixMul, SW_dot, ...) with an input generator
+ *              parameterised by size and distribution, a host implementation
+ *              (the lab C source itself, or a port of the assembly routine)
+ *              timed in ns per call, and optionally the assembly routine run
+ *              on the instruction-set model, counted in MCLK cycles per call.
+ *              Both backends return a checksum of their output, so every case
+ *              is also a cross-check of host against target. Kernels are bound
+ *              in hostsim/bench/ the same way labs are in hostsim/labs/:
+ *
+ *                  HOSTSIM_KERNEL(sw_dot, {"SW_dot", "lab05/lab5_bonus/SW_dot.asm",
+ *                                          {8, 64, 512}, {"uniform", "small"},
+ *                                          generate, host, &target});
+ *
+ * Input:       size, distribution and seed of each case
+ * Output:      host ns/call, target cycles/call and stack bytes, checksums
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_BENCH_H_
+#define HOSTSIM_BENCH_H_
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/cpu.h"
+#include "hostsim/image.h"
+#include "hostsim/machine.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace hostsim
+{
+
+//// Input
+struct Rng                          // xorshift64*: same inputs on every host and revision
+{
+    uint64_t s;
+
+    explicit Rng(uint64_t seed) : s(seed ? seed : 0x9E3779B97F4A7C15ull) {}
+    uint64_t next();
+    int32_t range(int32_t lo, int32_t hi);          // uniform in [lo, hi]
+};
+
+struct Input
+{
+    size_t n = 0;                   // size of the case (elements, bits, exponent ... per kernel)
+    std::string dist;               // distribution name
+    std::vector<int32_t> a, b;      // operand vectors
+    std::string text;               // string kernels
+    int32_t x = 0, y = 0;           // scalar operands
+    size_t elements = 0;            // work items per call, for the per-element figures (0 -> n)
+};
+
+uint64_t checksum(const void* data, size_t bytes, uint64_t seed = 0);
+/* FNV-1a over a buffer, chained through seed
+ */
+
+
+
+//// Target (instruction-set model)
+class Target;
+
+// energy proxy weights: F5529 supply current relative to active mode at the
+// same MCLK (SLAS590 typical figures, 3 V, from FLASH)
+constexpr double ENERGY_CPU = 1.0;          // CPU executing
+constexpr double ENERGY_DMA = 0.6;          // CPU stalled or off, MCLK kept for a DMA transfer
+constexpr double ENERGY_LPM = 0.3;          // LPM0: CPU and MCLK off, SMCLK/ACLK running
+
+struct TargetSpec
+{
+    Device device;
+    std::vector<std::string> files;         // .asm files of the program, relative to the repo root
+    const char* entry;                      // routine label
+    const char* stop;                       // nullptr: run until the routine returns; else until PC
+                                            // reaches this label (routines inlined in main)
+    void (*setup)(Target& t, const Input& in);      // place the input, set registers, push arguments
+    uint64_t (*result)(Target& t, const Input& in); // checksum of the output (same as the host's)
+};
+
+class Target
+/* one program assembled once, run on a fresh machine for every case
+ */
+{
+public:
+    Target(const TargetSpec& spec, const std::string& root);
+    ~Target();
+
+    void prepare();
+    /* new machine and core with the image loaded, watchdog held, SP at the top
+     * of RAM and the input area emptied
+     */
+    uint64_t run();
+    /* runs the spec's routine, returns the MCLK cycles it took (time in LPM
+     * counted in MCLK cycles too, so this is the latency)
+     */
+    uint64_t cpuCycles() const { return cpu_cycles_; }
+    /* of those, the cycles the CPU executed in: without the DMA's and LPM's
+     */
+    double energy() const { return energy_; }
+    /* energy proxy of the last run() in active-CPU cycles: each cycle weighted
+     * by the supply current of the mode it was spent in (ENERGY_* below)
+     */
+    uint32_t stackBytes() const { return stack_; }
+    /* stack the last run() used below the routine's return address (below the
+     * entry SP for routines run up to a stop label)
+     */
+
+    // input area: RAM above the program's .data/.bss, below a 256-byte stack reserve
+    uint32_t alloc(size_t bytes);
+    uint32_t words(const std::vector<int32_t>& v);              // 16-bit array, returns its address
+    uint32_t string(const std::string& s, size_t reserve = 0);  // NUL-terminated, returns its address
+    uint32_t constWords(const std::vector<int32_t>& v);
+    /* 16-bit array in FLASH above the program, as a .const table would be: for
+     * read-only inputs too long for the RAM
+     */
+
+    uint16_t peek16(uint32_t addr) const { return m_->raw16(addr); }
+    uint8_t peek8(uint32_t addr) const { return m_->raw8(addr); }
+    void poke16(uint32_t addr, uint16_t v) { m_->setRaw16(addr, v); }
+    void poke8(uint32_t addr, uint8_t v) { m_->setRaw8(addr, v); }
+
+    Cpu& cpu() { return *cpu_; }
+    Machine& machine() { return *m_; }
+    const Image& image() const { return image_; }
+    uint32_t label(const char* name) const { return image_.address(name); }
+
+    uint32_t out = 0;                       // output placed by setup(), read back by result()
+
+private:
+    const TargetSpec& spec_;
+    Image image_;
+    uint32_t heap_ = 0, heapStart_ = 0, heapEnd_ = 0;
+    uint32_t flash_ = 0, flashStart_ = 0, flashEnd_ = 0;
+    uint32_t stack_ = 0;
+    uint64_t cpu_cycles_ = 0;
+    double energy_ = 0;
+    std::unique_ptr<Machine> m_;
+    std::unique_ptr<Cpu> cpu_;
+};
+
+
+
+//// Kernel
+struct Kernel
+{
+    const char* name;
+    const char* source;                     // lab file the routine comes from
+    std::vector<size_t> sizes;              // default sizes
+    std::vector<std::string> dists;         // distributions generate() understands
+    void (*generate)(Input& in, Rng& rng);  // fills 'in' for in.n / in.dist
+    uint64_t (*host)(const Input& in);      // one call on the host, returns the output checksum
+    const TargetSpec* target;               // nullptr: host only (C routines)
+    bool stream = false;                    // elements are bytes of a stream: the table adds host GB/s
+};
+
+std::vector<Kernel>& kernels();
+/* every kernel linked into the binary, in registration order
+ */
+
+struct KernelRegistrar
+{
+    explicit KernelRegistrar(Kernel k) { kernels().push_back(std::move(k)); }
+};
+
+}   // namespace hostsim
+
+
+#define HOSTSIM_KERNEL(id, ...) static const ::hostsim::KernelRegistrar hostsimKernel_##id{::hostsim::Kernel __VA_ARGS__}
+
+#endif  // HOSTSIM_BENCH_H_
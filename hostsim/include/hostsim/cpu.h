@@ -0,0 +1,170 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        cpu.h
+ * Description:     Instruction-set model of the MSP430 / MSP430X / MSP430Xv2 cores
+ *              for the assembly labs. Fetches and executes the program image on
+ *              top of the same Machine the C labs use, so peripheral registers,
+ *              interrupts and low-power modes behave the same way. Every
+ *              instruction is charged the cycle count from the family user's
+ *              guide (SLAU144 for MSP430/MSP430X, SLAU208 for CPUXv2), which
+ *              gives exact cycles per routine call and a per-instruction
+ *              hot-spot histogram
+ *
+ * Input:       Image (assembled .asm files or a linked ELF)
+ * Output:      register/memory state, cycle counts, profile report
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_CPU_H_
+#define HOSTSIM_CPU_H_
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/image.h"
+#include "hostsim/machine.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+
+namespace hostsim
+{
+
+//// Core
+enum class Core
+{
+    Msp430,         // F2013: 16-bit CPU
+    Msp430X,        // FG4618: CPUX, 20-bit, SLAU144 timing
+    Msp430Xv2       // F5529: CPUXv2, SLAU208 timing
+};
+
+Core coreOf(Device device);
+const char* coreName(Core core);
+
+
+
+//// Profile
+struct Hotspot
+{
+    uint64_t count = 0;                 // times the instruction at this address ran
+    uint64_t cycles = 0;                // MCLK cycles charged to it
+};
+
+struct Routine
+{
+    uint64_t calls = 0;
+    uint64_t cycles = 0;                // inclusive: CALL through RET, callees and ISRs included
+    uint64_t min = UINT64_MAX;
+    uint64_t max = 0;
+    uint32_t stack = 0;                 // deepest stack use below its return address, bytes
+};
+
+
+
+//// Cpu
+class Cpu
+{
+public:
+    Cpu(Machine& m, Core core);
+    ~Cpu();
+
+    // program
+    void load(const Image& image);
+    /* copies the image into memory; only addresses the image covers are
+     * executable, FLASH and the vector table are read-only
+     */
+    void reset();
+    /* PC from the reset vector (the image's entry point if it has none), SR
+     * cleared (POR)
+     */
+    void run();
+    /* executes until a Halt is thrown: time limit, idle loop, unprogrammed
+     * memory, PUC, CPU asleep forever
+     */
+    uint64_t call(uint32_t addr);
+    /* runs the routine at addr with the current registers until it returns,
+     * returns the MCLK cycles from its first instruction through its RET/RETA
+     */
+    void step();
+    /* one instruction, plus any interrupt taken on its boundary
+     */
+
+    // state
+    uint32_t reg(int n) const;
+    void setReg(int n, uint32_t value);
+    void push(uint16_t value);
+    uint32_t pc() const { return r_[0]; }
+    Machine& machine() const { return m_; }
+    Core core() const { return core_; }
+    uint64_t instructions() const { return instructions_; }
+    uint64_t flashWrites() const { return flashWrites_; }
+    uint32_t stackLow() const { return stackLow_; }
+    /* lowest SP inside RAM seen at an instruction boundary (stack high-water
+     * mark), 0xFFFFFFFF before the program has set SP
+     */
+    void resetStackLow() { stackLow_ = 0xFFFFFFFF; }
+
+    // debugging
+    std::string disassemble(uint32_t addr, unsigned* words = nullptr) const;
+    void setTrace(std::FILE* out, const Image* image = nullptr) { trace_ = out; traceImage_ = image; }
+
+    // profile
+    void setProfile(bool on);
+    const std::vector<Hotspot>& hotspots() const { return hot_; }
+    const std::map<uint32_t, Routine>& routines() const { return routines_; }
+    void resetProfile();
+    void report(std::FILE* out, const Image* image, int top) const;
+    /* per-routine call table (cycles, stack use), the stack high-water mark and
+     * the 'top' hottest instructions by cycles
+     */
+
+private:
+    struct Frame
+    {
+        uint32_t target;
+        uint64_t start;                 // machine cycles before the CALL
+        uint32_t sp;                    // SP right after the return address was pushed
+        uint32_t low;                   // lowest SP while it ran
+    };
+
+    void interrupt(int vector);
+    void execute(uint32_t addr);
+
+    uint32_t read(uint32_t addr, unsigned bits);
+    void write(uint32_t addr, unsigned bits, uint32_t value);
+    uint16_t fetch(uint32_t addr) const;
+    bool executable(uint32_t addr) const;
+
+    uint16_t srValue() const;
+    void setRegister(int n, uint32_t value, unsigned bits);
+
+    Machine& m_;
+    Core core_;
+    const MemoryMap& map_;
+    uint32_t r_[16] = {};               // R2 holds only C/Z/N/V, control bits live in the machine
+    std::vector<bool> programmed_;
+    uint32_t entry_ = 0;
+    bool srWritten_ = false;            // control bits to hand to the machine after the tick
+    uint16_t srPending_ = 0;
+    bool retiDone_ = false;
+
+    uint64_t instructions_ = 0;
+    uint64_t flashWrites_ = 0;
+    uint32_t firstFlashWrite_ = 0;
+    uint32_t stackLow_ = 0xFFFFFFFF;
+
+    std::FILE* trace_ = nullptr;
+    const Image* traceImage_ = nullptr;
+    bool profile_ = false;
+    std::vector<Hotspot> hot_;
+    std::vector<Frame> frames_;
+    std::map<uint32_t, Routine> routines_;
+};
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_CPU_H_
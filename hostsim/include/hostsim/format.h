@@ -0,0 +1,452 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        format.h
+ * Description:     printf-style formatting with the format string parsed at compile
+ *              time. HOSTSIM_FMT() turns a string literal into a type, format()
+ *              walks it in constant expressions and instantiates one emitter per
+ *              conversion, so nothing is parsed at run time and a format that
+ *              does not match its arguments (count, integer width, %s of a
+ *              number) fails to compile. Output goes to a sink, any callable
+ *              taking a char:
+ *
+ *                  format(StdoutSink{}, HOSTSIM_FMT("%d raised to %d is %ld\n"), a, p, b);
+ *                  formatTo(Time, sizeof(Time), HOSTSIM_FMT("%05d:%01d"), sec, tsec);
+ *                  format([](char c) { while (!(IFG2 & UCA0TXIFG)); UCA0TXBUF = c; },
+ *                         HOSTSIM_FMT("Current Blinks: %d\r\n"), currBlinkRate);
+ *
+ *              Conversions: %d %i %u %x %X %c %s %%, flags '-' '0' '+', a width,
+ *              and 'l' for long. Integers are converted without division (powers
+ *              of ten subtracted, sized to the argument's type), and the header
+ *              needs nothing from the library beyond putchar() for StdoutSink, so
+ *              it also builds freestanding for the device in a C++ project
+ *
+ * Input:       format literal, arguments
+ * Output:      characters to the sink
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_FORMAT_H_
+#define HOSTSIM_FORMAT_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <cstddef>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+
+#define HOSTSIM_FMT(s) [] { struct Fmt_ { static constexpr const char* value() { return s; } }; return Fmt_{}; }()
+/* the format literal as a type, for format() and formatTo()
+ */
+
+
+namespace hostsim
+{
+
+//// Sinks
+struct StdoutSink
+{
+    void operator()(char c) const { std::putchar(c); }
+};
+
+class BufferSink
+/* fills a buffer like snprintf: keeps room for the NUL finish() writes and counts
+ * what did not fit
+ */
+{
+public:
+    BufferSink(char* buf, size_t size) : buf_(buf), end_(size ? buf + size - 1 : nullptr), p_(buf) {}
+
+    void operator()(char c)
+    {
+        if (p_ < end_)
+        {
+            *p_ = c;
+        }
+        p_++;
+    }
+
+    size_t finish()
+    /* terminates the text, returns its full length
+     */
+    {
+        if (end_)
+        {
+            *(p_ < end_ ? p_ : end_) = '\0';
+        }
+        return (size_t)(p_ - buf_);
+    }
+
+private:
+    char* buf_;
+    char* end_;
+    char* p_;                       // runs past end_ to count what was cut
+};
+
+
+
+//// Compile-time Parsing
+namespace format_detail
+{
+
+enum : unsigned long
+{
+    LEFT = 0x100,                   // '-'
+    ZERO = 0x200,                   // '0'
+    PLUS = 0x400,                   // '+'
+    LONG = 0x800                    // 'l'
+};
+
+struct Conversion
+{
+    size_t begin, end;              // literal text before the conversion
+    size_t next;                    // first character after it
+    unsigned long code;             // conversion character | flags | width << 16
+};
+
+void invalidFormat(const char* why);
+/* never defined: reaching it in a constant expression is the compile error
+ */
+
+constexpr size_t length(const char* s)
+{
+    size_t n = 0;
+    while (s[n])
+    {
+        n++;
+    }
+    return n;
+}
+
+
+constexpr Conversion conversion(const char* s, size_t k)
+/* the k-th conversion of s ("%%" is literal text)
+ */
+{
+    size_t i = 0;
+    for (;;)
+    {
+        Conversion c{i, i, i, 0};
+        while (s[i] && !(s[i] == '%' && s[i + 1] != '%'))
+        {
+            i += s[i] == '%' ? 2 : 1;
+        }
+        c.end = i;
+        if (!s[i])
+        {
+            invalidFormat("more arguments than conversions");
+        }
+
+        unsigned long flags = 0, width = 0;
+        for (i++;; i++)
+        {
+            if (s[i] == '-')
+            {
+                flags |= LEFT;
+            }
+            else if (s[i] == '0')
+            {
+                flags |= ZERO;
+            }
+            else if (s[i] == '+')
+            {
+                flags |= PLUS;
+            }
+            else
+            {
+                break;
+            }
+        }
+        for (; s[i] >= '0' && s[i] <= '9'; i++)
+        {
+            width = width * 10 + (unsigned long)(s[i] - '0');
+        }
+        if (width > 255)
+        {
+            invalidFormat("field width above 255");
+        }
+        if (s[i] == 'l')
+        {
+            flags |= LONG;
+            i++;
+        }
+
+        switch (s[i])
+        {
+        case 'd': case 'i': case 'u': case 'x': case 'X': case 'c': case 's':
+            break;
+        default:
+            invalidFormat("unknown conversion");
+        }
+        c.code = (unsigned char)s[i] | flags | width << 16;
+        c.next = i + 1;
+
+        if (k-- == 0)
+        {
+            return c;
+        }
+        i = c.next;
+    }
+}
+
+
+constexpr size_t count(const char* s)
+/* conversions in s
+ */
+{
+    size_t n = 0;
+    for (size_t i = 0; s[i]; i++)
+    {
+        if (s[i] == '%')
+        {
+            if (s[i + 1] != '%')
+            {
+                n++;
+            }
+            i++;
+        }
+    }
+    return n;
+}
+
+
+template <class U>
+constexpr unsigned decimalDigits()
+{
+    unsigned n = 1;
+    for (U v = std::numeric_limits<U>::max(); v >= 10; v /= 10)
+    {
+        n++;
+    }
+    return n;
+}
+
+
+template <class U>
+struct PowersOf10
+{
+    U value[decimalDigits<U>()];
+
+    constexpr PowersOf10() : value()
+    {
+        U p = 1;
+        for (unsigned i = decimalDigits<U>(); i-- > 0; p *= 10)
+        {
+            value[i] = p;
+        }
+    }
+};
+
+template <class U>
+inline constexpr PowersOf10<U> powersOf10{};
+
+
+
+//// Emitters
+template <class Sink>
+inline void literal(Sink& sink, const char* s, size_t begin, size_t end)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        sink(s[i]);
+        i += s[i] == '%';           // "%%"
+    }
+}
+
+
+template <class Sink>
+inline void pad(Sink& sink, char c, unsigned n)
+{
+    for (; n > 0; n--)
+    {
+        sink(c);
+    }
+}
+
+
+template <unsigned long Code, class Sink, class U>
+void number(Sink& sink, U magnitude, char sign)
+/* magnitude in decimal or hex per Code, after 'sign' (0: none), padded to the width
+ */
+{
+    constexpr char conv = (char)(Code & 0xFF);
+    constexpr unsigned width = (unsigned)(Code >> 16);
+    char digits[decimalDigits<U>()];
+    unsigned n = 0;
+
+    if constexpr (conv == 'x' || conv == 'X')
+    {
+        constexpr const char* hex = conv == 'x' ? "0123456789abcdef" : "0123456789ABCDEF";
+        for (unsigned shift = 8 * sizeof(U); shift > 0;)
+        {
+            shift -= 4;
+            const unsigned nibble = (unsigned)(magnitude >> shift) & 0xF;
+            if (nibble || n || shift == 0)
+            {
+                digits[n++] = hex[nibble];
+            }
+        }
+    }
+    else
+    {
+        unsigned i = 0;
+        while (i < decimalDigits<U>() - 1 && magnitude < powersOf10<U>.value[i])   // no leading zeros
+        {
+            i++;
+        }
+        for (; i < decimalDigits<U>(); i++)
+        {
+            const U power = powersOf10<U>.value[i];
+            char d = '0';
+            for (; magnitude >= power; d++)
+            {
+                magnitude -= power;
+            }
+            digits[n++] = d;
+        }
+    }
+
+    const unsigned used = n + (sign != 0);
+    const unsigned fill = width > used ? width - used : 0;
+
+    if constexpr (!(Code & LEFT) && !(Code & ZERO))
+    {
+        pad(sink, ' ', fill);
+    }
+    if (sign)
+    {
+        sink(sign);
+    }
+    if constexpr ((Code & ZERO) && !(Code & LEFT))
+    {
+        pad(sink, '0', fill);
+    }
+    for (unsigned i = 0; i < n; i++)
+    {
+        sink(digits[i]);
+    }
+    if constexpr (Code & LEFT)
+    {
+        pad(sink, ' ', fill);
+    }
+}
+
+
+template <unsigned long Code, class Sink, class T>
+void argument(Sink& sink, const T& value)
+/* one conversion: checks the argument's type against it, then emits
+ */
+{
+    constexpr char conv = (char)(Code & 0xFF);
+    constexpr unsigned width = (unsigned)(Code >> 16);
+
+    if constexpr (conv == 's')
+    {
+        static_assert(std::is_convertible<T, const char*>::value, "%s takes a string");
+        const char* s = value;
+        unsigned n = 0;
+        if constexpr (width > 0)
+        {
+            while (s[n])
+            {
+                n++;
+            }
+        }
+        const unsigned fill = width > n ? width - n : 0;
+        if constexpr (!(Code & LEFT))
+        {
+            pad(sink, ' ', fill);
+        }
+        for (; *s; s++)
+        {
+            sink(*s);
+        }
+        if constexpr (Code & LEFT)
+        {
+            pad(sink, ' ', fill);
+        }
+    }
+    else
+    {
+        static_assert(std::is_integral<T>::value || std::is_enum<T>::value, "%d %i %u %x %X %c take an integer");
+        static_assert((Code & LONG) || sizeof(T) <= sizeof(int), "argument wider than int: use %ld, %lu or %lx");
+
+        if constexpr (conv == 'c')
+        {
+            const unsigned fill = width > 1 ? width - 1 : 0;
+            if constexpr (!(Code & LEFT))
+            {
+                pad(sink, ' ', fill);
+            }
+            sink((char)value);
+            if constexpr (Code & LEFT)
+            {
+                pad(sink, ' ', fill);
+            }
+        }
+        else if constexpr (conv == 'd' || conv == 'i')  // converted as printf would: int or long
+        {
+            using S = typename std::conditional<(Code & LONG) != 0, long, int>::type;
+            using U = typename std::make_unsigned<S>::type;
+            const S v = (S)value;
+            const char sign = v < 0 ? '-' : (Code & PLUS) ? '+' : 0;
+            number<Code>(sink, v < 0 ? (U)(0 - (U)v) : (U)v, sign);
+        }
+        else                                            // unsigned int or unsigned long
+        {
+            using U = typename std::conditional<(Code & LONG) != 0, unsigned long, unsigned>::type;
+            number<Code>(sink, (U)value, 0);
+        }
+    }
+}
+
+
+template <class Fmt, size_t I, class Sink, class T>
+inline void field(Sink& sink, const T& value)
+{
+    constexpr Conversion c = conversion(Fmt::value(), I);
+    literal(sink, Fmt::value(), c.begin, c.end);
+    argument<c.code>(sink, value);
+}
+
+
+template <class Fmt, class Sink, size_t... I, class... Args>
+inline void emit(Sink& sink, std::index_sequence<I...>, const Args&... args)
+{
+    constexpr size_t tail = sizeof...(I) ? conversion(Fmt::value(), sizeof...(I) - 1).next : 0;
+    (field<Fmt, I>(sink, args), ...);
+    literal(sink, Fmt::value(), tail, length(Fmt::value()));
+}
+
+}   // namespace format_detail
+
+
+
+//// Formatting
+template <class Sink, class Fmt, class... Args>
+inline void format(Sink&& sink, Fmt, const Args&... args)
+/* writes the format with its arguments to sink
+ */
+{
+    static_assert(format_detail::count(Fmt::value()) == sizeof...(Args),
+                  "format conversions and arguments differ in number");
+    format_detail::emit<Fmt>(sink, std::index_sequence_for<Args...>{}, args...);
+}
+
+
+template <class Fmt, class... Args>
+inline size_t formatTo(char* buf, size_t size, Fmt fmt, const Args&... args)
+/* snprintf(): NUL-terminated in buf, returns the full length even if it was cut
+ */
+{
+    BufferSink sink(buf, size);
+    format(sink, fmt, args...);
+    return sink.finish();
+}
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_FORMAT_H_
@@ -0,0 +1,107 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        image.h
+ * Description:     Program image for the instruction-set model: memory segments,
+ *              labels and the source line behind every instruction. Images come
+ *              from the host assembler (TI asm430 syntax as used by the lab .asm
+ *              files, linked with the same memory map as the lnk_*.cmd files) or
+ *              from a TI/GCC linked ELF (.out)
+ *
+ * Input:       .asm sources or an ELF executable
+ * Output:      Image (loaded by Cpu::load)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_IMAGE_H_
+#define HOSTSIM_IMAGE_H_
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/machine.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+
+namespace hostsim
+{
+
+//// Memory Map
+/* RAM / FLASH / vector table of each device, as in lnk_msp430*.cmd
+ */
+struct MemoryMap
+{
+    uint32_t ramStart, ramEnd;          // [start, end)
+    uint32_t flashStart, flashEnd;      // lower 64K code space, below the vectors
+    uint32_t vectorBase;                // INT00
+    int vectors;                        // table entries, RESET is the last one
+};
+
+const MemoryMap& memoryMap(Device device);
+
+
+
+//// Image
+struct Segment
+{
+    std::string name;                   // section (.text, .data, .reset, .int42, ...)
+    uint32_t addr;
+    std::vector<uint8_t> bytes;
+};
+
+struct Label
+{
+    std::string name;
+    uint32_t addr;
+    bool global;                        // .def/.global (or ELF global)
+};
+
+struct SourceLine
+{
+    std::string file;
+    int line;
+    std::string text;
+};
+
+struct Image
+{
+    Device device = Device::F5529;
+    std::vector<Segment> segments;
+    std::vector<Label> labels;
+    std::map<uint32_t, SourceLine> lines;       // instruction address -> source
+    uint32_t entry = 0;                         // ELF entry point / global RESET, 0 if none
+
+    bool find(const std::string& name, uint32_t& addr) const;
+    /* global label first, then the first local one of that name
+     */
+    uint32_t address(const std::string& name) const;
+    /* as find(), throws std::runtime_error when the label is unknown
+     */
+    std::string describe(uint32_t addr) const;
+    /* "label+0x6" for the nearest label at or below addr, hex address otherwise;
+     * all labels of addr when several share it
+     */
+    const SourceLine* source(uint32_t addr) const;
+    /* source line of the instruction at addr, or nullptr
+     */
+};
+
+
+
+//// Loaders
+Image assemble(const std::vector<std::string>& files, Device device);
+/* assembles and links the given .asm files (one program) the way CCS does for
+ * an assembly-only project: .text/.const in FLASH, .bss/.data in RAM,
+ * __STACK_END at the top of RAM, .reset/.intNN in the vector table. Throws
+ * std::runtime_error("file:line: message") on the first error
+ */
+Image loadElf(const std::string& path, Device device);
+/* loads the PT_LOAD segments and the symbol table of a linked ELF executable
+ */
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_IMAGE_H_
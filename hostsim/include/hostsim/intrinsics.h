@@ -0,0 +1,81 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        intrinsics.h
+ * Description:     Host versions of the TI compiler intrinsics and keywords used by
+ *              the lab programs (__bis_SR_register, _BIC_SR_IRQ, _EINT,
+ *              __delay_cycles, __interrupt, ...). Status register changes go to
+ *              the emulated CPU: setting CPUOFF puts it to sleep until an
+ *              interrupt handler clears the bit in its saved SR
+ *
+ * Input:       status register bit masks, cycle counts
+ * Output:      previous status register value where the TI intrinsic returns one
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_INTRINSICS_H_
+#define HOSTSIM_INTRINSICS_H_
+
+//// Function Prototypes
+unsigned short __bis_SR_register(unsigned short bits);
+/* sets SR bits (enters LPMx when CPUOFF is among them), returns previous SR
+ */
+unsigned short __bic_SR_register(unsigned short bits);
+/* clears SR bits, returns previous SR
+ */
+unsigned short __bis_SR_register_on_exit(unsigned short bits);
+/* sets bits in the SR saved by the running interrupt (takes effect on RETI)
+ */
+unsigned short __bic_SR_register_on_exit(unsigned short bits);
+/* clears bits in the SR saved by the running interrupt (LPMx_EXIT)
+ */
+unsigned short __get_SR_register(void);
+/* current SR
+ */
+void __enable_interrupt(void);
+/* EINT
+ */
+void __disable_interrupt(void);
+/* DINT
+ */
+void __delay_cycles(unsigned long cycles);
+/* burns the given number of MCLK cycles of virtual time
+ */
+void __no_operation(void);
+/* NOP (one cycle)
+ */
+
+inline unsigned int __even_in_range(unsigned int value, unsigned int) { return value; }
+
+
+// Legacy Names
+#define _BIS_SR(x)              __bis_SR_register(x)
+#define _BIC_SR(x)              __bic_SR_register(x)
+#define _BIS_SR_IRQ(x)          __bis_SR_register_on_exit(x)
+#define _BIC_SR_IRQ(x)          __bic_SR_register_on_exit(x)
+#define _bis_SR_register(x)     __bis_SR_register(x)
+#define _bic_SR_register(x)     __bic_SR_register(x)
+#define _EINT()                 __enable_interrupt()
+#define _DINT()                 __disable_interrupt()
+#define _NOP()                  __no_operation()
+#define _enable_interrupts()    __enable_interrupt()
+#define _disable_interrupts()   __disable_interrupt()
+
+
+// Keywords (handlers are bound to vectors by the lab registration, see lab.h)
+#define __interrupt
+
+
+// Low Power Modes (statement forms; the LPMx_bits values come from the device table)
+#define LPM0        __bis_SR_register(LPM0_bits)
+#define LPM0_EXIT   __bic_SR_register_on_exit(LPM0_bits)
+#define LPM1        __bis_SR_register(LPM1_bits)
+#define LPM1_EXIT   __bic_SR_register_on_exit(LPM1_bits)
+#define LPM2        __bis_SR_register(LPM2_bits)
+#define LPM2_EXIT   __bic_SR_register_on_exit(LPM2_bits)
+#define LPM3        __bis_SR_register(LPM3_bits)
+#define LPM3_EXIT   __bic_SR_register_on_exit(LPM3_bits)
+#define LPM4        __bis_SR_register(LPM4_bits)
+#define LPM4_EXIT   __bic_SR_register_on_exit(LPM4_bits)
+
+#endif  // HOSTSIM_INTRINSICS_H_
@@ -0,0 +1,106 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab.h
+ * Description:     Registration of lab programs with the host driver. A binding in
+ *              hostsim/labs/ includes the unmodified lab source inside its own
+ *              namespace (with main renamed to lab_main) and then lists the
+ *              device, the entry point and its #pragma vector handlers:
+ *
+ *                  HOSTSIM_LAB(lab7_p1, F5529, lab7_p1::lab_main,
+ *                              {PORT2_VECTOR, lab7_p1::switch1ISR}, ...)
+ *
+ *              and optionally lab variables that run_lab prints (with a rate
+ *              per virtual second) after its report:
+ *
+ *                  HOSTSIM_LAB_COUNTERS(lab9_2013, {"events taken", &lab9_2013::eventTail})
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_LAB_H_
+#define HOSTSIM_LAB_H_
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/machine.h"
+
+#include <initializer_list>
+#include <type_traits>
+#include <vector>
+
+
+namespace hostsim
+{
+
+//// Lab Descriptor
+struct IsrBinding
+{
+    unsigned vector;
+    void (*isr)();
+};
+
+struct LabCounter
+{
+    const char* name;
+    const volatile unsigned int* value;     // lab variable, printed after the run report
+};
+
+struct Lab
+{
+    const char* name;
+    Device device;
+    int (*entry)();                 // lab main (void main is wrapped to return 0)
+    std::vector<IsrBinding> isrs;
+    std::vector<LabCounter> counters;
+};
+
+std::vector<Lab>& labs();
+/* every lab linked into the binary, in registration order
+ */
+const Lab* findLab(const char* name);
+/* lab by name, nullptr when unknown
+ */
+
+struct LabRegistrar
+{
+    LabRegistrar(const char* name, Device device, int (*entry)(), std::initializer_list<IsrBinding> isrs)
+    {
+        labs().push_back({name, device, entry, isrs, {}});
+    }
+};
+
+struct LabCounterRegistrar
+{
+    LabCounterRegistrar(const char* name, std::initializer_list<LabCounter> counters);
+};
+
+
+// main() is declared either "void main(void)" or "int main(void)" in the labs
+template <void (*F)()>
+int voidEntry()
+{
+    F();
+    return 0;
+}
+
+template <int (*F)()>
+constexpr int (*entryOf(std::integral_constant<int (*)(), F>))() { return F; }
+
+template <void (*F)()>
+constexpr int (*entryOf(std::integral_constant<void (*)(), F>))() { return &voidEntry<F>; }
+
+}   // namespace hostsim
+
+
+#define HOSTSIM_LAB(id, device, entry, ...)                                                 \
+    static const ::hostsim::LabRegistrar hostsimLab_##id{                                   \
+        #id, ::hostsim::Device::device,                                                     \
+        ::hostsim::entryOf(std::integral_constant<decltype(&entry), &entry>{}), {__VA_ARGS__}}
+
+#define HOSTSIM_LAB_COUNTERS(id, ...)                                                       \
+    static const ::hostsim::LabCounterRegistrar hostsimLabCounters_##id{#id, {__VA_ARGS__}}
+/* after HOSTSIM_LAB(id, ...) in the same file: {"name", &lab::variable} pairs
+ */
+
+#endif  // HOSTSIM_LAB_H_
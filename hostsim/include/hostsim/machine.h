@@ -0,0 +1,264 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        machine.h
+ * Description:     Emulated MSP430 machine for the host build of the lab programs.
+ *              Holds the register file (bus), the peripheral models, the status
+ *              register, virtual time and the interrupt dispatcher. The lab code
+ *              runs natively; every register access is charged a fixed number
+ *              of MCLK cycles, brings the peripherals up to date and fires any
+ *              pending interrupt whose handler was registered for the lab
+ *
+ * Input:       register accesses from the lab program, scripted pin/UART/ADC
+ *              stimulus from the driver
+ * Output:      peripheral side effects (UART text, pin toggles) and run stats
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_MACHINE_H_
+#define HOSTSIM_MACHINE_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+namespace hostsim
+{
+
+// Constants
+constexpr uint64_t NEVER = UINT64_MAX;             // "no event pending"
+constexpr uint64_t PS_PER_S = 1000000000000ull;    // time base is picoseconds
+constexpr int NUM_VECTORS = 64;                    // F5529 has the largest table (0xFF80)
+
+// Status Register bits (identical on every MSP430)
+constexpr uint16_t SR_GIE = 0x0008;
+constexpr uint16_t SR_CPUOFF = 0x0010;
+constexpr uint16_t SR_OSCOFF = 0x0020;
+constexpr uint16_t SR_SCG0 = 0x0040;
+constexpr uint16_t SR_SCG1 = 0x0080;
+constexpr uint16_t SR_LPM_MASK = SR_CPUOFF | SR_OSCOFF | SR_SCG0 | SR_SCG1;
+
+enum class Device
+{
+    F5529,          // MSP-EXP430F5529LP (CPUXv2, MPY32, UCS)
+    FG4618,         // MSP-EXP430FG4618 experimenter board, big side (FLL+)
+    F2013           // MSP-EXP430FG4618 experimenter board, small side (BCS+)
+};
+
+const char* deviceName(Device d);
+
+
+
+//// Halt
+/* thrown out of the lab program to stop the run: time limit reached, CPU asleep
+ * with nothing left that could wake it, watchdog PUC, unhandled interrupt
+ */
+struct Halt : std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+
+
+
+class Machine;
+
+//// Peripheral
+/* base class of every peripheral model. Register storage lives in the machine's
+ * memory so byte/word aliases (UCA0IE vs UCA0ICTL) stay consistent; models only
+ * override the hooks they need
+ */
+class Peripheral
+{
+public:
+    explicit Peripheral(Machine& m) : m_(m) {}
+    virtual ~Peripheral() = default;
+
+    virtual const char* name() const = 0;
+    virtual uint32_t read(uint32_t addr, unsigned bits);            // default: plain storage
+    virtual void write(uint32_t addr, unsigned bits, uint32_t value);
+    virtual void advance(uint64_t now) { (void)now; }               // bring state up to 'now'
+    virtual uint64_t nextEvent() const { return NEVER; }            // next time state changes on its own
+    virtual uint64_t pending() const { return 0; }                  // bit mask of requesting vectors
+    virtual void acknowledge(int vector) { (void)vector; }          // vector accepted by the CPU
+    virtual void reset() {}
+    virtual void report(std::FILE* out, double seconds) const { (void)out; (void)seconds; }
+
+protected:
+    Machine& m_;
+};
+
+
+
+//// Clock Tree
+/* frequency source for MCLK/SMCLK/ACLK, implemented per device (UCS, FLL+, BCS+)
+ */
+class ClockTree : public Peripheral
+{
+public:
+    using Peripheral::Peripheral;
+    virtual uint64_t mclk() const = 0;
+    virtual uint64_t smclk() const = 0;
+    virtual uint64_t aclk() const { return 32768; }
+    virtual uint64_t vlo() const { return 10000; }
+};
+
+
+
+//// Run Statistics
+struct VectorStats
+{
+    uint64_t count = 0;             // times the handler ran
+    uint64_t cycles = 0;            // virtual MCLK cycles inside the handler (incl. entry/RETI)
+    uint64_t maxCycles = 0;         // longest single call
+    uint64_t maxWaitPs = 0;         // longest time from request to entry (GIE clear, other ISR running)
+    uint64_t hostNs = 0;            // host wall time inside the handler
+};
+
+struct Stats
+{
+    uint64_t reads = 0;             // register reads
+    uint64_t writes = 0;            // register writes
+    uint64_t sleeps = 0;            // LPM entries
+    uint64_t sleepPs = 0;           // virtual time spent with CPUOFF set
+    uint64_t dmaCycles = 0;         // MCLK cycles a DMA channel held (CPU stalled or asleep)
+    VectorStats vectors[NUM_VECTORS];
+};
+
+
+
+//// Machine
+class Machine
+{
+public:
+    using Isr = void (*)();
+    using VectorHandler = std::function<void(int vector)>;
+
+    explicit Machine(Device device);
+    ~Machine();
+
+    static Machine* current;                    // machine the register proxies talk to
+
+    // construction (used by devices.cpp)
+    template <typename P, typename... Args>
+    P& add(Args&&... args)
+    {
+        auto p = std::make_unique<P>(*this, std::forward<Args>(args)...);
+        P& ref = *p;
+        periph_.push_back(std::move(p));
+        return ref;
+    }
+    void map(uint32_t first, uint32_t last, Peripheral& p);
+    void setClocks(ClockTree& c) { clocks_ = &c; }
+    void setVectorName(int vector, const char* name) { vectorNames_[vector] = name; }
+
+    // bus (called by the register proxies)
+    uint32_t read(uint32_t addr, unsigned bits);
+    void write(uint32_t addr, unsigned bits, uint32_t value);
+
+    // raw storage, no side effects (used by peripherals for their own registers)
+    uint8_t raw8(uint32_t addr) const { return mem_[addr & 0xFFFFF]; }
+    uint16_t raw16(uint32_t addr) const { return mem_[addr & 0xFFFFE] | (mem_[(addr & 0xFFFFE) + 1] << 8); }
+    uint32_t raw(uint32_t addr, unsigned bits) const;
+    void setRaw8(uint32_t addr, uint8_t v) { mem_[addr & 0xFFFFF] = v; }
+    void setRaw16(uint32_t addr, uint16_t v) { mem_[addr & 0xFFFFE] = v & 0xFF; mem_[(addr & 0xFFFFE) + 1] = v >> 8; }
+    void setRaw(uint32_t addr, unsigned bits, uint32_t v);
+
+    // bus access from the instruction-set model: no per-access charge (the
+    // instruction timing covers it) and interrupts wait for the next tick, so
+    // they are taken on an instruction boundary
+    uint32_t load(uint32_t addr, unsigned bits);
+    void store(uint32_t addr, unsigned bits, uint32_t value);
+
+    // CPU
+    uint16_t sr() const { return sr_; }
+    uint16_t bisSR(uint16_t bits);              // returns the previous SR
+    uint16_t bicSR(uint16_t bits);
+    void bicSROnExit(uint16_t bits);            // edits the saved SR of the running ISR
+    void bisSROnExit(uint16_t bits);
+    void delayCycles(uint64_t cycles) { tick(cycles); }
+    void attach(int vector, Isr isr) { isr_[vector] = isr; }
+    void puc(const char* reason);               // power-up clear -> stops the run
+
+    // CPU, instruction-set model (cpu.cpp): SR written by an instruction, the
+    // SR pushed by interrupt entry, and vectors run by the simulated core
+    void writeSR(uint16_t value);               // no charge; sleeps when CPUOFF is set
+    uint16_t savedSR() const { return frames_.empty() ? sr_ : frames_.back(); }
+    void setSavedSR(uint16_t value);
+    void setVectorHandler(VectorHandler h) { handler_ = std::move(h); }
+    void setInterruptCycles(unsigned entry, unsigned reti) { entryCycles_ = entry; retiCycles_ = reti; }
+
+    // time
+    uint64_t now() const { return now_; }
+    uint64_t cycles() const { return cycles_; }
+    ClockTree& clocks() const { return *clocks_; }
+    void setTimeLimit(uint64_t ps) { limit_ = ps; }
+    void setAccessCycles(unsigned c) { accessCycles_ = c; }
+    void scheduleChanged() { deadline_ = 0; }   // a peripheral's next event moved
+    void stall(uint64_t cycles);                // MCLK cycles taken by the DMA from inside advance()
+    void sync() { advanceAll(); }               // bring every peripheral up to now (clock changes)
+
+    // peripherals
+    template <typename P>
+    P* find() const
+    {
+        for (auto& p : periph_)
+        {
+            if (auto q = dynamic_cast<P*>(p.get()))
+            {
+                return q;
+            }
+        }
+        return nullptr;
+    }
+    const std::vector<std::unique_ptr<Peripheral>>& peripherals() const { return periph_; }
+
+    Device device() const { return device_; }
+    const Stats& stats() const { return stats_; }
+    const char* vectorName(int vector) const;
+    void report(std::FILE* out, double hostSeconds) const;
+
+private:
+    void tick(uint64_t cycles);
+    void elapse(uint64_t cycles);
+    void advanceAll();
+    void service();
+    void requests(uint64_t mask);
+    void dispatch(int vector);
+    void sleep();
+
+    Device device_;
+    std::vector<uint8_t> mem_;
+    std::vector<Peripheral*> owner_;                    // owner of each address below 0x1000
+    std::vector<std::unique_ptr<Peripheral>> periph_;
+    ClockTree* clocks_ = nullptr;
+
+    uint16_t sr_ = 0;
+    std::vector<uint16_t> frames_;                      // saved SR of each active ISR
+    Isr isr_[NUM_VECTORS] = {};
+    VectorHandler handler_;                             // replaces isr_ when a simulated core runs
+    unsigned entryCycles_ = 6;                          // interrupt acceptance
+    unsigned retiCycles_ = 5;
+    const char* vectorNames_[NUM_VECTORS] = {};
+    uint64_t waiting_ = 0;                              // vectors requesting since requestedAt_
+    uint64_t requestedAt_[NUM_VECTORS] = {};
+
+    uint64_t now_ = 0;                                  // picoseconds since reset
+    uint64_t remainder_ = 0;                            // sub-picosecond MCLK carry
+    uint64_t cycles_ = 0;                               // MCLK cycles executed (not counting LPM, DMA included)
+    uint64_t deadline_ = 0;                             // earliest peripheral event
+    uint64_t limit_ = NEVER;
+    unsigned accessCycles_ = 3;                         // cost charged per register access
+
+    Stats stats_;
+};
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_MACHINE_H_
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        matrix.h
+ * Description:     Host matrix product for the Lab02_P3 MatrixMul interface at any
+ *              size: C = A * B for row-major float matrices, tiled over k and over
+ *              panels of B copied out transposed, so every inner loop is a
+ *              unit-stride dot product. The SSE or AVX2/FMA kernel is picked at
+ *              run time from what the host CPU supports. Used by the benchmark
+ *              suite and by offline jobs that link the hostsim sources
+ *
+ * Input:       A (rows x inner), B (inner x cols)
+ * Output:      C (rows x cols)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_MATRIX_H_
+#define HOSTSIM_MATRIX_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <cstddef>
+
+
+namespace hostsim
+{
+
+enum class MatmulIsa
+{
+    Auto,                           // best the CPU supports
+    Scalar,
+    Sse,
+    Avx2                            // AVX2 + FMA
+};
+
+const char* isaName(MatmulIsa isa);
+
+MatmulIsa matmulIsa();
+/* kernel matmul() runs: the one forced with setMatmulIsa(), else the best the
+ * CPU supports
+ */
+void setMatmulIsa(MatmulIsa isa);
+/* forces a kernel (Auto: back to detection); one the CPU lacks falls back to
+ * the next narrower one
+ */
+
+void matmul(const float* a, const float* b, float* c, size_t rows, size_t inner, size_t cols);
+/* C = A * B, row-major, C does not alias A or B
+ */
+inline void matmul(const float* a, const float* b, float* c, size_t n)
+{
+    matmul(a, b, c, n, n, n);
+}
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_MATRIX_H_
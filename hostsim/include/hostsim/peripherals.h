@@ -0,0 +1,523 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        peripherals.h
+ * Description:     Peripheral models plugged into the emulated machine: digital
+ *              I/O ports, Timer_A/Timer_B, watchdog, USCI (UART + SPI master),
+ *              ADC12, DAC12, USI (SPI slave), the hardware multiplier, the
+ *              F5529 DMA controller and the three clock systems. Each model is
+ *              configured with the register addresses of its device so the
+ *              same code serves the F5529, FG4618 and F2013
+ *
+ * Input:       register accesses, scripted stimulus (pins, UART/SPI bytes, ADC)
+ * Output:      interrupt requests, UART text, pin/timer toggle statistics
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_PERIPHERALS_H_
+#define HOSTSIM_PERIPHERALS_H_
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/machine.h"
+
+#include <deque>
+#include <string>
+#include <vector>
+
+
+namespace hostsim
+{
+
+//// Tick Counter
+/* converts virtual time into whole ticks of a (possibly changing) clock without
+ * accumulating rounding error; rebase() whenever the clock or divider changes
+ */
+struct TickCounter
+{
+    uint64_t baseTime = 0;          // time of the last rebase
+    uint64_t baseTicks = 0;         // ticks counted at baseTime
+    uint64_t hz = 0;                // clock frequency (0 = stopped)
+    uint64_t div = 1;               // prescaler
+
+    uint64_t ticksAt(uint64_t t) const;
+    uint64_t timeOf(uint64_t tick) const;               // first time at which 'tick' has elapsed
+    void rebase(uint64_t t, uint64_t ticks, uint64_t newHz, uint64_t newDiv);
+};
+
+
+
+//// Digital I/O
+struct PortConfig
+{
+    int number;                     // 1 -> P1
+    uint32_t in, out, dir, ren, sel; // ren = 0 when the port has no resistors
+    uint32_t ifg, ies, ie, iv;      // ifg = 0 when the port has no interrupts; iv = 0 when no PxIV
+    int vector;
+};
+
+class Gpio : public Peripheral
+{
+public:
+    Gpio(Machine& m, std::vector<PortConfig> ports);
+
+    const char* name() const override { return "gpio"; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override;
+    uint64_t pending() const override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+    void drive(uint64_t t, int port, int bit, int level);   // level -1 releases the pin
+    void boardPull(int port, int bit, int level);            // external pull resistor on the board
+
+private:
+    struct Pin
+    {
+        int drive = -1;             // external driver (-1 = none)
+        int pull = -1;              // board-level pull resistor (-1 = none)
+        uint64_t toggles = 0;       // output level changes
+        uint64_t first = 0, last = 0;
+    };
+    struct Port
+    {
+        PortConfig cfg;
+        Pin pins[8];
+        uint8_t level = 0;          // current output levels (for toggle stats)
+    };
+    struct Event
+    {
+        uint64_t t;
+        int port, bit, level;
+    };
+
+    Port* portOf(uint32_t addr);
+    Port* portNumber(int n);
+    void update(Port& p);
+
+    std::vector<Port> ports_;
+    std::deque<Event> events_;      // sorted by time
+};
+
+
+
+//// Timer_A / Timer_B
+struct TimerConfig
+{
+    const char* name;               // "TA0", "TB0", ...
+    uint32_t ctl, cctl0, r, ccr0, ex0, iv;  // ex0 = 0 when the timer has no TAxEX0
+    int channels;                   // number of capture/compare blocks
+    int vector0, vector1;           // CCR0 vector, CCR1..n/TAIFG vector
+    uint16_t ivOverflow;            // TAxIV value for TAIFG (0x0A on TA3/TA2 legacy, 0x0E otherwise)
+};
+
+class Timer : public Peripheral
+{
+public:
+    Timer(Machine& m, TimerConfig cfg);
+
+    const char* name() const override { return cfg_.name; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override;
+    uint64_t pending() const override;
+    void acknowledge(int vector) override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+private:
+    uint16_t ctl() const { return m_.raw16(cfg_.ctl); }
+    uint16_t cctl(int n) const { return m_.raw16(cfg_.cctl0 + 2 * n); }
+    uint16_t ccr(int n) const { return m_.raw16(cfg_.ccr0 + 2 * n); }
+    uint64_t sourceHz() const;
+    uint64_t period() const;                        // ticks per counting cycle (0 = stopped)
+    uint16_t counterAt(uint64_t phase) const;
+    uint64_t firstHit(uint64_t phase, uint64_t target) const;   // ticks until phase reaches target
+    void hitCount(int channel, uint64_t hits);
+    void reconfigure();
+
+    TimerConfig cfg_;
+    TickCounter clock_;
+    uint64_t last_ = 0;             // time of the last advance
+    uint64_t counted_ = 0;          // ticks already applied
+    uint64_t phase_ = 0;            // position inside the counting cycle
+    uint64_t toggles_[8] = {};      // OUTMOD_4 output toggles per channel
+    uint64_t flags_ = 0;            // number of CCIFG/TAIFG sets (activity stat)
+};
+
+
+
+//// Watchdog Timer (WDT_A / WDT+)
+struct WdtConfig
+{
+    uint32_t ctl;
+    uint32_t ie, ifg;               // SFRIE1/SFRIFG1 or IE1/IFG1
+    uint8_t ieBit, ifgBit;
+    int vector;
+    bool wdtA;                      // true: 5xx WDT_A (3-bit WDTIS, 2-bit WDTSSEL)
+};
+
+class Wdt : public Peripheral
+{
+public:
+    Wdt(Machine& m, WdtConfig cfg);
+
+    const char* name() const override { return "wdt"; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override;
+    uint64_t pending() const override;
+    void acknowledge(int vector) override;
+    void reset() override;
+
+private:
+    uint64_t interval() const;
+    void reconfigure();
+
+    WdtConfig cfg_;
+    uint16_t ctl_ = 0;
+    TickCounter clock_;
+    uint64_t last_ = 0;
+    uint64_t counted_ = 0;
+    uint64_t count_ = 0;            // WDTCNT
+};
+
+
+
+//// USCI (UART, SPI master)
+struct UsciConfig
+{
+    const char* name;               // "UCA0", "UCB0"
+    uint32_t ctl0, ctl1, br0, br1, mctl, stat, rxbuf, txbuf;
+    uint32_t ie, ifg, iv;           // iv = 0 on the 2xx/4xx USCI (flags live in IE2/IFG2)
+    uint8_t rxBit, txBit;           // flag bits inside ie/ifg
+    int rxVector, txVector;         // identical on 5xx
+};
+
+class Usci : public Peripheral
+{
+public:
+    Usci(Machine& m, UsciConfig cfg);
+
+    const char* name() const override { return cfg_.name; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override;
+    uint64_t pending() const override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+    void receive(uint64_t t, const std::string& bytes);     // scripted UART input
+    void spiReplies(const std::vector<uint8_t>& bytes);     // scripted SPI slave replies
+    void setSink(std::FILE* out, bool hex) { sink_ = out; hex_ = hex; }
+
+private:
+    bool sync() const { return m_.raw8(cfg_.ctl0) & 0x01; }
+    bool inReset() const { return m_.raw8(cfg_.ctl1) & 0x01; }
+    uint64_t bitTime() const;                       // picoseconds per bit
+    uint64_t frameTime() const;                     // picoseconds per character
+    void setFlag(uint8_t bit) { m_.setRaw8(cfg_.ifg, m_.raw8(cfg_.ifg) | bit); }
+    void clearFlag(uint8_t bit) { m_.setRaw8(cfg_.ifg, m_.raw8(cfg_.ifg) & ~bit); }
+    void shiftDone(uint8_t byte);
+
+    UsciConfig cfg_;
+    bool busy_ = false;             // shift register active
+    bool txFull_ = false;           // TXBUF waiting for the shift register
+    uint8_t shift_ = 0, tx_ = 0;
+    uint64_t done_ = NEVER;         // end of current character
+    struct Rx
+    {
+        uint64_t t;
+        uint8_t byte;
+    };
+    std::deque<Rx> rx_;
+    uint64_t lastRx_ = 0;
+    std::deque<uint8_t> spi_;
+    std::FILE* sink_ = stdout;
+    bool hex_ = false;
+    uint64_t sent_ = 0, received_ = 0, overruns_ = 0;
+};
+
+
+
+//// ADC12
+struct Adc12Config
+{
+    uint32_t ctl0, ctl1, ifg, ie, iv, mctl0, mem0;
+    int vector;
+};
+
+class Adc12 : public Peripheral
+{
+public:
+    Adc12(Machine& m, Adc12Config cfg);
+
+    const char* name() const override { return "adc12"; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override { return done_; }
+    uint64_t pending() const override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+    void setInput(int channel, uint16_t value) { input_[channel & 15] = value & 0x0FFF; }
+
+private:
+    uint64_t conversionTime() const;
+    void start(uint64_t t);
+
+    Adc12Config cfg_;
+    uint16_t input_[16] = {};
+    int slot_ = -1;                 // MEMx being converted (-1 = idle)
+    uint64_t done_ = NEVER;
+    uint64_t conversions_ = 0;
+};
+
+
+
+//// DAC12 (trace only)
+class Dac12 : public Peripheral
+{
+public:
+    Dac12(Machine& m, uint32_t dat0, uint32_t dat1);
+
+    const char* name() const override { return "dac12"; }
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void report(std::FILE* out, double seconds) const override;
+
+private:
+    uint32_t dat_[2];
+    uint64_t writes_[2] = {};
+    uint16_t min_[2] = {0xFFFF, 0xFFFF}, max_[2] = {};
+};
+
+
+
+//// USI (SPI slave, as used by the F2013 in lab09)
+struct UsiConfig
+{
+    uint32_t ctl0, ctl1, ckctl, cnt, srl, srh;
+    int vector;
+};
+
+class Usi : public Peripheral
+{
+public:
+    Usi(Machine& m, UsiConfig cfg);
+
+    const char* name() const override { return "usi"; }
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override { return master_.empty() ? NEVER : master_.front().t; }
+    uint64_t pending() const override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+    void masterSends(uint64_t t, uint8_t byte) { master_.push_back({t, byte}); }
+
+private:
+    UsiConfig cfg_;
+    struct Xfer
+    {
+        uint64_t t;
+        uint8_t byte;
+    };
+    std::deque<Xfer> master_;
+    uint64_t transfers_ = 0;
+    uint64_t lost_ = 0;                 // master bytes clocked in with USICNT not loaded
+};
+
+
+
+//// Hardware Multiplier (MPY on the FG4618, MPY32 on the F5529)
+struct MpyConfig
+{
+    uint32_t base;                  // MPY (first register of the block)
+    bool mpy32;                     // false: 16x16 MPY without MPY32CTL0/RES0..3
+};
+
+struct MpyStats
+{
+    uint64_t ops[4] = {};           // started by mode: MPY, MPYS, MAC, MACS
+    uint64_t wide = 0;              // operations with a 24/32-bit operand
+    uint64_t busyCycles = 0;        // MCLK cycles with an operation in flight
+    uint64_t earlyReads = 0;        // result read before it was available (stale value returned)
+    uint64_t writeHazards = 0;      // operand/result written during an operation, MPYDLYWRTEN clear
+    uint64_t delayedWrites = 0;     // same with MPYDLYWRTEN set (held back by the hardware)
+    uint64_t overflows = 0;         // signed accumulations that left the result range
+    uint64_t saturatedReads = 0;    // reads clipped by MPYSAT
+};
+
+class Mpy32 : public Peripheral
+{
+public:
+    Mpy32(Machine& m, MpyConfig cfg);
+
+    const char* name() const override { return cfg_.mpy32 ? "mpy32" : "mpy"; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+    const MpyStats& stats() const { return stats_; }
+    uint64_t doneCycle() const { return ready_[4]; }    // MCLK cycle the last operation completes (DMA trigger)
+
+private:
+    void start(unsigned op2Bits);
+    uint64_t result();                              // RES3..RES0 as seen through MPYFRAC/MPYSAT
+    bool busy() const;
+
+    MpyConfig cfg_;
+    uint32_t op1_ = 0, op2_ = 0;
+    unsigned op1Bits_ = 16;         // 8, 16, 24 or 32
+    unsigned mode_ = 0;             // MPYM: 0 MPY, 1 MPYS, 2 MAC, 3 MACS
+    uint16_t res_[4] = {};          // RES0..RES3 (RESLO/RESHI alias RES0/RES1)
+    uint16_t sumext_ = 0;
+    uint16_t ctl_ = 0;              // MPY32CTL0
+    bool overflow_ = false;         // last signed accumulation overflowed
+
+    // timing: MCLK cycle at which RES0..RES3 and SUMEXT/MPYC become valid, and
+    // what a read returns before that
+    uint64_t ready_[5] = {};
+    uint16_t old_[5] = {};
+    uint64_t started_ = 0;
+
+    MpyStats stats_;
+};
+
+
+
+//// DMA Controller (F5529, three channels)
+struct DmaConfig
+{
+    uint32_t ctl0, iv;              // DMACTL0 (DMACTL1..4 follow), DMAIV
+    uint32_t ch0;                   // DMA0CTL; channel n at ch0 + 0x10 * n (CTL, SA, DA, SZ)
+    int vector;
+};
+
+struct DmaStats
+{
+    uint64_t transfers[3] = {};     // bytes/words moved per channel
+    uint64_t triggers = 0;          // single transfers and blocks started
+    uint64_t blocks = 0;            // DMAxSZ ran out (DMAIFG set)
+};
+
+class Dma : public Peripheral
+{
+public:
+    Dma(Machine& m, DmaConfig cfg);
+
+    const char* name() const override { return "dma"; }
+    uint32_t read(uint32_t addr, unsigned bits) override;
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void advance(uint64_t now) override;
+    uint64_t nextEvent() const override;
+    uint64_t pending() const override;
+    void reset() override;
+    void report(std::FILE* out, double seconds) const override;
+
+    const DmaStats& stats() const { return stats_; }
+
+private:
+    struct Channel
+    {
+        uint32_t sa = 0, da = 0;    // working (temporary) addresses
+        uint16_t size = 0;          // DMAxSZ at enable, reloaded when the count runs out
+        bool request = false;       // trigger latched, transfer not done yet
+    };
+
+    uint32_t reg(int n, uint32_t off) const { return cfg_.ch0 + 0x10 * n + off; }
+    uint16_t ctl(int n) const { return m_.raw16(reg(n, 0)); }
+    unsigned tsel(int n) const;
+    bool mpyWaiting() const;
+    void latchMpy();
+    void enable(int n);
+    void service(int n);
+
+    DmaConfig cfg_;
+    Channel ch_[3];
+    Mpy32* mpy_ = nullptr;
+    uint64_t mpySeen_ = 0;          // last multiplier completion already taken as a trigger
+    bool running_ = false;          // inside advance()
+    DmaStats stats_;
+};
+
+
+
+//// Clock Systems
+class Ucs : public ClockTree          // F5529 Unified Clock System
+{
+public:
+    Ucs(Machine& m, uint32_t ctl0);
+    const char* name() const override { return "ucs"; }
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void reset() override;
+    uint64_t mclk() const override;
+    uint64_t smclk() const override;
+    uint64_t aclk() const override;
+
+private:
+    uint64_t source(unsigned sel) const;
+    uint32_t base_;
+};
+
+class FllPlus : public ClockTree      // FG4618 FLL+
+{
+public:
+    FllPlus(Machine& m, uint32_t scfi0, uint32_t scfqctl, uint32_t ctl0, uint32_t ctl1);
+    const char* name() const override { return "fll+"; }
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void reset() override;
+    uint64_t mclk() const override;
+    uint64_t smclk() const override;
+
+private:
+    uint32_t scfi0_, scfqctl_, ctl0_, ctl1_;
+};
+
+class BcsPlus : public ClockTree      // F2013 Basic Clock System+
+{
+public:
+    BcsPlus(Machine& m, uint32_t dcoctl, uint32_t bcsctl1, uint32_t bcsctl2, uint32_t cal);
+    const char* name() const override { return "bcs+"; }
+    void write(uint32_t addr, unsigned bits, uint32_t value) override;
+    void reset() override;
+    uint64_t mclk() const override;
+    uint64_t smclk() const override;
+    uint64_t aclk() const override { return 12000; }    // F2013 has no LFXT1 crystal fitted: VLO
+
+private:
+    uint64_t dco() const;
+    uint32_t dcoctl_, bcsctl1_, bcsctl2_, cal_;
+};
+
+
+
+//// Device Construction
+std::unique_ptr<Machine> makeMachine(Device device);
+/* builds the register file and peripheral set of the given device and resets it
+ */
+
+struct Symbol
+{
+    const char* name;
+    uint32_t value;
+    unsigned bits;                  // 0 for constants
+};
+
+const std::vector<Symbol>& deviceSymbols(Device device);
+/* every register (bits 8/16/20) and constant (bits 0) of the device header
+ */
+uint32_t symbolValue(Device device, const char* name);
+/* looks up a register address or constant by name (throws when unknown)
+ */
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_PERIPHERALS_H_
@@ -0,0 +1,81 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        reg.h
+ * Description:     Register proxy used by the host replacement device headers.
+ *              Every SFR name (P1OUT, TA0CCR0, UCA0TXBUF, ...) becomes a
+ *              constexpr Reg object holding only its address; reading it or
+ *              assigning to it goes through the emulated bus so peripherals
+ *              see the access and virtual time advances
+ *
+ * Input:       register address (from the device .def tables)
+ * Output:      value read from / written to the emulated register file
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_REG_H_
+#define HOSTSIM_REG_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <cstdint>
+
+
+namespace hostsim
+{
+
+//// Function Prototypes
+uint32_t busRead(uint32_t addr, unsigned bits);
+/* reads an 8/16/20-bit register through the current machine (runs read hooks)
+ */
+void busWrite(uint32_t addr, unsigned bits, uint32_t value);
+/* writes an 8/16/20-bit register through the current machine (runs write hooks);
+ * value is cut to the register width first
+ */
+
+
+
+//// Register Proxy
+template <typename T, unsigned Bits>
+struct Reg
+{
+    uint32_t addr;
+
+    // reads
+    operator T() const { return static_cast<T>(busRead(addr, Bits)); }
+
+    // writes (const so that the constexpr register objects stay assignable). The
+    // value is taken at full width and cut to Bits by the bus, as a store through
+    // a volatile unsigned char/short lvalue converts it: P6DIR &= ~BIT3 compiles
+    // without a narrowing warning
+    const Reg& operator=(uint32_t v) const { busWrite(addr, Bits, v); return *this; }
+    const Reg& operator=(const Reg& r) const { return *this = static_cast<T>(r); }  // UCA0TXBUF = UCA0RXBUF
+
+    // read-modify-write: one read access and one write access, same as the CPU
+    const Reg& operator|=(uint32_t v) const  { return *this = uint32_t(T(*this)) | v; }
+    const Reg& operator&=(uint32_t v) const  { return *this = uint32_t(T(*this)) & v; }
+    const Reg& operator^=(uint32_t v) const  { return *this = uint32_t(T(*this)) ^ v; }
+    const Reg& operator+=(uint32_t v) const  { return *this = uint32_t(T(*this)) + v; }
+    const Reg& operator-=(uint32_t v) const  { return *this = uint32_t(T(*this)) - v; }
+    const Reg& operator<<=(unsigned v) const { return *this = uint32_t(T(*this)) << v; }
+    const Reg& operator>>=(unsigned v) const { return *this = uint32_t(T(*this)) >> v; }
+
+    const Reg& operator++() const     { return *this += 1; }
+    const Reg& operator--() const     { return *this -= 1; }
+    T operator++(int) const           { T old = *this; *this = uint32_t(old) + 1; return old; }
+    T operator--(int) const           { T old = *this; *this = uint32_t(old) - 1; return old; }
+};
+
+using Reg8  = Reg<unsigned char, 8>;
+using Reg16 = Reg<unsigned short, 16>;
+using Reg20 = Reg<unsigned long, 20>;
+
+}   // namespace hostsim
+
+
+// width selector used by the device headers: HOSTSIM_REG_8 -> hostsim::Reg8 ...
+#define HOSTSIM_REG_8  ::hostsim::Reg8
+#define HOSTSIM_REG_16 ::hostsim::Reg16
+#define HOSTSIM_REG_20 ::hostsim::Reg20
+
+#endif  // HOSTSIM_REG_H_
@@ -0,0 +1,57 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        textfilter.h
+ * Description:     Host version of the lab4_p1 string filter for long text: the
+ *              alphanumeric bytes of a buffer are compacted to the front of the
+ *              output and the rest are counted. The SSE4.2 kernel classifies 16
+ *              bytes per compare with range compares and compacts each 8-byte
+ *              half through a PSHUFB index table; the AVX2 kernel classifies
+ *              32. The kernel is picked at run time from what the host CPU
+ *              supports, with a byte-at-a-time scalar loop as the fallback
+ *
+ * Input:       buffer, length
+ * Output:      alphanumerics in order, their count
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_TEXTFILTER_H_
+#define HOSTSIM_TEXTFILTER_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <cstddef>
+
+
+namespace hostsim
+{
+
+enum class FilterIsa
+{
+    Auto,                           // best the CPU supports
+    Scalar,
+    Sse,                            // SSE4.2 + POPCNT
+    Avx2                            // AVX2 + POPCNT
+};
+
+const char* isaName(FilterIsa isa);
+
+FilterIsa filterIsa();
+/* kernel alnumFilter() runs: the one forced with setFilterIsa(), else the best
+ * the CPU supports
+ */
+void setFilterIsa(FilterIsa isa);
+/* forces a kernel (Auto: back to detection); one the CPU lacks falls back to
+ * the next narrower one
+ */
+
+size_t alnumFilter(const char* src, size_t n, char* dst);
+/* copies the alphanumerics of src[0..n) to dst in order (n bytes at most, not
+ * terminated) and returns their count; n minus it is the special-character
+ * count, NUL bytes included as AlnumFilter.asm counts them. dst may be src
+ * (compaction in place), it may not overlap it otherwise
+ */
+
+}   // namespace hostsim
+
+#endif  // HOSTSIM_TEXTFILTER_H_
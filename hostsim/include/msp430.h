@@ -0,0 +1,18 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        msp430.h
+ * Description:     Host replacement for the generic TI msp430.h. Picks the device
+ *              header from the same predefined macro the TI compiler uses
+ *              (__MSP430FG4618__, __MSP430F2013__); defaults to the F5529
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#if defined(__MSP430FG4618__)
+#include "msp430fg4618.h"
+#elif defined(__MSP430F2013__)
+#include "msp430f2013.h"
+#else
+#include "msp430f5529.h"
+#endif
@@ -0,0 +1,44 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        msp430f2013.h
+ * Description:     Host replacement for the TI msp430f2013.h header. Registers become
+ *              emulated-register proxies, bit/field names become constants;
+ *              both come from hostsim/devices/f2013.def
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_MSP430F2013_H_
+#define HOSTSIM_MSP430F2013_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <stdlib.h>     // the lab sources call atoi()/strcmp() without including these
+#include <string.h>
+
+#include "hostsim/intrinsics.h"
+#include "hostsim/reg.h"
+
+#ifndef __MSP430F2013__
+#define __MSP430F2013__
+#endif
+
+
+namespace hostsim
+{
+namespace f2013
+{
+
+#define HOSTSIM_SFR(name, addr, bits) inline constexpr HOSTSIM_REG_##bits name{addr};
+#define HOSTSIM_CONST(name, value) constexpr unsigned name = value;
+#include "hostsim/devices/f2013.def"
+#undef HOSTSIM_SFR
+#undef HOSTSIM_CONST
+
+}   // namespace f2013
+}   // namespace hostsim
+
+using namespace hostsim::f2013;
+
+#endif  // HOSTSIM_MSP430F2013_H_
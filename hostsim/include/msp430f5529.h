@@ -0,0 +1,46 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        msp430f5529.h
+ * Description:     Host replacement for the TI msp430f5529.h header. Registers become
+ *              emulated-register proxies, bit/field names become constants;
+ *              both come from hostsim/devices/f5529.def
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_MSP430F5529_H_
+#define HOSTSIM_MSP430F5529_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <stdlib.h>     // the lab sources call atoi()/strcmp() without including these
+#include <string.h>
+
+#include "hostsim/intrinsics.h"
+#include "hostsim/reg.h"
+
+#ifndef __MSP430F5529__
+#define __MSP430F5529__
+#endif
+
+#define __MSP430_HAS_MPY32__            // module flags of the TI header that lab sources test
+
+
+namespace hostsim
+{
+namespace f5529
+{
+
+#define HOSTSIM_SFR(name, addr, bits) inline constexpr HOSTSIM_REG_##bits name{addr};
+#define HOSTSIM_CONST(name, value) constexpr unsigned name = value;
+#include "hostsim/devices/f5529.def"
+#undef HOSTSIM_SFR
+#undef HOSTSIM_CONST
+
+}   // namespace f5529
+}   // namespace hostsim
+
+using namespace hostsim::f5529;
+
+#endif  // HOSTSIM_MSP430F5529_H_
@@ -0,0 +1,46 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        msp430fg4618.h
+ * Description:     Host replacement for the TI msp430fg4618.h header. Registers become
+ *              emulated-register proxies, bit/field names become constants;
+ *              both come from hostsim/devices/fg4618.def
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef HOSTSIM_MSP430FG4618_H_
+#define HOSTSIM_MSP430FG4618_H_
+
+//// Preprocessor Directives
+// Libraries
+#include <stdlib.h>     // the lab sources call atoi()/strcmp() without including these
+#include <string.h>
+
+#include "hostsim/intrinsics.h"
+#include "hostsim/reg.h"
+
+#ifndef __MSP430FG4618__
+#define __MSP430FG4618__
+#endif
+
+#define __MSP430_HAS_MPY__              // module flags of the TI header that lab sources test
+
+
+namespace hostsim
+{
+namespace fg4618
+{
+
+#define HOSTSIM_SFR(name, addr, bits) inline constexpr HOSTSIM_REG_##bits name{addr};
+#define HOSTSIM_CONST(name, value) constexpr unsigned name = value;
+#include "hostsim/devices/fg4618.def"
+#undef HOSTSIM_SFR
+#undef HOSTSIM_CONST
+
+}   // namespace fg4618
+}   // namespace hostsim
+
+using namespace hostsim::fg4618;
+
+#endif  // HOSTSIM_MSP430FG4618_H_
@@ -0,0 +1,11 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        msp430xG46x.h
+ * Description:     Host replacement for the legacy MSP430xG46x family header used
+ *              by the lab08 demo programs; same register set as the FG4618
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#include "msp430fg4618.h"
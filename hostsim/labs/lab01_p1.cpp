@@ -0,0 +1,27 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab01_p1.cpp
+ * Description:     Host binding for lab01/lab1_pt1/Lab01_P1.c
+ *              (CalcPower (a^p by square-and-multiply on the MPY32), MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab01_p1
+{
+#include "../../lab01/lab1_pt1/Lab01_P1.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab01_p1, F5529, lab01_p1::lab_main);
@@ -0,0 +1,28 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab01_p2.cpp
+ * Description:     Host binding for lab01/lab1_pt2/Lab01_P2.c
+ *              (get_prime_factors() on the 32-bit INPUT_VALUES of main(),
+ *              printed as prime^exponent pairs, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab01_p2
+{
+#include "../../lab01/lab1_pt2/Lab01_P2.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab01_p2, F5529, lab01_p2::lab_main);
@@ -0,0 +1,29 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab02_p1.cpp
+ * Description:     Host binding for lab02/lab2_pt1/Lab02_P1.c
+ *              (data type size/range table, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <limits.h>
+#include <float.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab02_p1
+{
+#include "../../lab02/lab2_pt1/Lab02_P1.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab02_p1, F5529, lab02_p1::lab_main);
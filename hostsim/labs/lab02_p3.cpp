@@ -0,0 +1,28 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab02_p3.cpp
+ * Description:     Host binding for lab02/lab2_pt3/Lab02_P3.c
+ *              (SIZE x SIZE float MatrixMul, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <float.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab02_p3
+{
+#include "../../lab02/lab2_pt3/Lab02_P3.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab02_p3, F5529, lab02_p3::lab_main);
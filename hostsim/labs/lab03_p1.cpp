@@ -0,0 +1,31 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab03_p1.cpp
+ * Description:     Host binding for lab03/Lab03_P1.c
+ *              (Timer_A blink engine, switch interrupts and LPM3, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab03_p1
+{
+#include "../../lab03/Lab03_P1.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab03_p1, F5529, lab03_p1::lab_main,
+            {TIMER0_A0_VECTOR, lab03_p1::BlinkTimerISR},
+            {TIMER0_A1_VECTOR, lab03_p1::SleepTimerISR},
+            {PORT2_VECTOR, lab03_p1::Switch1ISR},
+            {PORT1_VECTOR, lab03_p1::Switch2ISR});
@@ -0,0 +1,27 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab06_p2.cpp
+ * Description:     Host binding for lab06/lab6_p2/lab6_p2.c
+ *              (UCS clock switching from the switches, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab06_p2
+{
+#include "../../lab06/lab6_p2/lab6_p2.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab06_p2, F5529, lab06_p2::lab_main);
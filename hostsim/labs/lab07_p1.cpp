@@ -0,0 +1,29 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab07_p1.cpp
+ * Description:     Host binding for lab07/lab7_p1/lab7_p1.c
+ *              (Timer_A PWM LED brightness, tick-debounced switches, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab07_p1
+{
+#include "../../lab07/lab7_p1/lab7_p1.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab07_p1, F5529, lab07_p1::lab_main,
+            {TIMER0_A0_VECTOR, lab07_p1::Timer_A0},
+            {TIMER0_A1_VECTOR, lab07_p1::Timer_A1});
@@ -0,0 +1,31 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab07_p2.cpp
+ * Description:     Host binding for lab07/lab7_p2/lab7_p2.c
+ *              (Timer_B buzzer toggled by the WDT interval, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab07_p2
+{
+#include "../../lab07/lab7_p2/lab7_p2.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab07_p2, FG4618, lab07_p2::lab_main,
+            {WDT_VECTOR, lab07_p2::WatchdogTimerISR});
@@ -0,0 +1,30 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab08_d1.cpp
+ * Description:     Host binding for lab08/Lab8_D1.c
+ *              (UART echo demo, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab08_d1
+{
+#include "../../lab08/Lab8_D1.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab08_d1, FG4618, lab08_d1::lab_main);
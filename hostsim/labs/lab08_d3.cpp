@@ -0,0 +1,31 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab08_d3.cpp
+ * Description:     Host binding for lab08/Lab8_D3.c
+ *              (Timer_A clock sent over UART demo, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab08_d3
+{
+#include "../../lab08/Lab8_D3.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab08_d3, FG4618, lab08_d3::lab_main,
+            {TIMERA0_VECTOR, lab08_d3::TIMERA_ISA});
@@ -0,0 +1,29 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab08_main.cpp
+ * Description:     Host binding for lab08/lab8_main.c
+ *              (UART chat bot with 15 s WDT timeout, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab08_main
+{
+#include "../../lab08/lab8_main.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab08_main, F5529, lab08_main::lab_main,
+            {WDT_VECTOR, lab08_main::TimerISR});
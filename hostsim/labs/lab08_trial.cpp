@@ -0,0 +1,31 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab08_trial.cpp
+ * Description:     Host binding for lab08/LabTrial.c
+ *              (TI UART echo example, MSP430F5529)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// the example picks its ISR syntax by compiler; use the TI form (#pragma vector / __interrupt)
+#define __TI_COMPILER_VERSION__ 1
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab08_trial
+{
+#include "../../lab08/LabTrial.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab08_trial, F5529, lab08_trial::lab_main,
+            {USCI_A0_VECTOR, lab08_trial::USCI_A0_ISR});
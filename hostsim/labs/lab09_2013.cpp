@@ -0,0 +1,36 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab09_2013.cpp
+ * Description:     Host binding for lab09/lab9_2013/lab9_2013.c
+ *              (USI SPI slave LED duty cycle, MSP430F2013)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430F2013__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab09_2013
+{
+#include "../../lab09/lab9_2013/lab9_2013.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab09_2013, F2013, lab09_2013::lab_main,
+            {USI_VECTOR, lab09_2013::USI_ISR},
+            {TIMERA0_VECTOR, lab09_2013::Timer_A0},
+            {TIMERA1_VECTOR, lab09_2013::Timer_A1});
+HOSTSIM_LAB_COUNTERS(lab09_2013,
+                     {"events taken", &lab09_2013::eventTail},
+                     {"events dropped", &lab09_2013::eventDrops});
@@ -0,0 +1,32 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab09_4618.cpp
+ * Description:     Host binding for lab09/lab9_4618/lab9_4618.c
+ *              (UART prompt, SPI master to the F2013, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab09_4618
+{
+#include "../../lab09/lab9_4618/lab9_4618.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab09_4618, FG4618, lab09_4618::lab_main);
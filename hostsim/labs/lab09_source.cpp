@@ -0,0 +1,32 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab09_source.cpp
+ * Description:     Host binding for lab09/lab9_4618/Lab_9_Source_Code.c
+ *              (reference UART/SPI master program, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab09_source
+{
+#include "../../lab09/lab9_4618/Lab_9_Source_Code.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab09_source, FG4618, lab09_source::lab_main);
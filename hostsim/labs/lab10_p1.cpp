@@ -0,0 +1,39 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab10_p1.cpp
+ * Description:     Host binding for lab10/lab10_p1/lab10_p1.c
+ *              (ADC12 accelerometer sampling over UART, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab10_p1
+{
+#include "../../lab10/lab10_p1/lab10_p1.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab10_p1, FG4618, lab10_p1::lab_main,
+            {ADC12_VECTOR, lab10_p1::ADC12_ISR},
+            {TIMERA0_VECTOR, lab10_p1::TA0_ISR},
+            {TIMERB0_VECTOR, lab10_p1::TB0_ISR},
+            {WDT_VECTOR, lab10_p1::WDT_ISR});
+HOSTSIM_LAB_COUNTERS(lab10_p1,
+                     {"events taken", &lab10_p1::eventTail},
+                     {"events dropped", &lab10_p1::eventDrops});
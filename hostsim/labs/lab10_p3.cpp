@@ -0,0 +1,34 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab10_p3.cpp
+ * Description:     Host binding for lab10/lab10_p3/lab10_p3.c
+ *              (DAC12 triangle/sine wave generator, MSP430FG4618)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Device
+#define __MSP430FG4618__
+
+// Libraries
+#include <msp430.h>
+#include <stdio.h>
+
+#include "hostsim/lab.h"
+
+
+
+//// Lab Source
+#define main lab_main
+namespace lab10_p3
+{
+#include "../../lab10/lab10_p3/lab10_p3.c"
+}
+#undef main
+
+HOSTSIM_LAB(lab10_p3, FG4618, lab10_p3::lab_main,
+            {TIMERA0_VECTOR, lab10_p3::TA0_ISR});
+HOSTSIM_LAB_COUNTERS(lab10_p3,
+                     {"events taken", &lab10_p3::eventTail},
+                     {"events dropped", &lab10_p3::eventDrops});
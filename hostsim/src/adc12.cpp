@@ -0,0 +1,243 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        adc12.cpp
+ * Description:     ADC12 conversion sequencer and DAC12 output trace. Conversions
+ *              take the sample-and-hold time selected by SHT0x/SHT1x plus 13
+ *              ADC12CLK cycles; the converted codes are per-channel constants
+ *              set by the driver (--adc A3=2048). The DAC only records what the
+ *              program writes to DAC12_xDAT
+ *
+ * Input:       ADC12CTL0/1, ADC12MCTLx, ADC12IE, scripted channel codes
+ * Output:      ADC12MEMx, ADC12IFG/ADC12IV, ADC12 interrupt requests, DAC trace
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+// Macros (ADC12CTL0 / ADC12CTL1 / ADC12MCTLx fields; same positions on 4xx and 5xx)
+#define CTL0_SC     0x0001
+#define CTL0_ENC    0x0002
+#define CTL0_ON     0x0010
+#define CTL1_BUSY   0x0001
+#define CTL1_SHP    0x0200
+#define MCTL_EOS    0x80
+
+#define ADC12OSC_HZ 5000000ull      // internal oscillator, typical
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+Adc12::Adc12(Machine& m, Adc12Config cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+uint64_t Adc12::conversionTime() const
+{
+    uint16_t ctl0 = m_.raw16(cfg_.ctl0);
+    uint16_t ctl1 = m_.raw16(cfg_.ctl1);
+
+    uint64_t hz;
+    switch ((ctl1 >> 3) & 3)                        // ADC12SSEL
+    {
+        case 1:  hz = m_.clocks().aclk(); break;
+        case 2:  hz = m_.clocks().mclk(); break;
+        case 3:  hz = m_.clocks().smclk(); break;
+        default: hz = ADC12OSC_HZ; break;
+    }
+    hz /= ((ctl1 >> 5) & 7) + 1;                    // ADC12DIV
+
+    static const uint16_t sht[16] = {4, 8, 16, 32, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1024, 1024, 1024};
+    unsigned field = slot_ < 8 ? (ctl0 >> 8) & 15 : (ctl0 >> 12) & 15;    // SHT0x / SHT1x
+    uint64_t cycles = ((ctl1 & CTL1_SHP) ? sht[field] : 4) + 13;
+
+    return cycles * PS_PER_S / hz;
+}
+
+
+void Adc12::start(uint64_t t)
+{
+    slot_ = (m_.raw16(cfg_.ctl1) >> 12) & 15;       // CSTARTADDx
+    done_ = t + conversionTime();
+    m_.setRaw16(cfg_.ctl1, m_.raw16(cfg_.ctl1) | CTL1_BUSY);
+}
+
+
+void Adc12::advance(uint64_t now)
+{
+    while (slot_ >= 0 && done_ <= now)
+    {
+        uint8_t mctl = m_.raw8(cfg_.mctl0 + slot_);
+        m_.setRaw16(cfg_.mem0 + 2 * slot_, input_[mctl & 15]);
+        m_.setRaw16(cfg_.ifg, m_.raw16(cfg_.ifg) | (1 << slot_));
+        conversions_++;
+
+        uint16_t ctl0 = m_.raw16(cfg_.ctl0);
+        unsigned conseq = (m_.raw16(cfg_.ctl1) >> 1) & 3;
+        bool enabled = ctl0 & CTL0_ENC;
+        bool eos = mctl & MCTL_EOS;
+
+        int next = -1;
+        switch (conseq)
+        {
+            case 0:                                 // single channel, single conversion
+                break;
+            case 1:                                 // sequence of channels
+                next = eos ? -1 : (slot_ + 1) & 15;
+                break;
+            case 2:                                 // repeat single channel
+                next = enabled ? slot_ : -1;
+                break;
+            case 3:                                 // repeat sequence
+                next = !eos ? (slot_ + 1) & 15 : enabled ? (m_.raw16(cfg_.ctl1) >> 12) & 15 : -1;
+                break;
+        }
+
+        if (next < 0)
+        {
+            slot_ = -1;
+            done_ = NEVER;
+            m_.setRaw16(cfg_.ctl1, m_.raw16(cfg_.ctl1) & ~CTL1_BUSY);
+        }
+        else
+        {
+            uint64_t t = done_;
+            slot_ = next;
+            done_ = t + conversionTime();
+        }
+    }
+}
+
+
+uint32_t Adc12::read(uint32_t addr, unsigned bits)
+{
+    if (addr == cfg_.iv)
+    {
+        // ADC12IV: 0x06 + 2*x for ADC12IFGx (lowest x first); the read clears the flag
+        uint16_t flags = m_.raw16(cfg_.ifg) & m_.raw16(cfg_.ie);
+        if (!flags)
+        {
+            return 0;
+        }
+        int x = __builtin_ctz(flags);
+        m_.setRaw16(cfg_.ifg, m_.raw16(cfg_.ifg) & ~(1 << x));
+        return 6 + 2 * x;
+    }
+
+    if (addr >= cfg_.mem0 && addr < cfg_.mem0 + 32)
+    {
+        int x = (addr - cfg_.mem0) / 2;
+        m_.setRaw16(cfg_.ifg, m_.raw16(cfg_.ifg) & ~(1 << x));     // reading ADC12MEMx clears its flag
+    }
+    return m_.raw(addr, bits);
+}
+
+
+void Adc12::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if (addr == cfg_.iv)
+    {
+        return;
+    }
+
+    m_.setRaw(addr, bits, value);
+
+    if (addr == cfg_.ctl0)
+    {
+        uint16_t ctl0 = m_.raw16(cfg_.ctl0);
+        bool shs = (m_.raw16(cfg_.ctl1) >> 10) & 3;
+        if ((ctl0 & (CTL0_ON | CTL0_ENC | CTL0_SC)) == (CTL0_ON | CTL0_ENC | CTL0_SC) && !shs)
+        {
+            if (slot_ < 0)
+            {
+                start(m_.now());
+            }
+            if (m_.raw16(cfg_.ctl1) & CTL1_SHP)
+            {
+                m_.setRaw16(cfg_.ctl0, ctl0 & ~CTL0_SC);    // ADC12SC resets itself in pulse mode
+            }
+        }
+        if (!(ctl0 & CTL0_ON))
+        {
+            slot_ = -1;
+            done_ = NEVER;
+        }
+    }
+}
+
+
+uint64_t Adc12::pending() const
+{
+    return (m_.raw16(cfg_.ifg) & m_.raw16(cfg_.ie)) ? 1ull << cfg_.vector : 0;
+}
+
+
+void Adc12::reset()
+{
+    for (uint32_t a : {cfg_.ctl0, cfg_.ctl1, cfg_.ifg, cfg_.ie, cfg_.iv})
+    {
+        m_.setRaw16(a, 0);
+    }
+    for (int x = 0; x < 16; x++)
+    {
+        m_.setRaw8(cfg_.mctl0 + x, 0);
+    }
+    slot_ = -1;
+    done_ = NEVER;
+}
+
+
+void Adc12::report(std::FILE* out, double seconds) const
+{
+    if (conversions_)
+    {
+        std::fprintf(out, "adc12              %llu conversions (%.1f /s)\n", (unsigned long long)conversions_,
+                     seconds > 0 ? conversions_ / seconds : 0.0);
+    }
+}
+
+
+
+//// DAC12
+Dac12::Dac12(Machine& m, uint32_t dat0, uint32_t dat1)
+    : Peripheral(m), dat_{dat0, dat1}
+{
+}
+
+
+void Dac12::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    m_.setRaw(addr, bits, value);
+
+    for (int i = 0; i < 2; i++)
+    {
+        if (addr == dat_[i])
+        {
+            uint16_t v = value & 0x0FFF;
+            writes_[i]++;
+            min_[i] = v < min_[i] ? v : min_[i];
+            max_[i] = v > max_[i] ? v : max_[i];
+        }
+    }
+}
+
+
+void Dac12::report(std::FILE* out, double seconds) const
+{
+    for (int i = 0; i < 2; i++)
+    {
+        if (writes_[i])
+        {
+            std::fprintf(out, "dac12 DAC12_%dDAT    %llu updates (%.1f /s), range %u..%u\n", i,
+                         (unsigned long long)writes_[i], seconds > 0 ? writes_[i] / seconds : 0.0, min_[i], max_[i]);
+        }
+    }
+}
+
+}   // namespace hostsim
@@ -0,0 +1,1964 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        asm.cpp
+ * Description:     Host assembler and linker for the lab assembly programs. Covers
+ *              the asm430 subset the labs use: labels in column 1 (colon
+ *              optional), .cdecls device symbols, .def/.ref/.global, .text/
+ *              .data/.bss/.sect, .byte/.word/.int/.long/.string/.cstring/.space/
+ *              .align/.equ, every MSP430 instruction and emulated mnemonic, and
+ *              the MSP430X extension-word/address instructions (MOVX.A, MOVA,
+ *              CALLA, PUSHM, RPT, ...). Immediates use the constant generator
+ *              exactly when asm430 would: the value is an absolute constant in
+ *              {-1, 0, 1, 2, 4, 8}
+ *
+ *              Two passes per file: pass 1 sizes every statement (sizes never
+ *              depend on label addresses), the linker lays out the sections,
+ *              pass 2 encodes with every label resolved
+ *
+ * Input:       .asm files of one program, target device
+ * Output:      Image (segments, labels, instruction source lines)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/image.h"
+#include "hostsim/peripherals.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+
+namespace hostsim
+{
+
+//// Memory Map
+const MemoryMap& memoryMap(Device device)
+{
+    static const MemoryMap f5529 = {0x2400, 0x4400, 0x4400, 0xFF80, 0xFF80, 64};
+    static const MemoryMap fg4618 = {0x1100, 0x3100, 0x3100, 0xFFC0, 0xFFC0, 32};
+    static const MemoryMap f2013 = {0x0200, 0x0280, 0xF800, 0xFFE0, 0xFFE0, 16};
+
+    switch (device)
+    {
+        case Device::FG4618: return fg4618;
+        case Device::F2013:  return f2013;
+        default:             return f5529;
+    }
+}
+
+
+
+//// Image
+bool Image::find(const std::string& name, uint32_t& addr) const
+{
+    const Label* local = nullptr;
+    for (const Label& l : labels)
+    {
+        if (l.name != name)
+        {
+            continue;
+        }
+        if (l.global)
+        {
+            addr = l.addr;
+            return true;
+        }
+        local = local ? local : &l;
+    }
+    if (local)
+    {
+        addr = local->addr;
+    }
+    return local != nullptr;
+}
+
+
+uint32_t Image::address(const std::string& name) const
+{
+    uint32_t addr;
+    if (!find(name, addr))
+    {
+        throw std::runtime_error("unknown label '" + name + "'");
+    }
+    return addr;
+}
+
+
+std::string Image::describe(uint32_t addr) const
+{
+    const Label* best = nullptr;
+    for (const Label& l : labels)
+    {
+        if (l.addr <= addr && (!best || l.addr >= best->addr))
+        {
+            best = &l;
+        }
+    }
+
+    char buf[96];
+    if (best && addr - best->addr < 0x1000)
+    {
+        if (addr == best->addr)
+        {
+            std::string all;                    // every label at addr: "COMPUTEPARITY/loop"
+            for (const Label& l : labels)
+            {
+                if (l.addr == addr)
+                {
+                    all += (all.empty() ? "" : "/") + l.name;
+                }
+            }
+            return all;
+        }
+        std::snprintf(buf, sizeof(buf), "%s+0x%X", best->name.c_str(), addr - best->addr);
+        return buf;
+    }
+    std::snprintf(buf, sizeof(buf), "0x%05X", addr);
+    return buf;
+}
+
+
+const SourceLine* Image::source(uint32_t addr) const
+{
+    auto it = lines.find(addr);
+    return it == lines.end() ? nullptr : &it->second;
+}
+
+
+
+namespace
+{
+
+//// Source Statements
+struct Stmt
+{
+    int line;
+    std::string text;                   // trimmed source line
+    std::string label;
+    std::string op;                     // lower case mnemonic/directive, "" for label-only lines
+    std::vector<std::string> args;
+
+    std::string section;                // set by pass 1
+    uint32_t offset = 0;
+    uint32_t size = 0;
+    int repeat = 0;                     // RPT prefix carried into this statement (#n: n, Rn: -(n+1))
+};
+
+struct SectionPart
+{
+    uint32_t size = 0;
+    uint32_t base = 0;                  // absolute, set by the linker
+};
+
+struct File
+{
+    std::string path;
+    std::vector<Stmt> stmts;
+    std::unordered_map<std::string, SectionPart> sections;
+    std::vector<std::string> sectionOrder;
+    std::unordered_map<std::string, std::pair<std::string, uint32_t>> labels;  // name -> section, offset
+    std::unordered_map<std::string, std::string> equs;                          // name -> expression
+    std::vector<std::string> globals;
+};
+
+
+std::string trim(const std::string& s)
+{
+    size_t a = s.find_first_not_of(" \t\r\n");
+    size_t b = s.find_last_not_of(" \t\r\n");
+    return a == std::string::npos ? "" : s.substr(a, b - a + 1);
+}
+
+
+std::string lower(std::string s)
+{
+    for (char& c : s)
+    {
+        c = (char)std::tolower((unsigned char)c);
+    }
+    return s;
+}
+
+
+std::string stripComment(const std::string& s)
+{
+    bool quoted = false;
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        if (s[i] == '"')
+        {
+            quoted = !quoted;
+        }
+        else if (s[i] == '\'' && !quoted && i + 2 < s.size() && s[i + 2] == '\'')
+        {
+            i += 2;                     // character constant, may be ';'
+        }
+        else if (s[i] == ';' && !quoted)
+        {
+            return s.substr(0, i);
+        }
+    }
+    return s;
+}
+
+
+std::vector<std::string> splitArgs(const std::string& s)
+{
+    std::vector<std::string> out;
+    std::string cur;
+    bool quoted = false;
+    int depth = 0;
+
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        char c = s[i];
+        if (c == '"')
+        {
+            quoted = !quoted;
+        }
+        else if (!quoted && c == '\'' && i + 2 < s.size() && s[i + 2] == '\'')
+        {
+            cur += s.substr(i, 3);
+            i += 2;
+            continue;
+        }
+        else if (!quoted && c == '(')
+        {
+            depth++;
+        }
+        else if (!quoted && c == ')')
+        {
+            depth--;
+        }
+        else if (!quoted && depth == 0 && c == ',')
+        {
+            out.push_back(trim(cur));
+            cur.clear();
+            continue;
+        }
+        cur += c;
+    }
+    if (!trim(cur).empty() || !out.empty())
+    {
+        out.push_back(trim(cur));
+    }
+    return out;
+}
+
+
+Stmt parseLine(const std::string& raw, int line)
+{
+    Stmt st;
+    st.line = line;
+    st.text = trim(stripComment(raw));
+
+    std::string s = stripComment(raw);
+    if (!raw.empty() && raw[0] == '*')
+    {
+        s.clear();                      // '*' in column 1 is a comment line
+    }
+
+    size_t i = 0;
+    auto word = [&]()
+    {
+        while (i < s.size() && std::isspace((unsigned char)s[i]))
+        {
+            i++;
+        }
+        size_t b = i;
+        while (i < s.size() && !std::isspace((unsigned char)s[i]))
+        {
+            i++;
+        }
+        return s.substr(b, i - b);
+    };
+
+    if (!s.empty() && !std::isspace((unsigned char)s[0]))
+    {
+        st.label = word();              // column 1: label
+    }
+    std::string op = word();
+    if (st.label.empty() && !op.empty() && op.back() == ':')
+    {
+        st.label = op;                  // indented label with colon
+        op = word();
+    }
+    if (!st.label.empty() && st.label.back() == ':')
+    {
+        st.label.pop_back();
+    }
+
+    st.op = lower(op);
+    st.args = splitArgs(trim(s.substr(i)));
+    return st;
+}
+
+
+
+//// Expressions
+struct Value
+{
+    int64_t v = 0;
+    bool known = true;                  // false: refers to a label not placed yet
+    bool label = false;                 // depends on a relocatable symbol
+};
+
+class Assembler;
+
+class Expr
+{
+public:
+    Expr(const Assembler& a, const File& f, const std::string& s, uint32_t here, bool final)
+        : a_(a), f_(f), s_(s), here_(here), final_(final)
+    {
+    }
+
+    Value parse();
+
+private:
+    Value orExpr();
+    Value xorExpr();
+    Value andExpr();
+    Value shiftExpr();
+    Value addExpr();
+    Value mulExpr();
+    Value unary();
+    Value primary();
+
+    void skip() { while (p_ < s_.size() && std::isspace((unsigned char)s_[p_])) p_++; }
+    bool eat(const char* t)
+    {
+        skip();
+        size_t n = std::strlen(t);
+        if (s_.compare(p_, n, t) == 0)
+        {
+            p_ += n;
+            return true;
+        }
+        return false;
+    }
+
+    const Assembler& a_;
+    const File& f_;
+    const std::string& s_;
+    uint32_t here_;
+    bool final_;
+    size_t p_ = 0;
+};
+
+Value combine(Value a, Value b, int64_t v)
+{
+    return {v, a.known && b.known, a.label || b.label};
+}
+
+
+
+//// Operands
+enum class Mode { Reg, Indexed, Symbolic, Absolute, Indirect, AutoInc, Immediate };
+
+struct Operand
+{
+    Mode mode;
+    int reg = 0;
+    std::string expr;
+};
+
+int regNumber(const std::string& s)
+{
+    std::string r = lower(trim(s));
+    if (r == "pc") return 0;
+    if (r == "sp") return 1;
+    if (r == "sr") return 2;
+    if (r == "cg") return 3;
+    if (r.size() >= 2 && r.size() <= 3 && r[0] == 'r' && std::isdigit((unsigned char)r[1]))
+    {
+        int n = std::atoi(r.c_str() + 1);
+        if (n < 16 && (r.size() == 2 || std::isdigit((unsigned char)r[2])))
+        {
+            return n;
+        }
+    }
+    return -1;
+}
+
+
+
+//// Assembler
+class Assembler
+{
+public:
+    Assembler(Device device) : device_(device), map_(memoryMap(device))
+    {
+        for (const Symbol& s : deviceSymbols(device))
+        {
+            device_syms_.emplace(s.name, s.value);
+        }
+    }
+
+    Image run(const std::vector<std::string>& paths);
+    bool lookup(const File& f, const std::string& name, bool final, Value& out, int depth = 0) const;
+
+private:
+    void read(File& f);
+    void pass1(File& f);
+    void link();
+    void pass2(File& f, Image& img);
+
+    uint32_t statementSize(File& f, Stmt& st, uint32_t here);
+    std::vector<uint8_t> encode(File& f, Stmt& st, uint32_t here, bool final);
+
+    Value eval(const File& f, const std::string& s, uint32_t here, bool final) const;
+    int64_t need(const File& f, const Stmt& st, const std::string& s, uint32_t here, bool final) const;
+    [[noreturn]] void fail(const File& f, const Stmt& st, const std::string& msg) const;
+
+    Operand operand(const File& f, const Stmt& st, const std::string& s) const;
+    bool constantGenerator(const File& f, const Operand& o, uint32_t here, bool pushOrCall, int& reg, int& as) const;
+
+    Device device_;
+    const MemoryMap& map_;
+    std::unordered_map<std::string, uint32_t> device_syms_;
+    std::vector<File> files_;
+    std::unordered_map<std::string, std::pair<const File*, std::string>> globals_;
+    bool linked_ = false;
+};
+
+
+Value Expr::parse()
+{
+    Value v = orExpr();
+    skip();
+    if (p_ != s_.size())
+    {
+        throw std::runtime_error("bad expression '" + s_ + "'");
+    }
+    return v;
+}
+
+
+Value Expr::orExpr()
+{
+    Value a = xorExpr();
+    while (true)
+    {
+        skip();
+        if (p_ < s_.size() && s_[p_] == '|' && (p_ + 1 >= s_.size() || s_[p_ + 1] != '|'))
+        {
+            p_++;
+            Value b = xorExpr();
+            a = combine(a, b, a.v | b.v);
+        }
+        else
+        {
+            return a;
+        }
+    }
+}
+
+
+Value Expr::xorExpr()
+{
+    Value a = andExpr();
+    while (eat("^"))
+    {
+        Value b = andExpr();
+        a = combine(a, b, a.v ^ b.v);
+    }
+    return a;
+}
+
+
+Value Expr::andExpr()
+{
+    Value a = shiftExpr();
+    while (true)
+    {
+        skip();
+        if (p_ < s_.size() && s_[p_] == '&' && (p_ + 1 >= s_.size() || s_[p_ + 1] != '&'))
+        {
+            p_++;
+            Value b = shiftExpr();
+            a = combine(a, b, a.v & b.v);
+        }
+        else
+        {
+            return a;
+        }
+    }
+}
+
+
+Value Expr::shiftExpr()
+{
+    Value a = addExpr();
+    while (true)
+    {
+        if (eat("<<"))
+        {
+            Value b = addExpr();
+            a = combine(a, b, a.v << b.v);
+        }
+        else if (eat(">>"))
+        {
+            Value b = addExpr();
+            a = combine(a, b, a.v >> b.v);
+        }
+        else
+        {
+            return a;
+        }
+    }
+}
+
+
+Value Expr::addExpr()
+{
+    Value a = mulExpr();
+    while (true)
+    {
+        if (eat("+"))
+        {
+            Value b = mulExpr();
+            a = combine(a, b, a.v + b.v);
+        }
+        else if (eat("-"))
+        {
+            Value b = mulExpr();
+            Value r = combine(a, b, a.v - b.v);
+            r.label = a.label != b.label;           // label - label is absolute
+            a = r;
+        }
+        else
+        {
+            return a;
+        }
+    }
+}
+
+
+Value Expr::mulExpr()
+{
+    Value a = unary();
+    while (true)
+    {
+        if (eat("*"))
+        {
+            Value b = unary();
+            a = combine(a, b, a.v * b.v);
+        }
+        else if (eat("/"))
+        {
+            Value b = unary();
+            a = combine(a, b, b.v ? a.v / b.v : 0);
+        }
+        else if (eat("%"))
+        {
+            Value b = unary();
+            a = combine(a, b, b.v ? a.v % b.v : 0);
+        }
+        else
+        {
+            return a;
+        }
+    }
+}
+
+
+Value Expr::unary()
+{
+    if (eat("-"))
+    {
+        Value a = unary();
+        a.v = -a.v;
+        return a;
+    }
+    if (eat("~"))
+    {
+        Value a = unary();
+        a.v = ~a.v;
+        return a;
+    }
+    if (eat("!"))
+    {
+        Value a = unary();
+        a.v = !a.v;
+        return a;
+    }
+    if (eat("+"))
+    {
+        return unary();
+    }
+    return primary();
+}
+
+
+Value Expr::primary()
+{
+    skip();
+    if (p_ >= s_.size())
+    {
+        throw std::runtime_error("missing operand in '" + s_ + "'");
+    }
+
+    if (eat("("))
+    {
+        Value v = orExpr();
+        if (!eat(")"))
+        {
+            throw std::runtime_error("missing ')' in '" + s_ + "'");
+        }
+        return v;
+    }
+
+    char c = s_[p_];
+    if (c == '\'' && p_ + 2 < s_.size() && s_[p_ + 2] == '\'')
+    {
+        p_ += 3;
+        return {(unsigned char)s_[p_ - 2], true, false};
+    }
+
+    if (std::isdigit((unsigned char)c))
+    {
+        size_t b = p_;
+        while (p_ < s_.size() && std::isalnum((unsigned char)s_[p_]))
+        {
+            p_++;
+        }
+        std::string t = lower(s_.substr(b, p_ - b));
+        int64_t v = 0;
+        char* end = nullptr;
+        if (t.size() > 2 && t[0] == '0' && t[1] == 'x')
+        {
+            v = std::strtoll(t.c_str() + 2, &end, 16);
+        }
+        else if (t.back() == 'h')
+        {
+            v = std::strtoll(t.substr(0, t.size() - 1).c_str(), &end, 16);
+        }
+        else if (t.back() == 'b' && t.find_first_not_of("01", 0) == t.size() - 1)
+        {
+            v = std::strtoll(t.substr(0, t.size() - 1).c_str(), &end, 2);
+        }
+        else if (t.back() == 'q')
+        {
+            v = std::strtoll(t.substr(0, t.size() - 1).c_str(), &end, 8);
+        }
+        else
+        {
+            v = std::strtoll(t.c_str(), &end, 10);
+        }
+        if (end && *end)
+        {
+            throw std::runtime_error("bad number '" + t + "'");
+        }
+        return {v, true, false};
+    }
+
+    if (c == '$' && (p_ + 1 >= s_.size() || !(std::isalnum((unsigned char)s_[p_ + 1]) || s_[p_ + 1] == '_')))
+    {
+        p_++;
+        return {here_, final_, true};
+    }
+
+    if (std::isalpha((unsigned char)c) || c == '_' || c == '.' || c == '$')
+    {
+        size_t b = p_;
+        while (p_ < s_.size() && (std::isalnum((unsigned char)s_[p_]) || s_[p_] == '_' || s_[p_] == '.' || s_[p_] == '$'))
+        {
+            p_++;
+        }
+        std::string name = s_.substr(b, p_ - b);
+        Value v;
+        if (!a_.lookup(f_, name, final_, v))
+        {
+            if (final_)
+            {
+                throw std::runtime_error("undefined symbol '" + name + "'");
+            }
+            return {0, false, true};
+        }
+        return v;
+    }
+
+    throw std::runtime_error("unexpected '" + std::string(1, c) + "' in '" + s_ + "'");
+}
+
+
+bool Assembler::lookup(const File& f, const std::string& name, bool final, Value& out, int depth) const
+{
+    if (depth > 16)
+    {
+        throw std::runtime_error("recursive .equ '" + name + "'");
+    }
+
+    auto label = [&](const File& file, const std::pair<std::string, uint32_t>& loc)
+    {
+        if (!final)
+        {
+            out = {0, false, true};
+        }
+        else
+        {
+            out = {(int64_t)(file.sections.at(loc.first).base + loc.second), true, true};
+        }
+        return true;
+    };
+
+    auto e = f.equs.find(name);
+    if (e != f.equs.end())
+    {
+        out = Expr(*this, f, e->second, 0, final).parse();
+        return true;
+    }
+    auto l = f.labels.find(name);
+    if (l != f.labels.end())
+    {
+        return label(f, l->second);
+    }
+    auto g = globals_.find(name);
+    if (g != globals_.end() && g->second.first != &f)
+    {
+        const File& other = *g->second.first;
+        auto ge = other.equs.find(name);
+        if (ge != other.equs.end())
+        {
+            out = Expr(*this, other, ge->second, 0, final).parse();
+            return true;
+        }
+        return label(other, other.labels.at(name));
+    }
+    auto d = device_syms_.find(name);
+    if (d != device_syms_.end())
+    {
+        out = {d->second, true, false};
+        return true;
+    }
+    if (name == "__STACK_END")
+    {
+        out = {map_.ramEnd, true, false};
+        return true;
+    }
+    return false;
+}
+
+
+Value Assembler::eval(const File& f, const std::string& s, uint32_t here, bool final) const
+{
+    return Expr(*this, f, s, here, final).parse();
+}
+
+
+int64_t Assembler::need(const File& f, const Stmt& st, const std::string& s, uint32_t here, bool final) const
+{
+    try
+    {
+        Value v = eval(f, s, here, final);
+        if (!v.known)
+        {
+            if (final)
+            {
+                fail(f, st, "cannot resolve '" + s + "'");
+            }
+            return 0;
+        }
+        return v.v;
+    }
+    catch (const std::runtime_error& e)
+    {
+        fail(f, st, e.what());
+    }
+}
+
+
+void Assembler::fail(const File& f, const Stmt& st, const std::string& msg) const
+{
+    throw std::runtime_error(f.path + ":" + std::to_string(st.line) + ": " + msg);
+}
+
+
+Operand Assembler::operand(const File& f, const Stmt& st, const std::string& s) const
+{
+    std::string t = trim(s);
+    if (t.empty())
+    {
+        fail(f, st, "missing operand");
+    }
+
+    if (t[0] == '#')
+    {
+        return {Mode::Immediate, 0, t.substr(1)};
+    }
+    if (t[0] == '&')
+    {
+        return {Mode::Absolute, 2, t.substr(1)};
+    }
+    if (t[0] == '@')
+    {
+        bool inc = t.back() == '+';
+        int r = regNumber(t.substr(1, t.size() - 1 - inc));
+        if (r < 0)
+        {
+            fail(f, st, "bad register in '" + t + "'");
+        }
+        return {inc ? Mode::AutoInc : Mode::Indirect, r, ""};
+    }
+    int r = regNumber(t);
+    if (r >= 0)
+    {
+        return {Mode::Reg, r, ""};
+    }
+    if (t.back() == ')')
+    {
+        size_t open = t.rfind('(');
+        int ir = open == std::string::npos ? -1 : regNumber(t.substr(open + 1, t.size() - open - 2));
+        if (ir >= 0)
+        {
+            std::string x = trim(t.substr(0, open));
+            return {Mode::Indexed, ir, x.empty() ? "0" : x};
+        }
+    }
+    return {Mode::Symbolic, 0, t};
+}
+
+
+bool Assembler::constantGenerator(const File& f, const Operand& o, uint32_t here, bool pushOrCall, int& reg, int& as) const
+/* asm430 uses R2/R3 for #-1/0/1/2/4/8 whenever the value is an absolute
+ * constant; PUSH #4/#8 are assembled long (CPU4 erratum on the original core)
+ */
+{
+    if (o.mode != Mode::Immediate)
+    {
+        return false;
+    }
+
+    Value v;
+    try
+    {
+        v = eval(f, o.expr, here, false);
+    }
+    catch (const std::runtime_error&)
+    {
+        return false;
+    }
+    if (!v.known || v.label)
+    {
+        return false;
+    }
+
+    switch (v.v)
+    {
+        case 0:  reg = 3; as = 0; return true;
+        case 1:  reg = 3; as = 1; return true;
+        case 2:  reg = 3; as = 2; return true;
+        case -1: reg = 3; as = 3; return true;
+        case 4:  reg = 2; as = 2; return !pushOrCall;
+        case 8:  reg = 2; as = 3; return !pushOrCall;
+        default: return false;
+    }
+}
+
+
+
+//// Mnemonic Tables
+struct Emulated
+{
+    const char* name;
+    const char* base;
+    const char* src;                    // "" -> the operand is used as source; "=" -> operand twice
+    bool hasOperand;
+};
+
+const Emulated emulated[] = {
+    {"adc",  "addc", "#0", true},
+    {"dadc", "dadd", "#0", true},
+    {"dec",  "sub",  "#1", true},
+    {"decd", "sub",  "#2", true},
+    {"inc",  "add",  "#1", true},
+    {"incd", "add",  "#2", true},
+    {"sbc",  "subc", "#0", true},
+    {"inv",  "xor",  "#-1", true},
+    {"rla",  "add",  "=", true},
+    {"rlc",  "addc", "=", true},
+    {"tst",  "cmp",  "#0", true},
+    {"clr",  "mov",  "#0", true},
+    {"pop",  "mov",  "@SP+", true},
+    {"br",   "mov",  "", true},
+    {"ret",  "mov",  "@SP+,PC", false},
+    {"nop",  "mov",  "#0,R3", false},
+    {"clrc", "bic",  "#1,SR", false},
+    {"setc", "bis",  "#1,SR", false},
+    {"clrz", "bic",  "#2,SR", false},
+    {"setz", "bis",  "#2,SR", false},
+    {"clrn", "bic",  "#4,SR", false},
+    {"setn", "bis",  "#4,SR", false},
+    {"dint", "bic",  "#8,SR", false},
+    {"eint", "bis",  "#8,SR", false},
+};
+
+const char* const formatI[] = {"mov", "add", "addc", "subc", "sub", "cmp", "dadd", "bit", "bic", "bis", "xor", "and"};
+const char* const formatII[] = {"rrc", "swpb", "rra", "sxt", "push", "call"};
+const char* const jumps[] = {"jne", "jeq", "jnc", "jc", "jn", "jge", "jl", "jmp"};
+
+int indexOf(const char* const* table, size_t n, const std::string& s)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        if (s == table[i])
+        {
+            return (int)i;
+        }
+    }
+    return -1;
+}
+
+int jumpCode(const std::string& s)
+{
+    if (s == "jnz") return 0;
+    if (s == "jz") return 1;
+    if (s == "jlo") return 2;
+    if (s == "jhs") return 3;
+    return indexOf(jumps, 8, s);
+}
+
+
+struct Mnemonic
+{
+    std::string base;                   // without size suffix / X
+    unsigned bits = 16;                 // 8, 16, 20
+    bool sized = false;                 // suffix written
+    bool ext = false;                   // X form (extension word)
+    bool zc = false;                    // RRUX
+};
+
+Mnemonic splitMnemonic(const std::string& op)
+{
+    Mnemonic m;
+    std::string s = op;
+    size_t dot = s.find('.');
+    if (dot != std::string::npos)
+    {
+        std::string suffix = s.substr(dot + 1);
+        s = s.substr(0, dot);
+        m.sized = true;
+        m.bits = suffix == "b" ? 8 : suffix == "a" ? 20 : 16;
+    }
+
+    if (s == "rrux")
+    {
+        m.base = "rrc";
+        m.ext = m.zc = true;
+        return m;
+    }
+
+    auto known = [](const std::string& b)
+    {
+        if (indexOf(formatI, 12, b) >= 0 || indexOf(formatII, 6, b) >= 0)
+        {
+            return true;
+        }
+        for (const Emulated& e : emulated)
+        {
+            if (b == e.name)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (!known(s) && s.size() > 1 && s.back() == 'x' && known(s.substr(0, s.size() - 1)))
+    {
+        s.pop_back();
+        m.ext = true;
+    }
+    m.base = s;
+    return m;
+}
+
+
+
+//// Assembler: Driver
+Image Assembler::run(const std::vector<std::string>& paths)
+{
+    for (const std::string& p : paths)
+    {
+        File f;
+        f.path = p;
+        read(f);
+        files_.push_back(std::move(f));
+    }
+
+    for (File& f : files_)
+    {
+        pass1(f);
+    }
+    for (File& f : files_)
+    {
+        for (const std::string& g : f.globals)
+        {
+            if (f.labels.count(g) || f.equs.count(g))
+            {
+                if (globals_.count(g))
+                {
+                    throw std::runtime_error(f.path + ": '" + g + "' also defined in " + globals_[g].first->path);
+                }
+                globals_[g] = {&f, g};
+            }
+        }
+    }
+
+    link();
+
+    Image img;
+    img.device = device_;
+    for (File& f : files_)
+    {
+        pass2(f, img);
+    }
+
+    // CCS assembly projects name RESET as the entry point (used when the
+    // vector table has no .reset word)
+    for (const Label& l : img.labels)
+    {
+        if (l.global && l.name == "RESET")
+        {
+            img.entry = l.addr;
+        }
+    }
+
+    // one segment per section, in address order
+    std::sort(img.segments.begin(), img.segments.end(),
+              [](const Segment& a, const Segment& b) { return a.addr < b.addr; });
+    return img;
+}
+
+
+void Assembler::read(File& f)
+{
+    std::ifstream in(f.path);
+    if (!in)
+    {
+        throw std::runtime_error(f.path + ": cannot open");
+    }
+
+    std::string line;
+    int n = 0;
+    while (std::getline(in, line))
+    {
+        n++;
+        Stmt st = parseLine(line, n);
+        if (st.op == ".end")
+        {
+            if (!st.label.empty())
+            {
+                st.op.clear();
+                f.stmts.push_back(st);
+            }
+            break;
+        }
+        if (!st.label.empty() || !st.op.empty())
+        {
+            f.stmts.push_back(st);
+        }
+    }
+}
+
+
+
+//// Assembler: Pass 1 (sizes, label offsets)
+void Assembler::pass1(File& f)
+{
+    std::string section = ".text";
+    int repeat = 0;
+
+    auto use = [&](const std::string& name)
+    {
+        section = name;
+        if (!f.sections.count(name))
+        {
+            f.sections[name] = {};
+            f.sectionOrder.push_back(name);
+        }
+    };
+    use(".text");
+
+    for (Stmt& st : f.stmts)
+    {
+        const std::string& op = st.op;
+
+        // directives that define the label themselves or switch sections
+        if (op == ".equ" || op == ".set")
+        {
+            if (st.label.empty() || st.args.size() != 1)
+            {
+                fail(f, st, op + " needs 'name " + op + " value'");
+            }
+            f.equs[st.label] = st.args[0];
+            continue;
+        }
+        if (op == ".text" || op == ".data" || op == ".bss" || op == ".sect" || op == ".usect")
+        {
+            if (op == ".bss" && !st.args.empty())
+            {
+                // .bss symbol, size[, alignment]
+                if (st.args.size() < 2)
+                {
+                    fail(f, st, ".bss needs 'symbol, size'");
+                }
+                std::string keep = section;
+                use(".bss");
+                SectionPart& p = f.sections[".bss"];
+                p.size = (p.size + 1) & ~1u;
+                f.labels[st.args[0]] = {".bss", p.size};
+                p.size += (uint32_t)need(f, st, st.args[1], 0, false);
+                use(keep);
+                continue;
+            }
+            if (op == ".sect" || op == ".usect")
+            {
+                if (st.args.empty())
+                {
+                    fail(f, st, op + " needs a section name");
+                }
+                std::string name = st.args[0];
+                if (name.size() >= 2 && name.front() == '"' && name.back() == '"')
+                {
+                    name = name.substr(1, name.size() - 2);
+                }
+                if (op == ".usect")
+                {
+                    // symbol .usect "section", size
+                    std::string keep = section;
+                    use(name);
+                    SectionPart& p = f.sections[name];
+                    p.size = (p.size + 1) & ~1u;
+                    if (!st.label.empty())
+                    {
+                        f.labels[st.label] = {name, p.size};
+                    }
+                    p.size += st.args.size() > 1 ? (uint32_t)need(f, st, st.args[1], 0, false) : 0;
+                    use(keep);
+                    continue;
+                }
+                use(name);
+            }
+            else
+            {
+                use(op);
+            }
+        }
+
+        SectionPart& part = f.sections[section];
+        st.section = section;
+
+        // alignment of data/code
+        bool code = !op.empty() && op[0] != '.';
+        if (code || op == ".word" || op == ".int" || op == ".short" || op == ".uword" || op == ".long" || op == ".even")
+        {
+            part.size = (part.size + 1) & ~1u;
+        }
+        if (op == ".align")
+        {
+            uint32_t a = st.args.empty() ? 2 : (uint32_t)need(f, st, st.args[0], 0, false);
+            if (a == 0 || (a & (a - 1)))
+            {
+                fail(f, st, ".align needs a power of 2");
+            }
+            part.size = (part.size + a - 1) & ~(a - 1);
+        }
+
+        st.offset = part.size;
+        if (!st.label.empty())
+        {
+            if (f.labels.count(st.label) || f.equs.count(st.label))
+            {
+                fail(f, st, "label '" + st.label + "' redefined");
+            }
+            f.labels[st.label] = {section, st.offset};
+        }
+
+        if (op == ".def" || op == ".global" || op == ".globl")
+        {
+            for (const std::string& a : st.args)
+            {
+                f.globals.push_back(a);
+            }
+            continue;
+        }
+
+        if (op == "rpt")
+        {
+            if (st.args.size() != 1)
+            {
+                fail(f, st, "rpt needs '#n' or 'Rn'");
+            }
+            int r = regNumber(st.args[0]);
+            if (r >= 0)
+            {
+                repeat = -(r + 1);
+            }
+            else if (st.args[0][0] == '#')
+            {
+                int64_t n = need(f, st, st.args[0].substr(1), 0, false);
+                if (n < 1 || n > 16)
+                {
+                    fail(f, st, "rpt count must be 1..16");
+                }
+                repeat = (int)n;
+            }
+            else
+            {
+                fail(f, st, "rpt needs '#n' or 'Rn'");
+            }
+            continue;
+        }
+        st.repeat = repeat;
+        if (code)
+        {
+            repeat = 0;
+        }
+
+        st.size = statementSize(f, st, 0);
+        part.size += st.size;
+    }
+}
+
+
+
+//// Assembler: Linker
+void Assembler::link()
+{
+    auto isRam = [](const std::string& s)
+    {
+        return s == ".bss" || s == ".data" || s == ".sysmem" || s == ".TI.noinit" || s == ".cio" || s == ".stack";
+    };
+    auto vectorOf = [&](const std::string& s) -> int
+    {
+        if (s == ".reset")
+        {
+            return map_.vectors - 1;
+        }
+        if (s.size() > 4 && s.compare(0, 4, ".int") == 0 && std::isdigit((unsigned char)s[4]))
+        {
+            return std::atoi(s.c_str() + 4);
+        }
+        return -1;
+    };
+
+    // section order: as the linker command file allocates them
+    std::vector<std::string> ram = {".bss", ".data"};
+    std::vector<std::string> flash = {".text"};
+    std::vector<std::string> vectors;
+    for (File& f : files_)
+    {
+        for (const std::string& s : f.sectionOrder)
+        {
+            std::vector<std::string>& group = vectorOf(s) >= 0 ? vectors : isRam(s) ? ram : flash;
+            if (std::find(group.begin(), group.end(), s) == group.end())
+            {
+                group.push_back(s);
+            }
+        }
+    }
+
+    auto place = [&](const std::vector<std::string>& group, uint32_t addr, uint32_t end, const char* region)
+    {
+        for (const std::string& s : group)
+        {
+            for (File& f : files_)
+            {
+                auto it = f.sections.find(s);
+                if (it == f.sections.end())
+                {
+                    continue;
+                }
+                addr = (addr + 1) & ~1u;
+                it->second.base = addr;
+                addr += it->second.size;
+            }
+        }
+        if (addr > end)
+        {
+            throw std::runtime_error(std::string("program does not fit in ") + region);
+        }
+    };
+    place(ram, map_.ramStart, map_.ramEnd, "RAM");
+    place(flash, map_.flashStart, map_.flashEnd, "FLASH");
+
+    for (const std::string& s : vectors)
+    {
+        int v = vectorOf(s);
+        if (v >= map_.vectors)
+        {
+            throw std::runtime_error("no interrupt vector " + s + " on " + deviceName(device_));
+        }
+        uint32_t used = 0;
+        for (File& f : files_)
+        {
+            auto it = f.sections.find(s);
+            if (it != f.sections.end())
+            {
+                it->second.base = map_.vectorBase + 2 * v + used;
+                used += it->second.size;
+            }
+        }
+        if (used > 2)
+        {
+            throw std::runtime_error("vector section " + s + " holds more than one word");
+        }
+    }
+
+    linked_ = true;
+}
+
+
+
+//// Assembler: Pass 2 (encoding)
+void Assembler::pass2(File& f, Image& img)
+{
+    auto segment = [&](const std::string& name) -> Segment&
+    {
+        for (Segment& s : img.segments)
+        {
+            if (s.name == name)
+            {
+                return s;
+            }
+        }
+        uint32_t lo = UINT32_MAX;
+        for (const File& other : files_)
+        {
+            auto it = other.sections.find(name);
+            if (it != other.sections.end() && it->second.base < lo)
+            {
+                lo = it->second.base;
+            }
+        }
+        img.segments.push_back({name, lo, {}});
+        return img.segments.back();
+    };
+
+    for (Stmt& st : f.stmts)
+    {
+        if (st.section.empty())
+        {
+            continue;
+        }
+        uint32_t here = f.sections[st.section].base + st.offset;
+
+        std::vector<uint8_t> bytes = encode(f, st, here, true);
+        if (bytes.size() != st.size)
+        {
+            fail(f, st, "internal error: size changed between passes");
+        }
+
+        if (!st.op.empty() && st.op[0] != '.')
+        {
+            img.lines[here] = {f.path, st.line, st.text};
+        }
+        if (bytes.empty())
+        {
+            continue;
+        }
+
+        Segment& seg = segment(st.section);
+        uint32_t at = here - seg.addr;
+        if (seg.bytes.size() < at + bytes.size())
+        {
+            seg.bytes.resize(at + bytes.size(), 0xFF);
+        }
+        std::copy(bytes.begin(), bytes.end(), seg.bytes.begin() + at);
+    }
+
+    // .bss emits nothing, but is zeroed as the C startup code does (and so
+    // shows up in the image's RAM extent)
+    auto bss = f.sections.find(".bss");
+    if (bss != f.sections.end() && bss->second.size)
+    {
+        Segment& seg = segment(".bss");
+        uint32_t end = bss->second.base + bss->second.size - seg.addr;
+        if (seg.bytes.size() < end)
+        {
+            seg.bytes.resize(end, 0);
+        }
+    }
+
+    // labels in source order, so describe() picks the last of several at one address
+    std::vector<std::pair<int, std::string>> order;
+    for (const Stmt& st : f.stmts)
+    {
+        if (!st.label.empty() && f.labels.count(st.label))
+        {
+            order.push_back({st.line, st.label});
+        }
+        if (st.op == ".bss" && !st.args.empty())
+        {
+            order.push_back({st.line, st.args[0]});
+        }
+    }
+    for (auto& [line, name] : order)
+    {
+        const auto& loc = f.labels.at(name);
+        bool global = std::find(f.globals.begin(), f.globals.end(), name) != f.globals.end();
+        img.labels.push_back({name, f.sections[loc.first].base + loc.second, global});
+    }
+}
+
+
+uint32_t Assembler::statementSize(File& f, Stmt& st, uint32_t here)
+{
+    return (uint32_t)encode(f, st, here, false).size();
+}
+
+
+
+//// Assembler: Encoding
+namespace enc
+{
+
+void word(std::vector<uint8_t>& out, uint32_t w)
+{
+    out.push_back(w & 0xFF);
+    out.push_back((w >> 8) & 0xFF);
+}
+
+}   // namespace enc
+
+
+std::vector<uint8_t> Assembler::encode(File& f, Stmt& st, uint32_t here, bool final)
+{
+    std::vector<uint8_t> out;
+    const std::string& op = st.op;
+
+    if (op.empty() || op == ".cdecls" || op == ".def" || op == ".ref" || op == ".global" || op == ".globl" ||
+        op == ".text" || op == ".data" || op == ".sect" || op == ".bss" || op == ".retain" || op == ".retainrefs" ||
+        op == ".align" || op == ".even" || op == ".equ" || op == ".set" || op == ".usect" || op == "rpt" ||
+        op == ".title" || op == ".width" || op == ".length" || op == ".list" || op == ".nolist" || op == ".newblock")
+    {
+        return out;
+    }
+
+    // data
+    if (op == ".byte" || op == ".char" || op == ".ubyte" || op == ".word" || op == ".int" || op == ".short" ||
+        op == ".uword" || op == ".uint" || op == ".long" || op == ".string" || op == ".cstring")
+    {
+        unsigned width = (op == ".byte" || op == ".char" || op == ".ubyte" || op == ".string" || op == ".cstring") ? 1
+                         : op == ".long" ? 4 : 2;
+        for (const std::string& a : st.args)
+        {
+            if (a.size() >= 2 && a.front() == '"' && a.back() == '"')
+            {
+                for (size_t i = 1; i + 1 < a.size(); i++)
+                {
+                    char c = a[i];
+                    if (c == '\\' && op == ".cstring" && i + 2 < a.size())
+                    {
+                        char e = a[++i];
+                        c = e == 'n' ? '\n' : e == 'r' ? '\r' : e == 't' ? '\t' : e == '0' ? '\0' : e;
+                    }
+                    else if (c == '"' && a[i + 1] == '"')
+                    {
+                        i++;            // "" inside a string is one quote
+                    }
+                    out.push_back((uint8_t)c);
+                }
+                continue;
+            }
+            int64_t v = need(f, st, a, here, final);
+            for (unsigned b = 0; b < width; b++)
+            {
+                out.push_back((uint8_t)(v >> (8 * b)));
+            }
+        }
+        if (op == ".cstring")
+        {
+            out.push_back(0);
+        }
+        return out;
+    }
+    if (op == ".space" || op == ".bes")
+    {
+        out.assign((size_t)need(f, st, st.args.empty() ? "" : st.args[0], here, false), 0);
+        return out;
+    }
+    if (op == ".field" || op == ".float" || op == ".double")
+    {
+        fail(f, st, op + " is not supported by the host assembler");
+    }
+    if (op[0] == '.')
+    {
+        fail(f, st, "unknown directive " + op);
+    }
+
+    Mnemonic m = splitMnemonic(op);
+    std::vector<std::string> args = st.args;
+
+    // emulated instructions -> core instruction
+    for (const Emulated& e : emulated)
+    {
+        if (m.base != e.name)
+        {
+            continue;
+        }
+        if (e.hasOperand != (args.size() == 1))
+        {
+            fail(f, st, op + (e.hasOperand ? " takes one operand" : " takes no operand"));
+        }
+        std::string src = e.src;
+        if (!e.hasOperand)
+        {
+            args = splitArgs(src);
+        }
+        else if (src == "=")
+        {
+            args = {args[0], args[0]};
+        }
+        else if (src.empty())
+        {
+            args = {args[0], "PC"};         // br src
+        }
+        else
+        {
+            args = {src, args[0]};
+        }
+        m.base = e.base;
+        break;
+    }
+
+    auto ext16 = [&](int64_t v) { enc::word(out, (uint32_t)v & 0xFFFF); };
+    auto needArgs = [&](size_t n)
+    {
+        if (args.size() != n)
+        {
+            fail(f, st, op + " takes " + std::to_string(n) + " operand" + (n == 1 ? "" : "s"));
+        }
+    };
+
+    // jumps
+    int j = jumpCode(m.base);
+    if (j >= 0)
+    {
+        needArgs(1);
+        int64_t target = need(f, st, args[0], here, final);
+        int64_t off = final ? (target - (int64_t)(here + 2)) : 0;
+        if (final && ((off & 1) || off < -1024 || off > 1022))
+        {
+            fail(f, st, "jump target out of range");
+        }
+        enc::word(out, 0x2000 | (j << 10) | ((off / 2) & 0x3FF));
+        return out;
+    }
+
+    // RETI
+    if (m.base == "reti")
+    {
+        needArgs(0);
+        enc::word(out, 0x1300);
+        return out;
+    }
+
+    // operand fields shared by format I/II and the X forms
+    struct Field
+    {
+        int reg = 0, as = 0;            // as: As for source, Ad (0/1) for destination
+        bool hasWord = false;
+        int64_t word = 0;               // extension word value (20 bits with X)
+    };
+
+    auto source = [&](const Operand& o, uint32_t wordAddr, bool pushOrCall) -> Field
+    {
+        Field fl;
+        int cgReg, cgAs;
+        switch (o.mode)
+        {
+            case Mode::Reg:
+                fl.reg = o.reg;
+                break;
+            case Mode::Indirect:
+                fl.reg = o.reg;
+                fl.as = 2;
+                break;
+            case Mode::AutoInc:
+                fl.reg = o.reg;
+                fl.as = 3;
+                break;
+            case Mode::Immediate:
+                if (constantGenerator(f, o, here, pushOrCall, cgReg, cgAs))
+                {
+                    fl.reg = cgReg;
+                    fl.as = cgAs;
+                    break;
+                }
+                fl.reg = 0;
+                fl.as = 3;
+                fl.hasWord = true;
+                fl.word = need(f, st, o.expr, here, final);
+                break;
+            case Mode::Indexed:
+                fl.reg = o.reg;
+                fl.as = 1;
+                fl.hasWord = true;
+                fl.word = need(f, st, o.expr, here, final);
+                break;
+            case Mode::Absolute:
+                fl.reg = 2;
+                fl.as = 1;
+                fl.hasWord = true;
+                fl.word = need(f, st, o.expr, here, final);
+                break;
+            case Mode::Symbolic:
+                fl.reg = 0;
+                fl.as = 1;
+                fl.hasWord = true;
+                fl.word = final ? need(f, st, o.expr, here, final) - wordAddr : 0;
+                break;
+        }
+        return fl;
+    };
+
+    auto destination = [&](const Operand& o, uint32_t wordAddr) -> Field
+    {
+        Field fl;
+        switch (o.mode)
+        {
+            case Mode::Reg:
+                fl.reg = o.reg;
+                break;
+            case Mode::Indexed:
+                fl.reg = o.reg;
+                fl.as = 1;
+                fl.hasWord = true;
+                fl.word = need(f, st, o.expr, here, final);
+                break;
+            case Mode::Absolute:
+                fl.reg = 2;
+                fl.as = 1;
+                fl.hasWord = true;
+                fl.word = need(f, st, o.expr, here, final);
+                break;
+            case Mode::Symbolic:
+                fl.reg = 0;
+                fl.as = 1;
+                fl.hasWord = true;
+                fl.word = final ? need(f, st, o.expr, here, final) - wordAddr : 0;
+                break;
+            default:
+                fail(f, st, "destination must be Rn, x(Rn), EDE or &EDE");
+        }
+        return fl;
+    };
+
+    // extension word of the X forms
+    auto extensionWord = [&](const Field& s, const Field* d, bool registerMode) -> uint32_t
+    {
+        unsigned al = m.bits == 20 ? 0 : 1;
+        if (registerMode)
+        {
+            uint32_t w = 0x1800 | (m.zc << 8) | (al << 6);
+            if (st.repeat > 0)
+            {
+                w |= st.repeat - 1;
+            }
+            else if (st.repeat < 0)
+            {
+                w |= 0x80 | (-st.repeat - 1);
+            }
+            return w;
+        }
+        if (st.repeat)
+        {
+            fail(f, st, "rpt only applies to register-mode instructions");
+        }
+        uint32_t w = 0x1800 | (al << 6);
+        if (s.hasWord)
+        {
+            w |= ((s.word >> 16) & 0xF) << 7;
+        }
+        if (d && d->hasWord)
+        {
+            w |= (d->word >> 16) & 0xF;
+        }
+        return w;
+    };
+
+    if (!m.ext && m.bits == 20 && (indexOf(formatI, 12, m.base) >= 0 || indexOf(formatII, 6, m.base) >= 0))
+    {
+        fail(f, st, ".a needs the X form (" + m.base + "x.a)");
+    }
+    if (!m.ext && st.repeat)
+    {
+        fail(f, st, "rpt must be followed by an X instruction");
+    }
+    unsigned bw = m.bits == 8 || m.bits == 20 ? 1 : 0;
+
+    // format I
+    int opI = indexOf(formatI, 12, m.base);
+    if (opI >= 0)
+    {
+        needArgs(2);
+        Operand so = operand(f, st, args[0]);
+        Operand dop = operand(f, st, args[1]);
+        uint32_t first = here + (m.ext ? 4 : 2);
+
+        Field s = source(so, first, false);
+        uint32_t dAddr = first + (s.hasWord ? 2 : 0);
+        Field d = destination(dop, dAddr);
+
+        if (m.ext)
+        {
+            enc::word(out, extensionWord(s, &d, s.as == 0 && d.as == 0));
+        }
+        enc::word(out, ((opI + 4) << 12) | (s.reg << 8) | (d.as << 7) | (bw << 6) | (s.as << 4) | d.reg);
+        if (s.hasWord)
+        {
+            ext16(s.word);
+        }
+        if (d.hasWord)
+        {
+            ext16(d.word);
+        }
+        return out;
+    }
+
+    // format II
+    int opII = indexOf(formatII, 6, m.base);
+    if (opII >= 0)
+    {
+        needArgs(1);
+        Operand o = operand(f, st, args[0]);
+        if ((opII == 1 || opII == 3 || opII == 5) && m.bits == 8)
+        {
+            fail(f, st, m.base + " has no byte form");
+        }
+        if (o.mode == Mode::Immediate && opII < 4)
+        {
+            fail(f, st, m.base + " cannot take an immediate");
+        }
+        Field s = source(o, here + (m.ext ? 4 : 2), opII >= 4);
+        if (m.ext)
+        {
+            enc::word(out, extensionWord(s, nullptr, s.as == 0));
+        }
+        unsigned b = opII == 5 ? 0 : bw;
+        enc::word(out, 0x1000 | (opII << 7) | (b << 6) | (s.as << 4) | s.reg);
+        if (s.hasWord)
+        {
+            ext16(s.word);
+        }
+        return out;
+    }
+
+    // address instructions (MSP430X)
+    auto imm20 = [&](const Operand& o) { return need(f, st, o.expr, here, final) & 0xFFFFF; };
+
+    if (m.base == "reta")
+    {
+        needArgs(0);
+        enc::word(out, 0x0110);                 // MOVA @SP+,PC
+        return out;
+    }
+    if (m.base == "bra" || m.base == "clra" || m.base == "decda" || m.base == "incda" || m.base == "tsta")
+    {
+        needArgs(1);
+        if (m.base == "bra")
+        {
+            args = {args[0], "PC"};
+            m.base = "mova";
+        }
+        else if (m.base == "clra")
+        {
+            Operand d = operand(f, st, args[0]);
+            if (d.mode != Mode::Reg)
+            {
+                fail(f, st, "clra takes a register");
+            }
+            enc::word(out, 0x4300 | d.reg);     // MOV #0,Rdst clears all 20 bits
+            return out;
+        }
+        else
+        {
+            m.base = m.base == "decda" ? "suba" : m.base == "incda" ? "adda" : "cmpa";
+            args = {m.base == "cmpa" ? "#0" : "#2", args[0]};
+        }
+    }
+
+    if (m.base == "mova" || m.base == "cmpa" || m.base == "adda" || m.base == "suba")
+    {
+        needArgs(2);
+        Operand s = operand(f, st, args[0]);
+        Operand d = operand(f, st, args[1]);
+        unsigned arith = m.base == "cmpa" ? 1 : m.base == "adda" ? 2 : m.base == "suba" ? 3 : 0;
+
+        if (arith)
+        {
+            if (d.mode != Mode::Reg)
+            {
+                fail(f, st, m.base + " needs a register destination");
+            }
+            if (s.mode == Mode::Reg)
+            {
+                enc::word(out, 0x00C0 | (arith << 4) | (s.reg << 8) | d.reg);
+            }
+            else if (s.mode == Mode::Immediate)
+            {
+                int64_t v = imm20(s);
+                enc::word(out, 0x0080 | (arith << 4) | (((v >> 16) & 0xF) << 8) | d.reg);
+                ext16(v);
+            }
+            else
+            {
+                fail(f, st, m.base + " source must be #imm20 or Rsrc");
+            }
+            return out;
+        }
+
+        if (d.mode == Mode::Reg)
+        {
+            switch (s.mode)
+            {
+                case Mode::Indirect:
+                    enc::word(out, 0x0000 | (s.reg << 8) | d.reg);
+                    return out;
+                case Mode::AutoInc:
+                    enc::word(out, 0x0010 | (s.reg << 8) | d.reg);
+                    return out;
+                case Mode::Absolute:
+                {
+                    int64_t a = imm20(s);
+                    enc::word(out, 0x0020 | (((a >> 16) & 0xF) << 8) | d.reg);
+                    ext16(a);
+                    return out;
+                }
+                case Mode::Indexed:
+                    enc::word(out, 0x0030 | (s.reg << 8) | d.reg);
+                    ext16(need(f, st, s.expr, here, final));
+                    return out;
+                case Mode::Symbolic:
+                    enc::word(out, 0x0030 | (0 << 8) | d.reg);
+                    ext16(final ? need(f, st, s.expr, here, final) - (here + 2) : 0);
+                    return out;
+                case Mode::Immediate:
+                {
+                    int64_t v = imm20(s);
+                    enc::word(out, 0x0080 | (((v >> 16) & 0xF) << 8) | d.reg);
+                    ext16(v);
+                    return out;
+                }
+                case Mode::Reg:
+                    enc::word(out, 0x00C0 | (s.reg << 8) | d.reg);
+                    return out;
+            }
+        }
+        if (s.mode != Mode::Reg)
+        {
+            fail(f, st, "mova to memory needs a register source");
+        }
+        if (d.mode == Mode::Absolute)
+        {
+            int64_t a = imm20(d);
+            enc::word(out, 0x0060 | (s.reg << 8) | ((a >> 16) & 0xF));
+            ext16(a);
+            return out;
+        }
+        if (d.mode == Mode::Indexed || d.mode == Mode::Symbolic)
+        {
+            int64_t x = d.mode == Mode::Indexed ? need(f, st, d.expr, here, final)
+                                                : (final ? need(f, st, d.expr, here, final) - (here + 2) : 0);
+            enc::word(out, 0x0070 | (s.reg << 8) | (d.mode == Mode::Indexed ? d.reg : 0));
+            ext16(x);
+            return out;
+        }
+        fail(f, st, "bad mova destination");
+    }
+
+    if (m.base == "calla")
+    {
+        needArgs(1);
+        Operand o = operand(f, st, args[0]);
+        switch (o.mode)
+        {
+            case Mode::Reg:      enc::word(out, 0x1340 | o.reg); break;
+            case Mode::Indexed:  enc::word(out, 0x1350 | o.reg); ext16(need(f, st, o.expr, here, final)); break;
+            case Mode::Indirect: enc::word(out, 0x1360 | o.reg); break;
+            case Mode::AutoInc:  enc::word(out, 0x1370 | o.reg); break;
+            case Mode::Absolute:
+            {
+                int64_t a = imm20(o);
+                enc::word(out, 0x1380 | ((a >> 16) & 0xF));
+                ext16(a);
+                break;
+            }
+            case Mode::Symbolic:
+            {
+                int64_t x = final ? (need(f, st, o.expr, here, final) - (here + 2)) & 0xFFFFF : 0;
+                enc::word(out, 0x1390 | ((x >> 16) & 0xF));
+                ext16(x);
+                break;
+            }
+            case Mode::Immediate:
+            {
+                int64_t a = imm20(o);
+                enc::word(out, 0x13B0 | ((a >> 16) & 0xF));
+                ext16(a);
+                break;
+            }
+        }
+        return out;
+    }
+
+    if (m.base == "pushm" || m.base == "popm" || m.base == "rrcm" || m.base == "rram" || m.base == "rlam" ||
+        m.base == "rrum")
+    {
+        needArgs(2);
+        if (args[0].empty() || args[0][0] != '#')
+        {
+            fail(f, st, m.base + " needs '#n, Rn'");
+        }
+        int64_t n = need(f, st, args[0].substr(1), here, false);
+        Operand d = operand(f, st, args[1]);
+        if (d.mode != Mode::Reg)
+        {
+            fail(f, st, m.base + " needs '#n, Rn'");
+        }
+        bool a = m.bits == 20;
+        if (m.base == "pushm" || m.base == "popm")
+        {
+            if (n < 1 || n > 16 || (m.base == "pushm" ? d.reg - n + 1 < 0 : d.reg - n + 1 < 0))
+            {
+                fail(f, st, "register count out of range");
+            }
+            unsigned base = m.base == "pushm" ? (a ? 0x1400 : 0x1500) : (a ? 0x1600 : 0x1700);
+            unsigned reg = m.base == "pushm" ? d.reg : d.reg - n + 1;
+            enc::word(out, base | ((n - 1) << 4) | reg);
+            return out;
+        }
+        if (n < 1 || n > 4)
+        {
+            fail(f, st, "shift count must be 1..4");
+        }
+        unsigned kind = m.base == "rrcm" ? 0 : m.base == "rram" ? 1 : m.base == "rlam" ? 2 : 3;
+        enc::word(out, (a ? 0x0040 : 0x0050) | ((n - 1) << 10) | (kind << 8) | d.reg);
+        return out;
+    }
+
+    fail(f, st, "unknown instruction '" + op + "'");
+}
+
+}   // namespace
+
+
+
+//// Loaders
+Image assemble(const std::vector<std::string>& files, Device device)
+{
+    Assembler a(device);
+    return a.run(files);
+}
+
+}   // namespace hostsim
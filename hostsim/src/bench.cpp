@@ -0,0 +1,203 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        bench.cpp
+ * Description:     Kernel registry, input helpers and the instruction-set model
+ *              harness of the benchmark suite (see bench.h)
+ *
+ * Input:       kernel target specs, generated inputs
+ * Output:      MCLK cycles per routine call, output checksums
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+#include "hostsim/peripherals.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+std::vector<Kernel>& kernels()
+{
+    static std::vector<Kernel> registry;            // filled by static KernelRegistrar objects
+    return registry;
+}
+
+
+uint64_t Rng::next()
+{
+    s ^= s >> 12;
+    s ^= s << 25;
+    s ^= s >> 27;
+    return s * 0x2545F4914F6CDD1Dull;
+}
+
+
+int32_t Rng::range(int32_t lo, int32_t hi)
+{
+    return lo + (int32_t)(next() % ((uint64_t)((int64_t)hi - lo) + 1));
+}
+
+
+uint64_t checksum(const void* data, size_t bytes, uint64_t seed)
+{
+    uint64_t h = seed ? seed : 0xCBF29CE484222325ull;
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < bytes; i++)
+    {
+        h = (h ^ p[i]) * 0x100000001B3ull;
+    }
+    return h;
+}
+
+
+
+//// Target
+Target::Target(const TargetSpec& spec, const std::string& root)
+    : spec_(spec)
+{
+    std::vector<std::string> files;
+    for (const std::string& f : spec.files)
+    {
+        files.push_back(root.empty() ? f : root + "/" + f);
+    }
+    image_ = assemble(files, spec.device);
+
+    // input areas start above everything the program placed in RAM and FLASH
+    const MemoryMap& map = memoryMap(spec.device);
+    heapStart_ = map.ramStart;
+    flashStart_ = map.flashStart;
+    for (const Segment& s : image_.segments)
+    {
+        uint32_t end = s.addr + (uint32_t)s.bytes.size();
+        if (s.addr >= map.ramStart && s.addr < map.ramEnd && end > heapStart_)
+        {
+            heapStart_ = end;
+        }
+        if (s.addr >= map.flashStart && s.addr < map.flashEnd && end > flashStart_)
+        {
+            flashStart_ = end;
+        }
+    }
+    heapStart_ = (heapStart_ + 1) & ~1u;
+    heapEnd_ = map.ramEnd - 256;
+    heap_ = heapStart_;
+    flashStart_ = (flashStart_ + 1) & ~1u;
+    flashEnd_ = map.flashEnd;
+    flash_ = flashStart_;
+}
+
+
+Target::~Target() = default;
+
+
+void Target::prepare()
+{
+    cpu_.reset();
+    m_ = makeMachine(spec_.device);
+    m_->setTimeLimit(1000 * PS_PER_S);
+    m_->write(symbolValue(spec_.device, "WDTCTL"), 16, 0x5A80);     // WDTPW | WDTHOLD
+
+    cpu_ = std::make_unique<Cpu>(*m_, coreOf(spec_.device));
+    cpu_->load(image_);
+    cpu_->setReg(1, memoryMap(spec_.device).ramEnd);
+    heap_ = heapStart_;
+    flash_ = flashStart_;
+}
+
+
+uint64_t Target::run()
+{
+    uint32_t entry = label(spec_.entry);
+    uint64_t cycles;
+    uint32_t sp0;
+    const Stats s0 = m_->stats();
+
+    cpu_->resetStackLow();
+    if (!spec_.stop)
+    {
+        sp0 = cpu_->reg(1) - 2;                     // below the return address call() pushes
+        cycles = cpu_->call(entry);
+    }
+    else
+    {
+        uint32_t stop = label(spec_.stop);
+        uint64_t c0 = m_->cycles();
+        sp0 = cpu_->reg(1);
+        cpu_->setReg(0, entry);
+        while (cpu_->pc() != stop)
+        {
+            cpu_->step();
+        }
+        cycles = m_->cycles() - c0;
+    }
+
+    stack_ = cpu_->stackLow() < sp0 ? sp0 - cpu_->stackLow() : 0;
+
+    // cycles counts MCLK while it runs: the CPU's and the DMA's; LPM time on top
+    const Stats& s1 = m_->stats();
+    uint64_t dma = s1.dmaCycles - s0.dmaCycles;
+    uint64_t lpm = (uint64_t)((unsigned __int128)(s1.sleepPs - s0.sleepPs) * m_->clocks().mclk() / PS_PER_S);
+    cpu_cycles_ = cycles - dma;
+    energy_ = ENERGY_CPU * cpu_cycles_ + ENERGY_DMA * dma + ENERGY_LPM * lpm;
+    return cycles + lpm;
+}
+
+
+uint32_t Target::alloc(size_t bytes)
+{
+    uint32_t addr = heap_;
+    if (bytes > heapEnd_ - heap_)
+    {
+        throw std::runtime_error("input of " + std::to_string(bytes) + " bytes does not fit in the target's RAM");
+    }
+    heap_ += (uint32_t)((bytes + 1) & ~(size_t)1);
+    return addr;
+}
+
+
+uint32_t Target::words(const std::vector<int32_t>& v)
+{
+    uint32_t addr = alloc(2 * v.size());
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        poke16(addr + 2 * (uint32_t)i, (uint16_t)v[i]);
+    }
+    return addr;
+}
+
+
+uint32_t Target::constWords(const std::vector<int32_t>& v)
+{
+    uint32_t addr = flash_;
+    if (2 * v.size() > flashEnd_ - flash_)
+    {
+        throw std::runtime_error("input of " + std::to_string(2 * v.size()) + " bytes does not fit in the target's FLASH");
+    }
+    flash_ += 2 * (uint32_t)v.size();
+    for (size_t i = 0; i < v.size(); i++)
+    {
+        poke16(addr + 2 * (uint32_t)i, (uint16_t)v[i]);
+    }
+    return addr;
+}
+
+
+uint32_t Target::string(const std::string& s, size_t reserve)
+{
+    uint32_t addr = alloc(std::max(s.size() + 1, reserve));
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        poke8(addr + (uint32_t)i, (uint8_t)s[i]);
+    }
+    poke8(addr + (uint32_t)s.size(), 0);
+    return addr;
+}
+
+}   // namespace hostsim
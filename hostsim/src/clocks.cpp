@@ -0,0 +1,212 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        clocks.cpp
+ * Description:     Clock systems of the three lab devices. Only the frequencies
+ *              matter to the rest of the model, so the FLL loops are treated as
+ *              locked instantly:
+ *                  F5529 UCS    DCOCLKDIV = (FLLN + 1) * FLLREF, DCOCLK = 2^FLLD * DCOCLKDIV
+ *                  FG4618 FLL+  DCOCLK = (N + 1) * ACLK (* D with DCOPLUS)
+ *                  F2013 BCS+   1/8/12/16 MHz when a calibration pair is loaded,
+ *                               otherwise ~1.1 MHz scaled by RSELx/DCOx
+ *
+ * Input:       clock control register writes
+ * Output:      MCLK/SMCLK/ACLK frequencies
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+#include <cmath>
+
+// Macros
+#define XT1_HZ      32768ull
+#define REFO_HZ     32768ull
+#define VLO_HZ      10000ull
+#define XT2_HZ      4000000ull      // 4 MHz crystal on the F5529 LaunchPad
+
+
+namespace hostsim
+{
+
+//// UCS (F5529)
+Ucs::Ucs(Machine& m, uint32_t ctl0)
+    : ClockTree(m), base_(ctl0)
+{
+}
+
+
+uint64_t Ucs::source(unsigned sel) const
+{
+    uint16_t ctl2 = m_.raw16(base_ + 4);
+    uint16_t ctl3 = m_.raw16(base_ + 6);
+
+    static const uint8_t refdiv[8] = {1, 2, 4, 8, 12, 16, 16, 16};
+    uint64_t fref = (((ctl3 >> 4) & 7) == 5 ? XT2_HZ : XT1_HZ) / refdiv[ctl3 & 7];    // SELREF, FLLREFDIV
+    uint64_t dcodiv = ((ctl2 & 0x03FF) + 1) * fref;                                  // FLLN
+    uint64_t dco = dcodiv << ((ctl2 >> 12) & 7);                                     // FLLD
+
+    switch (sel & 7)
+    {
+        case 0:  return XT1_HZ;
+        case 1:  return VLO_HZ;
+        case 2:  return REFO_HZ;
+        case 3:  return dco;
+        case 4:  return dcodiv;
+        default: return XT2_HZ;
+    }
+}
+
+
+uint64_t Ucs::mclk() const
+{
+    return source(m_.raw16(base_ + 8)) >> (m_.raw16(base_ + 10) & 7);               // SELM, DIVM
+}
+
+
+uint64_t Ucs::smclk() const
+{
+    return source(m_.raw16(base_ + 8) >> 4) >> ((m_.raw16(base_ + 10) >> 4) & 7);   // SELS, DIVS
+}
+
+
+uint64_t Ucs::aclk() const
+{
+    return source(m_.raw16(base_ + 8) >> 8) >> ((m_.raw16(base_ + 10) >> 8) & 7);   // SELA, DIVA
+}
+
+
+void Ucs::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    m_.sync();                                      // everything so far ran at the old rates
+    m_.setRaw(addr, bits, value);
+}
+
+
+void Ucs::reset()
+{
+    static const uint16_t init[9] = {0x0000, 0x0020, 0x101F, 0x0000, 0x0044, 0x0000, 0xC1CD, 0x0703, 0x0707};
+    for (int i = 0; i < 9; i++)
+    {
+        m_.setRaw16(base_ + 2 * i, init[i]);
+    }
+}
+
+
+
+//// FLL+ (FG4618)
+FllPlus::FllPlus(Machine& m, uint32_t scfi0, uint32_t scfqctl, uint32_t ctl0, uint32_t ctl1)
+    : ClockTree(m), scfi0_(scfi0), scfqctl_(scfqctl), ctl0_(ctl0), ctl1_(ctl1)
+{
+}
+
+
+uint64_t FllPlus::mclk() const
+{
+    uint64_t n = (m_.raw8(scfqctl_) & 0x7F) + 1;
+    uint64_t d = (m_.raw8(ctl0_) & 0x80) ? 1ull << ((m_.raw8(scfi0_) >> 6) & 3) : 1;   // DCOPLUS, FLLDx
+    uint64_t dco = n * d * aclk();
+
+    switch ((m_.raw8(ctl1_) >> 3) & 3)              // SELMx
+    {
+        case 2:  return XT2_HZ;
+        case 3:  return aclk();
+        default: return dco;
+    }
+}
+
+
+uint64_t FllPlus::smclk() const
+{
+    uint64_t n = (m_.raw8(scfqctl_) & 0x7F) + 1;
+    uint64_t d = (m_.raw8(ctl0_) & 0x80) ? 1ull << ((m_.raw8(scfi0_) >> 6) & 3) : 1;
+    return (m_.raw8(ctl1_) & 0x04) ? XT2_HZ : n * d * aclk();                           // SELS
+}
+
+
+void FllPlus::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    m_.sync();
+    m_.setRaw(addr, bits, value);
+}
+
+
+void FllPlus::reset()
+{
+    m_.setRaw8(scfi0_, 0x40);                       // FLLD_2
+    m_.setRaw8(scfqctl_, 0x1F);                     // N = 31 -> 32 * 32768 = 1048576 Hz
+    m_.setRaw8(ctl0_, 0x03);
+    m_.setRaw8(ctl1_, 0x20);                        // XT2OFF
+}
+
+
+
+//// BCS+ (F2013)
+BcsPlus::BcsPlus(Machine& m, uint32_t dcoctl, uint32_t bcsctl1, uint32_t bcsctl2, uint32_t cal)
+    : ClockTree(m), dcoctl_(dcoctl), bcsctl1_(bcsctl1), bcsctl2_(bcsctl2), cal_(cal)
+{
+}
+
+
+uint64_t BcsPlus::dco() const
+{
+    uint8_t dcoctl = m_.raw8(dcoctl_);
+    uint8_t bcs1 = m_.raw8(bcsctl1_);
+
+    // factory calibration pairs (DCO, BC1) at 16/12/8/1 MHz
+    static const uint64_t mhz[4] = {16000000, 12000000, 8000000, 1000000};
+    for (int i = 0; i < 4; i++)
+    {
+        if (dcoctl == m_.raw8(cal_ + 2 * i) && (bcs1 & 0x0F) == (m_.raw8(cal_ + 2 * i + 1) & 0x0F))
+        {
+            return mhz[i];
+        }
+    }
+
+    // uncalibrated: ~1.1 MHz at RSEL=7/DCO=3, ~35% per RSEL step, ~8% per DCO step
+    int rsel = bcs1 & 0x0F;
+    int step = dcoctl >> 5;
+    return (uint64_t)(1100000.0 * std::pow(1.35, rsel - 7) * std::pow(1.08, step - 3));
+}
+
+
+uint64_t BcsPlus::mclk() const
+{
+    uint8_t bcs2 = m_.raw8(bcsctl2_);
+    uint64_t src = (bcs2 & 0x80) ? aclk() : dco();                                      // SELMx
+    return src >> ((bcs2 >> 4) & 3);                                                    // DIVMx
+}
+
+
+uint64_t BcsPlus::smclk() const
+{
+    uint8_t bcs2 = m_.raw8(bcsctl2_);
+    uint64_t src = (bcs2 & 0x08) ? aclk() : dco();                                      // SELS
+    return src >> ((bcs2 >> 1) & 3);                                                    // DIVSx
+}
+
+
+void BcsPlus::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    m_.sync();
+    m_.setRaw(addr, bits, value);
+}
+
+
+void BcsPlus::reset()
+{
+    m_.setRaw8(dcoctl_, 0x60);
+    m_.setRaw8(bcsctl1_, 0x87);
+    m_.setRaw8(bcsctl2_, 0x00);
+
+    // Info Memory Segment A calibration constants (CALDCO_16MHZ at 0x10F8 ...)
+    static const uint8_t cal[8] = {0x95, 0x8F, 0x9E, 0x8E, 0x92, 0x8D, 0xB5, 0x86};
+    for (int i = 0; i < 8; i++)
+    {
+        m_.setRaw8(cal_ + i, cal[i]);
+    }
+}
+
+}   // namespace hostsim
@@ -0,0 +1,1369 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        cpu.cpp
+ * Description:     Instruction-set model of the MSP430 cores: decoder, executor,
+ *              disassembler and profiler. Instructions run to completion (memory
+ *              and register write-back) before their cycles are charged to the
+ *              machine, so interrupts are only taken on instruction boundaries;
+ *              SR control-bit writes are handed to the machine after the charge,
+ *              which is where LPM entry happens
+ *
+ *              Cycle tables are SLAU144 section 3.4.4 (MSP430, also the CPUX
+ *              of the FG4618 for non-extended instructions) and SLAU208 section
+ *              6.6 (CPUXv2 of the F5529). Extended (X) instructions are charged
+ *              base + 1 for the extension word and + 1 per 20-bit memory
+ *              operand, RPT'd register instructions n * base + 1; those two
+ *              rows are the user's guide approximations, not per-form tables
+ *
+ * Input:       program image, Machine (bus, clocks, interrupts)
+ * Output:      executed program, cycle/instruction profile
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/cpu.h"
+
+#include <algorithm>
+#include <cstring>
+
+
+namespace hostsim
+{
+
+// Status Register flags (held by the Cpu, not the machine)
+constexpr uint32_t SR_C = 0x0001;
+constexpr uint32_t SR_Z = 0x0002;
+constexpr uint32_t SR_N = 0x0004;
+constexpr uint32_t SR_V = 0x0100;
+constexpr uint32_t SR_FLAGS = SR_C | SR_Z | SR_N | SR_V;
+
+constexpr uint32_t RETURN_SENTINEL = 0x0000;     // call(): return address that ends the run
+
+
+
+//// Core
+Core coreOf(Device device)
+{
+    switch (device)
+    {
+        case Device::FG4618: return Core::Msp430X;
+        case Device::F2013:  return Core::Msp430;
+        default:             return Core::Msp430Xv2;
+    }
+}
+
+
+const char* coreName(Core core)
+{
+    switch (core)
+    {
+        case Core::Msp430:  return "MSP430";
+        case Core::Msp430X: return "MSP430X";
+        default:            return "MSP430Xv2";
+    }
+}
+
+
+
+namespace
+{
+
+//// Decoded Instruction
+enum class Am : uint8_t { Reg, Idx, Sym, Abs, Ind, Inc, Imm, Const };
+
+struct Opnd
+{
+    Am mode = Am::Reg;
+    uint8_t reg = 0;
+    int32_t x = 0;                      // Idx/Sym: offset, Abs: address, Imm/Const: value
+    uint32_t base = 0;                  // Sym: address of the offset word
+};
+
+struct Insn
+{
+    enum Kind : uint8_t { Bad, I, II, Jump, Reti, Calla, Addr, PushM, PopM, RotM } kind = Bad;
+    uint32_t addr = 0;
+    uint32_t next = 0;                  // address of the following instruction
+    uint16_t word = 0;                  // opcode word (after the extension word)
+    unsigned op = 0;                    // I: 4..15, II: 0..5, Jump: condition, Addr: bits 7:4, RotM: 0..3
+    unsigned bits = 16;                 // 8, 16 or 20
+    Opnd src, dst;
+    bool ext = false;                   // extension word present
+    bool zc = false;                    // RRUX / ZC bit
+    int repeat = 1;                     // register-mode repeat count, -(n+1): count in Rn
+    unsigned n = 0;                     // PUSHM/POPM/RxxM count
+    uint32_t target = 0;                // Jump: destination
+};
+
+const char* const formatINames[] = {"MOV", "ADD", "ADDC", "SUBC", "SUB", "CMP", "DADD", "BIT", "BIC", "BIS", "XOR", "AND"};
+const char* const formatIINames[] = {"RRC", "SWPB", "RRA", "SXT", "PUSH", "CALL"};
+const char* const jumpNames[] = {"JNE", "JEQ", "JNC", "JC", "JN", "JGE", "JL", "JMP"};
+const char* const rotNames[] = {"RRCM", "RRAM", "RLAM", "RRUM"};
+
+int32_t sext(uint32_t v, unsigned bits)
+{
+    uint32_t m = 1u << (bits - 1);
+    v &= (m << 1) - 1;
+    return (int32_t)((v ^ m) - m);
+}
+
+uint32_t maskOf(unsigned bits)
+{
+    return bits == 8 ? 0xFF : bits == 16 ? 0xFFFF : 0xFFFFF;
+}
+
+uint32_t msbOf(unsigned bits)
+{
+    return bits == 8 ? 0x80 : bits == 16 ? 0x8000 : 0x80000;
+}
+
+
+template <typename Fetch>
+Insn decode(Fetch fetch, uint32_t addr, Core core)
+{
+    Insn in;
+    in.addr = addr;
+    uint32_t p = addr;
+    auto next = [&]()
+    {
+        uint16_t w = fetch(p);
+        p = (p + 2) & 0xFFFFF;
+        return w;
+    };
+
+    uint16_t w = next();
+    uint16_t xw = 0;
+    if (core != Core::Msp430 && (w & 0xF800) == 0x1800)
+    {
+        in.ext = true;
+        xw = w;
+        w = next();
+    }
+    in.word = w;
+
+    unsigned srcHi = (xw >> 7) & 0xF;
+    unsigned dstHi = xw & 0xF;
+
+    auto source = [&](unsigned reg, unsigned as) -> Opnd
+    {
+        Opnd o;
+        o.reg = reg;
+        if (reg == 3)
+        {
+            static const int32_t cg3[] = {0, 1, 2, -1};
+            o.mode = Am::Const;
+            o.x = cg3[as];
+            return o;
+        }
+        if (reg == 2 && as >= 2)
+        {
+            o.mode = Am::Const;
+            o.x = as == 2 ? 4 : 8;
+            return o;
+        }
+        switch (as)
+        {
+            case 0:
+                o.mode = Am::Reg;
+                break;
+            case 1:
+                o.base = p;
+                if (reg == 2)
+                {
+                    o.mode = Am::Abs;
+                    o.x = in.ext ? (int32_t)((srcHi << 16) | next()) : next();
+                }
+                else
+                {
+                    o.mode = reg == 0 ? Am::Sym : Am::Idx;
+                    o.x = in.ext ? sext((srcHi << 16) | next(), 20) : sext(next(), 16);
+                }
+                break;
+            case 2:
+                o.mode = Am::Ind;
+                break;
+            default:
+                if (reg == 0)
+                {
+                    o.mode = Am::Imm;
+                    o.x = in.ext ? (int32_t)((srcHi << 16) | next()) : next();
+                }
+                else
+                {
+                    o.mode = Am::Inc;
+                }
+                break;
+        }
+        return o;
+    };
+
+    auto destination = [&](unsigned reg, unsigned ad) -> Opnd
+    {
+        Opnd o;
+        o.reg = reg;
+        if (!ad)
+        {
+            o.mode = Am::Reg;
+            return o;
+        }
+        o.base = p;
+        if (reg == 2)
+        {
+            o.mode = Am::Abs;
+            o.x = in.ext ? (int32_t)((dstHi << 16) | next()) : next();
+        }
+        else
+        {
+            o.mode = reg == 0 ? Am::Sym : Am::Idx;
+            o.x = in.ext ? sext((dstHi << 16) | next(), 20) : sext(next(), 16);
+        }
+        return o;
+    };
+
+    auto size = [&](unsigned bw)
+    {
+        if (!in.ext)
+        {
+            return bw ? 8u : 16u;
+        }
+        unsigned al = (xw >> 6) & 1;
+        return al ? (bw ? 8u : 16u) : (bw ? 20u : 0u);
+    };
+
+    auto registerMode = [&]()
+    {
+        in.zc = (xw >> 8) & 1;
+        in.repeat = (xw & 0x80) ? -(int)((xw & 0xF) + 1) : (int)(xw & 0xF) + 1;
+    };
+
+    if (w >= 0x4000)
+    {
+        // format I
+        in.kind = Insn::I;
+        in.op = w >> 12;
+        in.bits = size((w >> 6) & 1);
+        unsigned as = (w >> 4) & 3, ad = (w >> 7) & 1;
+        in.src = source((w >> 8) & 0xF, as);
+        in.dst = destination(w & 0xF, ad);
+        if (in.ext && as == 0 && ad == 0)
+        {
+            registerMode();
+        }
+    }
+    else if (w >= 0x2000)
+    {
+        // jumps
+        in.kind = in.ext ? Insn::Bad : Insn::Jump;
+        in.op = (w >> 10) & 7;
+        in.target = (addr + 2 + 2 * sext(w & 0x3FF, 10)) & (core == Core::Msp430 ? 0xFFFF : 0xFFFFF);
+    }
+    else if (w >= 0x1000 && w < 0x1400)
+    {
+        unsigned op = (w >> 7) & 7, as = (w >> 4) & 3, reg = w & 0xF;
+        if (op < 6)
+        {
+            // format II
+            in.kind = Insn::II;
+            in.op = op;
+            in.bits = size((w >> 6) & 1);
+            in.src = source(reg, as);
+            in.dst = in.src;
+            if (in.ext && as == 0)
+            {
+                registerMode();
+            }
+        }
+        else if (w == 0x1300 && !in.ext)
+        {
+            in.kind = Insn::Reti;
+        }
+        else if (core != Core::Msp430 && !in.ext && (w & 0xFFC0) == 0x1340)
+        {
+            // CALLA Rdst / x(Rdst) / @Rdst / @Rdst+
+            in.kind = Insn::Calla;
+            in.bits = 20;
+            in.src.reg = reg;
+            in.src.mode = as == 0 ? Am::Reg : as == 1 ? Am::Idx : as == 2 ? Am::Ind : Am::Inc;
+            if (as == 1)
+            {
+                in.src.x = sext(next(), 16);
+            }
+        }
+        else if (core != Core::Msp430 && !in.ext && (w & 0xFFC0) == 0x1380 && as != 2)
+        {
+            // CALLA &abs20 / EDE / #imm20
+            in.kind = Insn::Calla;
+            in.bits = 20;
+            in.src.base = p;
+            uint32_t v = (reg << 16) | next();
+            in.src.mode = as == 0 ? Am::Abs : as == 1 ? Am::Sym : Am::Imm;
+            in.src.x = as == 1 ? sext(v, 20) : (int32_t)v;
+        }
+    }
+    else if (core != Core::Msp430 && !in.ext && w >= 0x1400 && w < 0x1800)
+    {
+        // PUSHM / POPM
+        unsigned sub = (w >> 8) & 3;
+        in.kind = sub < 2 ? Insn::PushM : Insn::PopM;
+        in.bits = (sub & 1) ? 16 : 20;
+        in.n = ((w >> 4) & 0xF) + 1;
+        in.dst.reg = w & 0xF;
+    }
+    else if (core != Core::Msp430 && !in.ext && w < 0x1000)
+    {
+        unsigned sub = (w >> 4) & 0xF, rs = (w >> 8) & 0xF, rd = w & 0xF;
+        if (sub == 4 || sub == 5)
+        {
+            in.kind = Insn::RotM;
+            in.bits = sub == 4 ? 20 : 16;
+            in.op = (w >> 8) & 3;
+            in.n = ((w >> 10) & 3) + 1;
+            in.dst.reg = rd;
+            in.dst.mode = Am::Reg;
+        }
+        else
+        {
+            in.kind = Insn::Addr;
+            in.op = sub;
+            in.bits = 20;
+            in.src.reg = rs;
+            in.dst.reg = rd;
+            switch (sub)
+            {
+                case 0x0: in.src.mode = Am::Ind; break;
+                case 0x1: in.src.mode = Am::Inc; break;
+                case 0x2: in.src.mode = Am::Abs; in.src.x = (rs << 16) | next(); break;
+                case 0x3: in.src.mode = Am::Idx; in.src.base = p; in.src.x = sext(next(), 16); break;
+                case 0x6: in.dst.mode = Am::Abs; in.dst.x = (rd << 16) | next(); break;
+                case 0x7: in.dst.mode = Am::Idx; in.dst.base = p; in.dst.x = sext(next(), 16); break;
+                case 0x8: case 0x9: case 0xA: case 0xB:
+                    in.src.mode = Am::Imm;
+                    in.src.x = (rs << 16) | next();
+                    break;
+                case 0xC: case 0xD: case 0xE: case 0xF:
+                    break;
+                default:
+                    in.kind = Insn::Bad;
+                    break;
+            }
+            if (in.src.mode == Am::Idx && rs == 0)
+            {
+                in.src.mode = Am::Sym;
+            }
+            if (in.dst.mode == Am::Idx && rd == 0)
+            {
+                in.dst.mode = Am::Sym;
+            }
+        }
+    }
+
+    if (in.bits == 0)
+    {
+        in.kind = Insn::Bad;            // AL = 0, BW = 0 is reserved
+    }
+    in.next = p;
+    return in;
+}
+
+
+
+//// Cycle Tables
+/* [source class][destination class]; source Rn (and constant generator), @Rn,
+ * @Rn+, #N, x(Rn)/EDE/&EDE; destination Rm, PC, x(Rm)/EDE/&EDE
+ */
+const uint8_t formatI430[5][3] = {{1, 2, 4}, {2, 2, 5}, {2, 3, 5}, {2, 3, 5}, {3, 3, 6}};
+const uint8_t formatIXv2[5][3] = {{1, 3, 4}, {2, 4, 5}, {2, 4, 5}, {2, 3, 5}, {3, 5, 6}};
+
+/* [addressing mode][RRA/RRC/SWPB/SXT, PUSH, CALL]
+ */
+const uint8_t formatII430[5][3] = {{1, 3, 4}, {3, 4, 4}, {3, 5, 5}, {0, 4, 5}, {4, 5, 5}};
+const uint8_t formatIIXv2[5][3] = {{1, 3, 4}, {3, 3, 4}, {3, 3, 4}, {0, 3, 4}, {4, 4, 5}};
+
+unsigned sourceClass(const Opnd& o)
+{
+    switch (o.mode)
+    {
+        case Am::Reg:
+        case Am::Const: return 0;
+        case Am::Ind:   return 1;
+        case Am::Inc:   return 2;
+        case Am::Imm:   return 3;
+        default:        return 4;
+    }
+}
+
+bool isMemory(const Opnd& o)
+{
+    return o.mode != Am::Reg && o.mode != Am::Const && o.mode != Am::Imm;
+}
+
+unsigned cyclesOf(const Insn& in, Core core)
+{
+    bool v2 = core == Core::Msp430Xv2;
+    unsigned c = 0;
+
+    switch (in.kind)
+    {
+        case Insn::I:
+        {
+            unsigned d = in.dst.mode != Am::Reg ? 2 : in.dst.reg == 0 ? 1 : 0;
+            c = (v2 ? formatIXv2 : formatI430)[sourceClass(in.src)][d];
+            if (v2 && d == 2 && (in.op == 4 || in.op == 11 || in.op == 9))
+            {
+                c--;                    // MOV, BIT, CMP to memory
+            }
+            break;
+        }
+        case Insn::II:
+        {
+            unsigned g = in.op == 4 ? 1 : in.op == 5 ? 2 : 0;
+            c = (v2 ? formatIIXv2 : formatII430)[sourceClass(in.src)][g];
+            break;
+        }
+        case Insn::Jump:
+            return 2;
+        case Insn::Reti:
+            return 0;                   // charged by the machine with the interrupt frame
+        case Insn::Calla:
+            switch (in.src.mode)
+            {
+                case Am::Abs: return 6;
+                case Am::Sym: return v2 ? 5 : 6;
+                case Am::Idx: return 5;
+                default:      return v2 ? 4 : 5;
+            }
+        case Insn::Addr:
+        {
+            static const uint8_t mova[16] = {3, 3, 4, 4, 0, 0, 4, 4, 2, 3, 3, 3, 1, 1, 1, 1};
+            c = mova[in.op];
+            if (in.dst.reg == 0 && in.dst.mode == Am::Reg && in.op <= 0x3)
+            {
+                c += in.op == 1 ? (v2 ? 1 : 2) : 2;     // RETA 4/5, BRA from memory
+            }
+            else if (in.dst.reg == 0 && in.dst.mode == Am::Reg && (in.op == 0x8 || in.op == 0xC))
+            {
+                c += 1;                                 // BRA #imm20 / BRA Rsrc
+            }
+            return c;
+        }
+        case Insn::PushM:
+        case Insn::PopM:
+            return 2 + (in.bits == 20 ? 2 : 1) * in.n;
+        case Insn::RotM:
+            return in.n;
+        default:
+            return 1;
+    }
+
+    if (in.ext)
+    {
+        if (in.src.mode == Am::Reg && in.dst.mode == Am::Reg && in.repeat != 1)
+        {
+            return c;                   // repeat count applied by the executor
+        }
+        c += 1;
+        if (in.bits == 20)
+        {
+            c += isMemory(in.src) + (in.kind == Insn::I && isMemory(in.dst));
+        }
+    }
+    return c;
+}
+
+}   // namespace
+
+
+
+//// Cpu: Construction
+Cpu::Cpu(Machine& m, Core core)
+    : m_(m), core_(core), map_(memoryMap(m.device())), programmed_(0x100000, false)
+{
+    if (core_ == Core::Msp430Xv2)
+    {
+        m_.setInterruptCycles(5, 3);
+    }
+    else
+    {
+        m_.setInterruptCycles(6, 5);
+    }
+    m_.setVectorHandler([this](int vector) { interrupt(vector); });
+}
+
+
+Cpu::~Cpu()
+{
+    m_.setVectorHandler(nullptr);
+}
+
+
+void Cpu::load(const Image& image)
+{
+    entry_ = image.entry;
+    for (const Segment& s : image.segments)
+    {
+        for (size_t i = 0; i < s.bytes.size(); i++)
+        {
+            uint32_t a = (s.addr + i) & 0xFFFFF;
+            m_.setRaw8(a, s.bytes[i]);
+            programmed_[a] = true;
+        }
+    }
+}
+
+
+void Cpu::reset()
+{
+    uint32_t v = map_.vectorBase + 2 * (map_.vectors - 1);
+    if (!programmed_[v] && !entry_)
+    {
+        throw Halt("no reset vector or entry point in the image");
+    }
+
+    std::memset(r_, 0, sizeof(r_));
+    r_[0] = programmed_[v] ? m_.raw16(v) : entry_;
+    m_.writeSR(0);
+    frames_.clear();
+}
+
+
+
+//// Cpu: Registers
+uint16_t Cpu::srValue() const
+{
+    return (m_.sr() & ~SR_FLAGS) | (r_[2] & SR_FLAGS);
+}
+
+
+uint32_t Cpu::reg(int n) const
+{
+    return n == 2 ? srValue() : n == 3 ? 0 : r_[n];
+}
+
+
+void Cpu::setReg(int n, uint32_t value)
+{
+    setRegister(n, value, core_ == Core::Msp430 ? 16 : 20);
+    if (srWritten_)
+    {
+        srWritten_ = false;
+        m_.writeSR(srPending_);
+    }
+}
+
+
+void Cpu::setRegister(int n, uint32_t value, unsigned bits)
+{
+    uint32_t mask = core_ == Core::Msp430 ? 0xFFFF & maskOf(bits) : maskOf(bits);
+
+    switch (n)
+    {
+        case 0:
+        case 1:
+            r_[n] = value & mask & ~1u;
+            break;
+        case 2:
+            r_[2] = value & SR_FLAGS;
+            srPending_ = value & 0xFF & ~SR_FLAGS;
+            srWritten_ = true;
+            break;
+        case 3:
+            break;
+        default:
+            r_[n] = value & mask;
+            break;
+    }
+}
+
+
+void Cpu::push(uint16_t value)
+{
+    r_[1] = (r_[1] - 2) & 0xFFFFF;
+    write(r_[1], 16, value);
+}
+
+
+
+//// Cpu: Memory
+uint16_t Cpu::fetch(uint32_t addr) const
+{
+    return m_.raw16(addr);
+}
+
+
+bool Cpu::executable(uint32_t addr) const
+{
+    return programmed_[addr & 0xFFFFF];
+}
+
+
+uint32_t Cpu::read(uint32_t addr, unsigned bits)
+{
+    if (bits != 8)
+    {
+        addr &= ~1u;
+    }
+    return m_.load(addr & 0xFFFFF, bits);
+}
+
+
+void Cpu::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if (bits != 8)
+    {
+        addr &= ~1u;
+    }
+    addr &= 0xFFFFF;
+    if (addr >= map_.flashStart)
+    {
+        // FLASH is not writable without the flash controller: the write is lost
+        if (!flashWrites_++)
+        {
+            firstFlashWrite_ = addr;
+        }
+        return;
+    }
+    m_.store(addr, bits, value);
+}
+
+
+
+//// Cpu: Execution
+void Cpu::run()
+{
+    while (true)
+    {
+        step();
+    }
+}
+
+
+uint64_t Cpu::call(uint32_t addr)
+{
+    push(RETURN_SENTINEL);
+    uint64_t c0 = m_.cycles();
+
+    r_[0] = addr;
+    frames_.push_back({addr, c0, r_[1], r_[1]});
+    while (r_[0] != RETURN_SENTINEL)
+    {
+        step();
+    }
+    return m_.cycles() - c0;
+}
+
+
+void Cpu::interrupt(int vector)
+/* called by the machine's dispatcher after it has saved and cleared SR and
+ * charged the entry cycles: push PC/SR on the simulated stack and run the
+ * vector's handler up to its RETI
+ */
+{
+    uint32_t v = map_.vectorBase + 2 * vector;
+    if (vector >= map_.vectors || !programmed_[v] || m_.raw16(v) == 0xFFFF)
+    {
+        throw Halt(std::string("unhandled interrupt: ") + m_.vectorName(vector));
+    }
+
+    uint16_t sr = (m_.savedSR() & ~SR_FLAGS) | (r_[2] & SR_FLAGS);
+    uint32_t pc = r_[0];
+    push(pc & 0xFFFF);
+    push(core_ == Core::Msp430 ? sr : (sr & 0x0FFF) | ((pc >> 4) & 0xF000));   // PC[19:16] in SR[15:12]
+
+    r_[2] = 0;
+    r_[0] = m_.raw16(v);
+
+    bool outer = retiDone_;
+    retiDone_ = false;
+    while (!retiDone_)
+    {
+        step();
+    }
+    retiDone_ = outer;
+}
+
+
+void Cpu::step()
+{
+    uint32_t addr = r_[0];
+    if (!executable(addr))
+    {
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), "executing unprogrammed memory at 0x%05X", addr);
+        throw Halt(buf);
+    }
+    if (m_.raw16(addr) == 0x3FFF && !(m_.sr() & SR_GIE))
+    {
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), "idle loop (jmp $) at 0x%05X with interrupts disabled", addr);
+        throw Halt(buf);
+    }
+
+    uint64_t c0 = m_.cycles();
+    if (trace_)
+    {
+        std::string where = traceImage_ ? traceImage_->describe(addr) : "";
+        std::fprintf(trace_, "%10llu  %05X  %-24s %s\n", (unsigned long long)c0, addr,
+                     disassemble(addr).c_str(), where.c_str());
+    }
+
+    execute(addr);
+}
+
+
+void Cpu::execute(uint32_t addr)
+{
+    Insn in = decode([this](uint32_t a) { return fetch(a); }, addr, core_);
+    if (in.kind == Insn::Bad)
+    {
+        char buf[96];
+        std::snprintf(buf, sizeof(buf), "illegal instruction 0x%04X at 0x%05X", in.word, addr);
+        throw Halt(buf);
+    }
+
+    uint64_t c0 = m_.cycles();
+    r_[0] = in.next;
+    srWritten_ = false;
+
+    unsigned bits = in.bits;
+    uint32_t mask = maskOf(bits), msb = msbOf(bits);
+    uint32_t amask = core_ == Core::Msp430 ? 0xFFFF : 0xFFFFF;
+    unsigned cycles = cyclesOf(in, core_);
+
+    auto setNZ = [&](uint32_t r)
+    {
+        r_[2] &= ~(SR_N | SR_Z);
+        if (r & msb) r_[2] |= SR_N;
+        if (!(r & mask)) r_[2] |= SR_Z;
+    };
+    auto setFlag = [&](uint32_t f, bool on)
+    {
+        r_[2] = on ? (r_[2] | f) : (r_[2] & ~f);
+    };
+
+    auto ea = [&](const Opnd& o) -> uint32_t
+    {
+        uint32_t base;
+        switch (o.mode)
+        {
+            case Am::Abs: return (uint32_t)o.x & amask;
+            case Am::Ind:
+            case Am::Inc: return r_[o.reg] & amask;
+            case Am::Sym: base = o.base; break;
+            default:      base = o.reg == 3 ? 0 : r_[o.reg]; break;
+        }
+        // non-extended indexed addressing wraps in the lower 64K when Rn is there
+        if (!in.ext && in.kind != Insn::Calla && in.kind != Insn::Addr && base < 0x10000)
+        {
+            return (base + o.x) & 0xFFFF;
+        }
+        return (base + o.x) & amask;
+    };
+
+    auto regValue = [&](unsigned n) -> uint32_t
+    {
+        return n == 0 ? r_[0] : n == 2 ? srValue() : n == 3 ? 0 : r_[n];
+    };
+
+    auto increment = [&](const Opnd& o, unsigned b)
+    {
+        unsigned step = b == 8 ? (o.reg <= 1 ? 2 : 1) : b == 16 ? 2 : 4;
+        r_[o.reg] = (r_[o.reg] + step) & amask;
+    };
+
+    auto readSource = [&](const Opnd& o, unsigned b) -> uint32_t
+    {
+        uint32_t v;
+        switch (o.mode)
+        {
+            case Am::Reg:   v = o.reg == 0 ? in.addr + (in.ext ? 4 : 2) : regValue(o.reg); break;
+            case Am::Const:
+            case Am::Imm:   v = (uint32_t)o.x; break;
+            case Am::Inc:   v = read(ea(o), b); increment(o, b); break;
+            default:        v = read(ea(o), b); break;
+        }
+        return v & maskOf(b);
+    };
+
+    auto pushValue = [&](uint32_t v, unsigned b)
+    {
+        if (b == 20)
+        {
+            r_[1] = (r_[1] - 4) & amask;
+            write(r_[1], 20, v);
+        }
+        else
+        {
+            r_[1] = (r_[1] - 2) & amask;
+            write(r_[1], b, v);
+        }
+    };
+
+    auto addWithCarry = [&](uint32_t a, uint32_t b, uint32_t cin) -> uint32_t
+    {
+        uint64_t sum = (uint64_t)a + b + cin;
+        uint32_t r = (uint32_t)sum & mask;
+        setNZ(r);
+        setFlag(SR_C, sum > mask);
+        setFlag(SR_V, ((a ^ r) & (b ^ r) & msb) != 0);
+        return r;
+    };
+
+    bool call = false;
+    uint32_t callTarget = 0;
+
+    switch (in.kind)
+    {
+        case Insn::I:
+        {
+            int count = in.repeat < 0 ? (int)(r_[-in.repeat - 1] & 0xF) + 1 : in.repeat;
+            if (in.ext && in.repeat != 1)
+            {
+                cycles = count * cycles + 1;
+            }
+
+            for (int rep = 0; rep < count; rep++)
+            {
+                uint32_t s = readSource(in.src, bits);
+                bool mem = in.dst.mode != Am::Reg;
+                uint32_t daddr = mem ? ea(in.dst) : 0;
+                uint32_t d = 0;
+                if (in.op != 4)
+                {
+                    d = mem ? read(daddr, bits) & mask : regValue(in.dst.reg) & mask;
+                }
+                uint32_t carry = (r_[2] & SR_C) && !in.zc ? 1 : 0;
+
+                uint32_t r = 0;
+                bool store = true;
+                switch (in.op)
+                {
+                    case 4:  r = s; break;                                          // MOV
+                    case 5:  r = addWithCarry(d, s, 0); break;                      // ADD
+                    case 6:  r = addWithCarry(d, s, carry); break;                  // ADDC
+                    case 7:  r = addWithCarry(d, ~s & mask, carry); break;          // SUBC
+                    case 8:  r = addWithCarry(d, ~s & mask, 1); break;              // SUB
+                    case 9:  addWithCarry(d, ~s & mask, 1); store = false; break;   // CMP
+                    case 10:                                                        // DADD
+                    {
+                        uint32_t c = carry;
+                        for (unsigned i = 0; i < bits; i += 4)
+                        {
+                            uint32_t digit = ((s >> i) & 0xF) + ((d >> i) & 0xF) + c;
+                            c = digit > 9;
+                            if (c)
+                            {
+                                digit -= 10;
+                            }
+                            r |= (digit & 0xF) << i;
+                        }
+                        setNZ(r);
+                        setFlag(SR_C, c);
+                        break;
+                    }
+                    case 11:                                                        // BIT
+                        r = s & d;
+                        setNZ(r);
+                        setFlag(SR_C, r != 0);
+                        setFlag(SR_V, false);
+                        store = false;
+                        break;
+                    case 12: r = d & ~s; break;                                     // BIC
+                    case 13: r = d | s; break;                                      // BIS
+                    case 14:                                                        // XOR
+                        r = (d ^ s) & mask;
+                        setNZ(r);
+                        setFlag(SR_C, r != 0);
+                        setFlag(SR_V, (s & msb) && (d & msb));
+                        break;
+                    default:                                                        // AND
+                        r = s & d;
+                        setNZ(r);
+                        setFlag(SR_C, r != 0);
+                        setFlag(SR_V, false);
+                        break;
+                }
+
+                if (store)
+                {
+                    if (mem)
+                    {
+                        write(daddr, bits, r);
+                    }
+                    else
+                    {
+                        setRegister(in.dst.reg, r, bits);
+                    }
+                }
+            }
+            break;
+        }
+
+        case Insn::II:
+        {
+            if (in.op == 4)
+            {
+                // PUSH: operand read before SP moves
+                pushValue(readSource(in.src, bits), bits);
+                break;
+            }
+            if (in.op == 5)
+            {
+                // CALL
+                uint32_t target = readSource(in.src, 16);
+                pushValue(r_[0] & 0xFFFF, 16);
+                r_[0] = target & ~1u;
+                call = true;
+                callTarget = r_[0];
+                break;
+            }
+
+            int count = in.repeat < 0 ? (int)(r_[-in.repeat - 1] & 0xF) + 1 : in.repeat;
+            if (in.ext && in.repeat != 1)
+            {
+                cycles = count * cycles + 1;
+            }
+
+            for (int rep = 0; rep < count; rep++)
+            {
+                bool mem = in.src.mode != Am::Reg;
+                uint32_t daddr = mem ? ea(in.src) : 0;
+                uint32_t d = mem ? read(daddr, bits) & mask : regValue(in.src.reg) & mask;
+                if (in.src.mode == Am::Inc)
+                {
+                    increment(in.src, bits);
+                }
+
+                uint32_t r;
+                unsigned rbits = bits;
+                switch (in.op)
+                {
+                    case 0:                                                         // RRC
+                    {
+                        uint32_t cin = (r_[2] & SR_C) && !in.zc ? msb : 0;
+                        r = (d >> 1) | cin;
+                        setNZ(r);
+                        setFlag(SR_C, d & 1);
+                        setFlag(SR_V, false);
+                        break;
+                    }
+                    case 1:                                                         // SWPB
+                        r = ((d & 0xFF) << 8) | ((d >> 8) & 0xFF);
+                        if (bits == 20)
+                        {
+                            r |= d & 0xF0000;
+                        }
+                        break;
+                    case 2:                                                         // RRA
+                        r = (d >> 1) | (d & msb);
+                        setNZ(r);
+                        setFlag(SR_C, d & 1);
+                        setFlag(SR_V, false);
+                        break;
+                    default:                                                        // SXT
+                    {
+                        uint32_t wide = core_ == Core::Msp430 || (mem && bits != 20) ? 16 : 20;
+                        r = (uint32_t)sext(d & 0xFF, 8) & maskOf(wide);
+                        rbits = wide;
+                        r_[2] &= ~(SR_N | SR_Z | SR_C | SR_V);
+                        if (d & 0x80) r_[2] |= SR_N;
+                        if (!(d & 0xFF)) r_[2] |= SR_Z;
+                        else r_[2] |= SR_C;
+                        break;
+                    }
+                }
+
+                if (mem)
+                {
+                    write(daddr, rbits, r);
+                }
+                else
+                {
+                    setRegister(in.src.reg, r, rbits);
+                }
+            }
+            break;
+        }
+
+        case Insn::Jump:
+        {
+            uint32_t sr = r_[2];
+            bool n = sr & SR_N, z = sr & SR_Z, c = sr & SR_C, v = sr & SR_V;
+            bool taken = false;
+            switch (in.op)
+            {
+                case 0: taken = !z; break;
+                case 1: taken = z; break;
+                case 2: taken = !c; break;
+                case 3: taken = c; break;
+                case 4: taken = n; break;
+                case 5: taken = n == v; break;
+                case 6: taken = n != v; break;
+                default: taken = true; break;
+            }
+            if (taken)
+            {
+                r_[0] = in.target;
+            }
+            break;
+        }
+
+        case Insn::Reti:
+        {
+            uint16_t sr = read(r_[1], 16);
+            r_[1] = (r_[1] + 2) & amask;
+            uint32_t pc = read(r_[1], 16);
+            r_[1] = (r_[1] + 2) & amask;
+            if (core_ != Core::Msp430)
+            {
+                pc |= (uint32_t)(sr & 0xF000) << 4;
+                sr &= 0x0FFF;
+            }
+            r_[0] = pc & ~1u;
+            r_[2] = sr & SR_FLAGS;
+            m_.setSavedSR(sr & 0xFF & ~SR_FLAGS);
+            retiDone_ = true;
+            break;
+        }
+
+        case Insn::Calla:
+        {
+            uint32_t target;
+            switch (in.src.mode)
+            {
+                case Am::Reg: target = r_[in.src.reg]; break;
+                case Am::Imm: target = (uint32_t)in.src.x; break;
+                case Am::Sym: target = (in.src.base + in.src.x) & 0xFFFFF; break;
+                default:      target = read(ea(in.src), 20); break;
+            }
+            if (in.src.mode == Am::Inc)
+            {
+                r_[in.src.reg] = (r_[in.src.reg] + 4) & 0xFFFFF;
+            }
+            pushValue(r_[0], 20);
+            r_[0] = target & 0xFFFFE;
+            call = true;
+            callTarget = r_[0];
+            break;
+        }
+
+        case Insn::Addr:
+        {
+            uint32_t s = 0;
+            switch (in.op)
+            {
+                case 0x0: s = read(r_[in.src.reg], 20); break;
+                case 0x1: s = read(r_[in.src.reg], 20); r_[in.src.reg] = (r_[in.src.reg] + 4) & 0xFFFFF; break;
+                case 0x2:
+                case 0x3: s = read(ea(in.src), 20); break;
+                case 0x6:
+                case 0x7: write(ea(in.dst), 20, regValue(in.src.reg) & 0xFFFFF); break;
+                case 0x8: case 0x9: case 0xA: case 0xB: s = (uint32_t)in.src.x & 0xFFFFF; break;
+                default:  s = regValue(in.src.reg) & 0xFFFFF; break;
+            }
+            if (in.op == 0x6 || in.op == 0x7)
+            {
+                break;
+            }
+
+            unsigned arith = in.op >= 0x8 ? in.op & 3 : 0;
+            uint32_t d = regValue(in.dst.reg) & 0xFFFFF;
+            switch (arith)
+            {
+                case 0: setRegister(in.dst.reg, s, 20); break;                                  // MOVA
+                case 1: addWithCarry(d, ~s & 0xFFFFF, 1); break;                                 // CMPA
+                case 2: setRegister(in.dst.reg, addWithCarry(d, s, 0), 20); break;               // ADDA
+                default: setRegister(in.dst.reg, addWithCarry(d, ~s & 0xFFFFF, 1), 20); break;   // SUBA
+            }
+            break;
+        }
+
+        case Insn::PushM:
+            for (unsigned i = 0; i < in.n; i++)
+            {
+                unsigned r = (in.dst.reg - i) & 0xF;
+                pushValue(regValue(r) & maskOf(bits), bits);
+            }
+            break;
+
+        case Insn::PopM:
+            for (unsigned i = 0; i < in.n; i++)
+            {
+                unsigned r = (in.dst.reg + i) & 0xF;
+                uint32_t v = read(r_[1], bits);
+                r_[1] = (r_[1] + (bits == 20 ? 4 : 2)) & 0xFFFFF;
+                setRegister(r, v, bits);
+            }
+            break;
+
+        case Insn::RotM:
+        {
+            uint32_t d = regValue(in.dst.reg) & mask;
+            uint32_t r = d;
+            bool c = r_[2] & SR_C;
+            for (unsigned i = 0; i < in.n; i++)
+            {
+                bool out = in.op == 2 ? (r & msb) != 0 : (r & 1) != 0;
+                switch (in.op)
+                {
+                    case 0: r = (r >> 1) | (c ? msb : 0); break;      // RRCM
+                    case 1: r = (r >> 1) | (r & msb); break;          // RRAM
+                    case 2: r = (r << 1) & mask; break;               // RLAM
+                    default: r = r >> 1; break;                       // RRUM
+                }
+                c = out;
+            }
+            setNZ(r);
+            setFlag(SR_C, c);
+            setFlag(SR_V, false);
+            setRegister(in.dst.reg, r, bits);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    instructions_++;
+    if (profile_)
+    {
+        hot_[addr].count++;
+        hot_[addr].cycles += cycles;
+    }
+    if (call)
+    {
+        frames_.push_back({callTarget, c0, r_[1], r_[1]});
+    }
+
+    // the charge is the instruction boundary: peripherals catch up, interrupts fire
+    bool writeSR = srWritten_;
+    uint16_t sr = srPending_;
+    srWritten_ = false;
+    if (cycles)
+    {
+        m_.delayCycles(cycles);
+    }
+    if (writeSR)
+    {
+        m_.writeSR(sr);
+    }
+    else if (m_.sr() & SR_CPUOFF)
+    {
+        m_.writeSR(m_.sr());            // an ISR returned into LPM through its stacked SR
+    }
+
+    // stack high-water: SP only moves inside an instruction, so its boundaries see every low
+    if (r_[1] >= map_.ramStart && r_[1] <= map_.ramEnd)
+    {
+        stackLow_ = std::min(stackLow_, r_[1]);
+    }
+    if (!frames_.empty())
+    {
+        frames_.back().low = std::min(frames_.back().low, r_[1]);
+    }
+
+    while (!frames_.empty() && r_[1] > frames_.back().sp)
+    {
+        Frame f = frames_.back();
+        frames_.pop_back();
+        if (profile_)
+        {
+            uint64_t c = m_.cycles() - f.start;
+            Routine& rt = routines_[f.target];
+            rt.calls++;
+            rt.cycles += c;
+            rt.min = std::min(rt.min, c);
+            rt.max = std::max(rt.max, c);
+            rt.stack = std::max(rt.stack, f.sp - f.low);
+        }
+        if (!frames_.empty())
+        {
+            frames_.back().low = std::min(frames_.back().low, f.low);       // the callee's stack is the caller's too
+        }
+    }
+}
+
+
+
+//// Cpu: Profile
+void Cpu::setProfile(bool on)
+{
+    profile_ = on;
+    if (on && hot_.empty())
+    {
+        hot_.resize(0x100000);
+    }
+}
+
+
+void Cpu::resetProfile()
+{
+    std::fill(hot_.begin(), hot_.end(), Hotspot{});
+    routines_.clear();
+    stackLow_ = 0xFFFFFFFF;
+}
+
+
+void Cpu::report(std::FILE* out, const Image* image, int top) const
+{
+    auto name = [&](uint32_t a)
+    {
+        char buf[16];
+        std::snprintf(buf, sizeof(buf), "0x%05X", a);
+        return image ? image->describe(a) : std::string(buf);
+    };
+
+    std::fprintf(out, "\n---- %s: %llu instructions", coreName(core_), (unsigned long long)instructions_);
+    if (flashWrites_)
+    {
+        std::fprintf(out, ", %llu FLASH writes dropped (first at 0x%05X)", (unsigned long long)flashWrites_,
+                     firstFlashWrite_);
+    }
+    std::fprintf(out, " ----\n");
+    if (stackLow_ >= map_.ramStart && stackLow_ <= map_.ramEnd)
+    {
+        std::fprintf(out, "stack high-water  SP 0x%05X, %u bytes below the top of RAM\n", stackLow_,
+                     map_.ramEnd - stackLow_);
+    }
+
+    if (!routines_.empty())
+    {
+        std::fprintf(out, "%-32s %8s %10s %10s %10s %12s %6s\n", "routine", "calls", "min", "avg", "max", "total",
+                     "stack");
+        for (auto& [addr, rt] : routines_)
+        {
+            std::fprintf(out, "%-32s %8llu %10llu %10.1f %10llu %12llu %6u\n", name(addr).c_str(),
+                         (unsigned long long)rt.calls, (unsigned long long)rt.min, (double)rt.cycles / rt.calls,
+                         (unsigned long long)rt.max, (unsigned long long)rt.cycles, rt.stack);
+        }
+    }
+
+    if (hot_.empty() || top <= 0)
+    {
+        return;
+    }
+    std::vector<uint32_t> order;
+    uint64_t total = 0;
+    for (uint32_t a = 0; a < hot_.size(); a++)
+    {
+        if (hot_[a].count)
+        {
+            order.push_back(a);
+            total += hot_[a].cycles;
+        }
+    }
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) { return hot_[a].cycles > hot_[b].cycles; });
+    if ((int)order.size() > top)
+    {
+        order.resize(top);
+    }
+
+    std::fprintf(out, "%-22s %10s %10s %6s  %s\n", "hot spot", "count", "cycles", "%", "instruction");
+    for (uint32_t a : order)
+    {
+        const SourceLine* src = image ? image->source(a) : nullptr;
+        std::string text = src ? src->text : disassemble(a);
+        std::fprintf(out, "%-22s %10llu %10llu %5.1f%%  %s\n", name(a).c_str(), (unsigned long long)hot_[a].count,
+                     (unsigned long long)hot_[a].cycles, total ? 100.0 * hot_[a].cycles / total : 0.0, text.c_str());
+    }
+}
+
+
+
+//// Cpu: Disassembler
+std::string Cpu::disassemble(uint32_t addr, unsigned* words) const
+{
+    Insn in = decode([this](uint32_t a) { return fetch(a); }, addr, core_);
+    if (words)
+    {
+        *words = ((in.next - addr) & 0xFFFFF) / 2;
+    }
+
+    auto regName = [](unsigned r) -> std::string
+    {
+        static const char* const special[] = {"PC", "SP", "SR"};
+        return r < 3 ? special[r] : "R" + std::to_string(r);
+    };
+    auto operand = [&](const Opnd& o) -> std::string
+    {
+        char buf[32];
+        switch (o.mode)
+        {
+            case Am::Reg:   return regName(o.reg);
+            case Am::Const: std::snprintf(buf, sizeof(buf), "#%d", o.x); break;
+            case Am::Imm:   std::snprintf(buf, sizeof(buf), "#0x%X", (unsigned)o.x); break;
+            case Am::Abs:   std::snprintf(buf, sizeof(buf), "&0x%X", (unsigned)o.x); break;
+            case Am::Sym:   std::snprintf(buf, sizeof(buf), "0x%X", (o.base + o.x) & 0xFFFFF); break;
+            case Am::Idx:   std::snprintf(buf, sizeof(buf), "%d(%s)", o.x, regName(o.reg).c_str()); break;
+            case Am::Ind:   return "@" + regName(o.reg);
+            case Am::Inc:   return "@" + regName(o.reg) + "+";
+        }
+        return buf;
+    };
+    auto suffix = [&]()
+    {
+        return std::string(in.ext ? "X" : "") + (in.bits == 8 ? ".B" : in.bits == 20 ? ".A" : "");
+    };
+
+    char buf[32];
+    switch (in.kind)
+    {
+        case Insn::I:
+            if (in.op == 4 && in.src.mode == Am::Inc && in.src.reg == 1 && in.dst.mode == Am::Reg && in.dst.reg == 0)
+            {
+                return "RET";
+            }
+            if (in.op == 4 && in.src.mode == Am::Const && in.src.x == 0 && in.dst.mode == Am::Reg && in.dst.reg == 3)
+            {
+                return "NOP";
+            }
+            return formatINames[in.op - 4] + suffix() + " " + operand(in.src) + "," + operand(in.dst);
+        case Insn::II:
+            return formatIINames[in.op] + suffix() + " " + operand(in.src);
+        case Insn::Jump:
+            std::snprintf(buf, sizeof(buf), "%s 0x%X", jumpNames[in.op], in.target);
+            return buf;
+        case Insn::Reti:
+            return "RETI";
+        case Insn::Calla:
+            return "CALLA " + (in.src.mode == Am::Abs || in.src.mode == Am::Imm || in.src.mode == Am::Sym
+                                   ? operand(in.src) : operand(in.src));
+        case Insn::Addr:
+        {
+            static const char* const names[] = {"MOVA", "CMPA", "ADDA", "SUBA"};
+            if (in.op == 1 && in.src.reg == 1 && in.dst.reg == 0)
+            {
+                return "RETA";
+            }
+            std::string n = in.op >= 0x8 ? names[in.op & 3] : "MOVA";
+            Opnd s = in.src, d = in.dst;
+            if (in.op == 0x6 || in.op == 0x7)
+            {
+                s.mode = Am::Reg;
+            }
+            if (in.op < 0x6 || in.op >= 0x8)
+            {
+                d.mode = Am::Reg;
+            }
+            if (in.op >= 0xC)
+            {
+                s.mode = Am::Reg;
+            }
+            return n + " " + operand(s) + "," + operand(d);
+        }
+        case Insn::PushM:
+        case Insn::PopM:
+            std::snprintf(buf, sizeof(buf), "%s%s #%u,", in.kind == Insn::PushM ? "PUSHM" : "POPM",
+                          in.bits == 20 ? ".A" : ".W", in.n);
+            return buf + regName(in.kind == Insn::PushM ? in.dst.reg : in.dst.reg + in.n - 1);
+        case Insn::RotM:
+            std::snprintf(buf, sizeof(buf), "%s%s #%u,", rotNames[in.op], in.bits == 20 ? ".A" : ".W", in.n);
+            return buf + regName(in.dst.reg);
+        default:
+            std::snprintf(buf, sizeof(buf), ".word 0x%04X", in.word);
+            return buf;
+    }
+}
+
+}   // namespace hostsim
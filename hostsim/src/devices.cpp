@@ -0,0 +1,368 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        devices.cpp
+ * Description:     Symbol tables and peripheral wiring of the F5529, FG4618 and
+ *              F2013. Register addresses are looked up by name in the same .def
+ *              tables the host device headers are generated from, so the models
+ *              and the lab code can never disagree on where a register lives
+ *
+ * Input:       device selection
+ * Output:      reset machine with its peripherals mapped onto the bus
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+
+namespace hostsim
+{
+
+//// Symbol Tables
+namespace
+{
+
+#define HOSTSIM_SFR(name, addr, bits) {#name, addr, bits},
+#define HOSTSIM_CONST(name, value) {#name, value, 0},
+
+const std::vector<Symbol> f5529Symbols = {
+#include "hostsim/devices/f5529.def"
+};
+
+const std::vector<Symbol> fg4618Symbols = {
+#include "hostsim/devices/fg4618.def"
+};
+
+const std::vector<Symbol> f2013Symbols = {
+#include "hostsim/devices/f2013.def"
+};
+
+#undef HOSTSIM_SFR
+#undef HOSTSIM_CONST
+
+}   // namespace
+
+
+const std::vector<Symbol>& deviceSymbols(Device device)
+{
+    switch (device)
+    {
+        case Device::FG4618: return fg4618Symbols;
+        case Device::F2013:  return f2013Symbols;
+        default:             return f5529Symbols;
+    }
+}
+
+
+uint32_t symbolValue(Device device, const char* name)
+{
+    static std::unordered_map<std::string, uint32_t> index[3];
+
+    auto& map = index[(int)device];
+    if (map.empty())
+    {
+        for (const Symbol& s : deviceSymbols(device))
+        {
+            map.emplace(s.name, s.value);
+        }
+    }
+
+    auto it = map.find(name);
+    if (it == map.end())
+    {
+        throw std::logic_error(std::string("hostsim: no symbol ") + name + " on " + deviceName(device));
+    }
+    return it->second;
+}
+
+
+
+//// Device Wiring
+namespace
+{
+
+struct Wiring
+{
+    Machine& m;
+    Device d;
+
+    uint32_t at(const std::string& name) const { return symbolValue(d, name.c_str()); }
+    int vec(const char* name) const { return (int)symbolValue(d, name); }
+
+    void map16(Peripheral& p, uint32_t addr) { m.map(addr, addr + 1, p); }
+
+    void ports(int count, int irqPorts, bool hasIv, bool hasRen)
+    {
+        std::vector<PortConfig> cfg;
+        for (int n = 1; n <= count; n++)
+        {
+            std::string p = "P" + std::to_string(n);
+            PortConfig c{};
+            c.number = n;
+            c.in = at(p + "IN");
+            c.out = at(p + "OUT");
+            c.dir = at(p + "DIR");
+            c.sel = at(p + "SEL");
+            c.ren = hasRen ? at(p + "REN") : 0;
+            if (n <= irqPorts)
+            {
+                c.ifg = at(p + "IFG");
+                c.ies = at(p + "IES");
+                c.ie = at(p + "IE");
+                c.iv = hasIv ? at(p + "IV") : 0;
+                c.vector = vec(n == 1 ? "PORT1_VECTOR" : "PORT2_VECTOR");
+            }
+            cfg.push_back(c);
+        }
+
+        Gpio& g = m.add<Gpio>(cfg);
+        for (auto& c : cfg)
+        {
+            for (uint32_t a : {c.in, c.out, c.dir, c.ren, c.sel, c.ifg, c.ies, c.ie})
+            {
+                if (a)
+                {
+                    m.map(a, a, g);
+                }
+            }
+            if (c.iv)
+            {
+                map16(g, c.iv);
+            }
+        }
+    }
+
+    Timer& timer(const char* name, const std::string& prefix, int channels, const char* v0, const char* v1,
+                 uint16_t ivOverflow, bool ex0)
+    {
+        TimerConfig c{};
+        c.name = name;
+        c.ctl = at(prefix + "CTL");
+        c.cctl0 = at(prefix + "CCTL0");
+        c.r = at(prefix + "R");
+        c.ccr0 = at(prefix + "CCR0");
+        c.ex0 = ex0 ? at(prefix + "EX0") : 0;
+        c.iv = at(prefix + "IV");
+        c.channels = channels;
+        c.vector0 = vec(v0);
+        c.vector1 = vec(v1);
+        c.ivOverflow = ivOverflow;
+
+        Timer& t = m.add<Timer>(c);
+        map16(t, c.ctl);
+        map16(t, c.r);
+        map16(t, c.iv);
+        m.map(c.cctl0, c.cctl0 + 2 * channels - 1, t);
+        m.map(c.ccr0, c.ccr0 + 2 * channels - 1, t);
+        if (c.ex0)
+        {
+            map16(t, c.ex0);
+        }
+        return t;
+    }
+
+    Usci& usci(const char* name, const std::string& p, bool uart, const std::string& ie, const std::string& ifg,
+               uint8_t rxBit, uint8_t txBit, const char* rxVec, const char* txVec, bool hasIv)
+    {
+        UsciConfig c{};
+        c.name = name;
+        c.ctl0 = at(p + "CTL0");
+        c.ctl1 = at(p + "CTL1");
+        c.br0 = at(p + "BR0");
+        c.br1 = at(p + "BR1");
+        c.mctl = uart ? at(p + "MCTL") : 0;
+        c.stat = at(p + "STAT");
+        c.rxbuf = at(p + "RXBUF");
+        c.txbuf = at(p + "TXBUF");
+        c.ie = at(ie);
+        c.ifg = at(ifg);
+        c.iv = hasIv ? at(p + "IV") : 0;
+        c.rxBit = rxBit;
+        c.txBit = txBit;
+        c.rxVector = vec(rxVec);
+        c.txVector = vec(txVec);
+
+        Usci& u = m.add<Usci>(c);
+        for (uint32_t a : {c.ctl0, c.ctl1, c.br0, c.br1, c.mctl, c.stat, c.rxbuf, c.txbuf})
+        {
+            if (a)
+            {
+                m.map(a, a, u);
+            }
+        }
+        if (hasIv)
+        {
+            m.map(c.ie, c.ie, u);                   // UCAxIE/UCAxIFG belong to the module on 5xx
+            m.map(c.ifg, c.ifg, u);
+            map16(u, c.iv);
+        }
+        return u;
+    }
+
+    void adc12(const std::string& ifg, const std::string& ie)
+    {
+        Adc12Config c{};
+        c.ctl0 = at("ADC12CTL0");
+        c.ctl1 = at("ADC12CTL1");
+        c.ifg = at(ifg);
+        c.ie = at(ie);
+        c.iv = at("ADC12IV");
+        c.mctl0 = at("ADC12MCTL0");
+        c.mem0 = at("ADC12MEM0");
+        c.vector = vec("ADC12_VECTOR");
+
+        Adc12& a = m.add<Adc12>(c);
+        for (uint32_t r : {c.ctl0, c.ctl1, c.ifg, c.ie, c.iv})
+        {
+            map16(a, r);
+        }
+        m.map(c.mctl0, c.mctl0 + 15, a);
+        m.map(c.mem0, c.mem0 + 31, a);
+    }
+
+    void wdt(const char* ie, const char* ifg, bool wdtA)
+    {
+        WdtConfig c{};
+        c.ctl = at("WDTCTL");
+        c.ie = at(ie);
+        c.ifg = at(ifg);
+        c.ieBit = 0x01;                             // WDTIE
+        c.ifgBit = 0x01;                            // WDTIFG
+        c.vector = vec("WDT_VECTOR");
+        c.wdtA = wdtA;
+        map16(m.add<Wdt>(c), c.ctl);
+    }
+
+    void mpy(bool mpy32)
+    {
+        MpyConfig c{at("MPY"), mpy32};
+        m.map(c.base, c.base + (mpy32 ? 0x2F : 0x0F), m.add<Mpy32>(c));
+    }
+
+    void vectorNames()
+    {
+        for (const Symbol& s : deviceSymbols(d))
+        {
+            size_t len = std::strlen(s.name);
+            if (!s.bits && len > 7 && !std::strcmp(s.name + len - 7, "_VECTOR") && s.value < NUM_VECTORS)
+            {
+                m.setVectorName(s.value, s.name);
+            }
+        }
+    }
+};
+
+
+void wireF5529(Wiring& w)
+{
+    Machine& m = w.m;
+
+    Ucs& ucs = m.add<Ucs>(w.at("UCSCTL0"));
+    m.setClocks(ucs);
+    m.map(w.at("UCSCTL0"), w.at("UCSCTL8") + 1, ucs);
+
+    w.ports(8, 2, true, true);
+    w.timer("TA0", "TA0", 5, "TIMER0_A0_VECTOR", "TIMER0_A1_VECTOR", 0x0E, true);
+    w.timer("TA1", "TA1", 3, "TIMER1_A0_VECTOR", "TIMER1_A1_VECTOR", 0x0E, true);
+    w.timer("TA2", "TA2", 3, "TIMER2_A0_VECTOR", "TIMER2_A1_VECTOR", 0x0E, true);
+    w.timer("TB0", "TB0", 7, "TIMER0_B0_VECTOR", "TIMER0_B1_VECTOR", 0x0E, true);
+    w.wdt("SFRIE1", "SFRIFG1", true);
+    w.usci("UCA0", "UCA0", true, "UCA0IE", "UCA0IFG", 0x01, 0x02, "USCI_A0_VECTOR", "USCI_A0_VECTOR", true);
+    w.usci("UCA1", "UCA1", true, "UCA1IE", "UCA1IFG", 0x01, 0x02, "USCI_A1_VECTOR", "USCI_A1_VECTOR", true);
+    w.usci("UCB0", "UCB0", false, "UCB0IE", "UCB0IFG", 0x01, 0x02, "USCI_B0_VECTOR", "USCI_B0_VECTOR", true);
+    w.usci("UCB1", "UCB1", false, "UCB1IE", "UCB1IFG", 0x01, 0x02, "USCI_B1_VECTOR", "USCI_B1_VECTOR", true);
+    w.adc12("ADC12IFG", "ADC12IE");
+    w.mpy(true);
+
+    DmaConfig dma{w.at("DMACTL0"), w.at("DMAIV"), w.at("DMA0CTL"), w.vec("DMA_VECTOR")};
+    m.map(dma.ctl0, w.at("DMA2SZ") + 1, m.add<Dma>(dma));
+}
+
+
+void wireFG4618(Wiring& w)
+{
+    Machine& m = w.m;
+
+    FllPlus& fll = m.add<FllPlus>(w.at("SCFI0"), w.at("SCFQCTL"), w.at("FLL_CTL0"), w.at("FLL_CTL1"));
+    m.setClocks(fll);
+    m.map(w.at("SCFI0"), w.at("FLL_CTL1"), fll);
+
+    w.ports(10, 2, false, true);
+    w.timer("TA0", "TA", 3, "TIMERA0_VECTOR", "TIMERA1_VECTOR", 0x0A, false);
+    w.timer("TB0", "TB", 7, "TIMERB0_VECTOR", "TIMERB1_VECTOR", 0x0E, false);
+    w.wdt("IE1", "IFG1", false);
+    w.usci("UCA0", "UCA0", true, "IE2", "IFG2", 0x01, 0x02, "USCIAB0RX_VECTOR", "USCIAB0TX_VECTOR", false);
+    w.usci("UCB0", "UCB0", false, "IE2", "IFG2", 0x04, 0x08, "USCIAB0RX_VECTOR", "USCIAB0TX_VECTOR", false);
+    w.adc12("ADC12IFG", "ADC12IE");
+    w.mpy(false);
+
+    Dac12& dac = m.add<Dac12>(w.at("DAC12_0DAT"), w.at("DAC12_1DAT"));
+    m.map(w.at("DAC12_0DAT"), w.at("DAC12_1DAT") + 1, dac);
+}
+
+
+void wireF2013(Wiring& w)
+{
+    Machine& m = w.m;
+
+    BcsPlus& bcs = m.add<BcsPlus>(w.at("DCOCTL"), w.at("BCSCTL1"), w.at("BCSCTL2"), w.at("CALDCO_16MHZ"));
+    m.setClocks(bcs);
+    m.map(w.at("DCOCTL"), w.at("BCSCTL2"), bcs);
+    m.map(w.at("BCSCTL3"), w.at("BCSCTL3"), bcs);
+
+    w.ports(2, 2, false, true);
+    w.timer("TA0", "TA", 2, "TIMERA0_VECTOR", "TIMERA1_VECTOR", 0x0A, false);
+    w.wdt("IE1", "IFG1", false);
+
+    UsiConfig c{w.at("USICTL0"), w.at("USICTL1"), w.at("USICKCTL"), w.at("USICNT"), w.at("USISRL"), w.at("USISRH"),
+                w.vec("USI_VECTOR")};
+    m.map(c.ctl0, c.srh, m.add<Usi>(c));
+}
+
+}   // namespace
+
+
+std::unique_ptr<Machine> makeMachine(Device device)
+{
+    auto m = std::make_unique<Machine>(device);
+    Wiring w{*m, device};
+
+    switch (device)
+    {
+        case Device::F5529:
+            wireF5529(w);
+            break;
+
+        case Device::FG4618:
+            wireFG4618(w);
+            break;
+
+        case Device::F2013:
+            wireF2013(w);
+            break;
+    }
+    w.vectorNames();
+
+    for (auto& p : m->peripherals())
+    {
+        p->reset();
+    }
+
+    // MSP-EXP430FG4618: SW1/SW2 on P1.0/P1.1 have pull-ups on the board
+    if (device == Device::FG4618)
+    {
+        Gpio* g = m->find<Gpio>();
+        g->boardPull(1, 0, 1);
+        g->boardPull(1, 1, 1);
+    }
+
+    return m;
+}
+
+}   // namespace hostsim
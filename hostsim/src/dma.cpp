@@ -0,0 +1,362 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        dma.cpp
+ * Description:     F5529 DMA controller: three channels with single, block and
+ *              repeated transfers, byte/word source and destination, address
+ *              increment/decrement and DMAIFG/DMAIV interrupts. Triggers are
+ *              DMAREQ, the hardware multiplier's "ready" (the operation started
+ *              by the last OP2 write has completed) and DMA(n-1)IFG of the
+ *              previous channel; the timer, USCI and ADC12 triggers are not
+ *              wired and never fire. Each trigger takes one MCLK cycle to
+ *              synchronise and each transfer two bus cycles and one wait
+ *              cycle (SLAU208 "DMA Transfer Cycle Time"), which the machine
+ *              counts as MCLK cycles with the CPU stalled or asleep. With the
+ *              CPU off, a channel waiting on the multiplier keeps MCLK running
+ *              until it completes, so a MACS/OP2 pair of channels runs through
+ *              a whole vector without waking the CPU. Burst-block transfers
+ *              run as plain blocks (the CPU gets no cycles in between)
+ *
+ * Input:       DMACTL0/1, DMAxCTL/SA/DA/SZ, multiplier completion
+ * Output:      memory/register transfers, DMAxIFG, DMAIV, DMA interrupt requests
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+#include <algorithm>
+
+// Macros (DMAxCTL bits)
+#define DMA_REQ         0x0001
+#define DMA_IE          0x0004
+#define DMA_IFG         0x0008
+#define DMA_EN          0x0010
+#define DMA_SRCBYTE     0x0040
+#define DMA_DSTBYTE     0x0080
+
+// Macros (channel register offsets, trigger numbers)
+#define DMA_SA          0x02
+#define DMA_DA          0x06
+#define DMA_SZ          0x0A
+#define TSEL_REQ        0               // DMAREQ
+#define TSEL_MPY        29              // hardware multiplier ready
+#define TSEL_CHAIN      30              // DMA(n-1)IFG
+
+
+namespace hostsim
+{
+
+//// Local Functions
+namespace
+{
+
+int32_t step(unsigned incr, bool byte)
+/* DMASRCINCR/DMADSTINCR: 10b decrements, 11b increments, by 1 or 2
+ */
+{
+    int32_t size = byte ? 1 : 2;
+    return incr == 3 ? size : incr == 2 ? -size : 0;
+}
+
+}   // namespace
+
+
+
+//// Function Definitions
+Dma::Dma(Machine& m, DmaConfig cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+unsigned Dma::tsel(int n) const
+{
+    uint16_t v = m_.raw16(cfg_.ctl0 + 2 * (n / 2));     // DMA0/1TSEL in DMACTL0, DMA2TSEL in DMACTL1
+    return ((n & 1) ? v >> 8 : v) & 0x1F;
+}
+
+
+bool Dma::mpyWaiting() const
+/* an operation is in flight whose completion will trigger an enabled channel
+ */
+{
+    if (!mpy_ || mpy_->doneCycle() <= mpySeen_ || mpy_->doneCycle() <= m_.cycles())
+    {
+        return false;
+    }
+    for (int n = 0; n < 3; n++)
+    {
+        if ((ctl(n) & DMA_EN) && tsel(n) == TSEL_MPY && ch_[n].size)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void Dma::latchMpy()
+{
+    if (!mpy_)
+    {
+        return;
+    }
+    uint64_t done = mpy_->doneCycle();
+    if (done <= mpySeen_ || done > m_.cycles())
+    {
+        return;
+    }
+
+    mpySeen_ = done;                                // one edge, however many channels take it
+    for (int n = 0; n < 3; n++)
+    {
+        if ((ctl(n) & DMA_EN) && tsel(n) == TSEL_MPY && ch_[n].size)
+        {
+            ch_[n].request = true;
+        }
+    }
+}
+
+
+void Dma::enable(int n)
+/* DMAEN set: DMAxSA/DA/SZ are copied to the working registers; only
+ * multiplier completions from now on count as triggers
+ */
+{
+    Channel& ch = ch_[n];
+    ch.sa = m_.raw(reg(n, DMA_SA), 20);
+    ch.da = m_.raw(reg(n, DMA_DA), 20);
+    ch.size = m_.raw16(reg(n, DMA_SZ));
+    ch.request = false;
+    if (tsel(n) == TSEL_MPY)
+    {
+        mpySeen_ = std::max(mpySeen_, m_.cycles());
+    }
+}
+
+
+void Dma::service(int n)
+/* one trigger of channel n: a single transfer, or the rest of the block
+ */
+{
+    Channel& ch = ch_[n];
+    uint16_t c = ctl(n);
+    unsigned dt = (c >> 12) & 7;
+    bool block = (dt & 3) != 0;                     // block, burst-block and their repeated forms
+    bool srcByte = c & DMA_SRCBYTE, dstByte = c & DMA_DSTBYTE;
+    int32_t srcStep = step((c >> 8) & 3, srcByte);
+    int32_t dstStep = step((c >> 10) & 3, dstByte);
+
+    ch.request = false;
+    stats_.triggers++;
+    m_.stall(1);                                    // synchronisation
+
+    do
+    {
+        uint32_t v = m_.load(srcByte ? ch.sa : ch.sa & ~1u, srcByte ? 8 : 16);
+        m_.store(dstByte ? ch.da : ch.da & ~1u, dstByte ? 8 : 16, dstByte ? v & 0xFF : v);
+        m_.stall(3);                                // two bus cycles, one wait cycle
+        stats_.transfers[n]++;
+
+        ch.sa = (ch.sa + srcStep) & 0xFFFFF;
+        ch.da = (ch.da + dstStep) & 0xFFFFF;
+        uint16_t left = (uint16_t)(m_.raw16(reg(n, DMA_SZ)) - 1);
+        m_.setRaw16(reg(n, DMA_SZ), left);
+        if (left)
+        {
+            continue;
+        }
+
+        // count ran out: reload, flag, and stop unless repeated
+        stats_.blocks++;
+        ch.sa = m_.raw(reg(n, DMA_SA), 20);
+        ch.da = m_.raw(reg(n, DMA_DA), 20);
+        m_.setRaw16(reg(n, DMA_SZ), ch.size);
+        c = ctl(n) | DMA_IFG;
+        if (dt < 4)
+        {
+            c &= ~DMA_EN;
+        }
+        m_.setRaw16(reg(n, 0), c);
+
+        int next = (n + 1) % 3;
+        if ((ctl(next) & DMA_EN) && tsel(next) == TSEL_CHAIN && ch_[next].size)
+        {
+            ch_[next].request = true;
+        }
+        return;
+    } while (block);
+}
+
+
+uint32_t Dma::read(uint32_t addr, unsigned bits)
+{
+    if ((addr & ~1u) != cfg_.iv)
+    {
+        return Peripheral::read(addr, bits);
+    }
+
+    // DMAIV: highest-priority enabled flag, cleared by the read
+    for (int n = 0; n < 3; n++)
+    {
+        uint16_t c = ctl(n);
+        if ((c & DMA_IE) && (c & DMA_IFG))
+        {
+            m_.setRaw16(reg(n, 0), c & ~DMA_IFG);
+            return (addr & 1) ? 0 : 2 * (n + 1);
+        }
+    }
+    return 0;
+}
+
+
+void Dma::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if ((addr & ~1u) == cfg_.iv)
+    {
+        return;                                     // read only
+    }
+    if (addr < cfg_.ch0 || addr >= reg(3, 0))
+    {
+        m_.setRaw(addr, bits, value);               // DMACTL0..4
+        return;
+    }
+
+    int n = (addr - cfg_.ch0) / 0x10;
+    uint32_t off = (addr - cfg_.ch0) % 0x10;
+    if ((off & ~1u) != 0)
+    {
+        m_.setRaw(addr, bits, value);
+        if (bits == 16 && (off == DMA_SA || off == DMA_DA))
+        {
+            m_.setRaw16(addr + 2, 0);               // a word write clears address bits 19..16
+        }
+        return;
+    }
+
+    // DMAxCTL
+    uint16_t old = ctl(n);
+    m_.setRaw(addr, bits, value);
+    uint16_t c = ctl(n);
+
+    if ((c & DMA_EN) && !(old & DMA_EN))
+    {
+        enable(n);
+    }
+    if (c & DMA_REQ)
+    {
+        if ((c & DMA_EN) && tsel(n) == TSEL_REQ && ch_[n].size)
+        {
+            ch_[n].request = true;
+        }
+        c &= ~DMA_REQ;                              // self-clearing
+    }
+    if (!(c & DMA_EN))
+    {
+        ch_[n].request = false;
+    }
+    m_.setRaw16(reg(n, 0), c);
+}
+
+
+void Dma::advance(uint64_t now)
+/* runs the latched triggers in channel priority order; with the CPU off,
+ * also the multiplier-paced transfers up to the end of their vectors
+ */
+{
+    (void)now;
+    if (running_)
+    {
+        return;                                     // a transfer touched a DMA register
+    }
+    running_ = true;
+
+    for (;;)
+    {
+        latchMpy();
+
+        int n = 0;
+        while (n < 3 && !ch_[n].request)
+        {
+            n++;
+        }
+        if (n < 3)
+        {
+            service(n);
+            continue;
+        }
+
+        if ((m_.sr() & SR_CPUOFF) && mpyWaiting())
+        {
+            m_.stall(mpy_->doneCycle() - m_.cycles());
+            continue;
+        }
+        break;
+    }
+    running_ = false;
+}
+
+
+uint64_t Dma::nextEvent() const
+{
+    for (const Channel& ch : ch_)
+    {
+        if (ch.request)
+        {
+            return m_.now();
+        }
+    }
+    if (!mpyWaiting())
+    {
+        return NEVER;
+    }
+    return m_.now() + (mpy_->doneCycle() - m_.cycles()) * PS_PER_S / m_.clocks().mclk();
+}
+
+
+uint64_t Dma::pending() const
+{
+    for (int n = 0; n < 3; n++)
+    {
+        if ((ctl(n) & DMA_IE) && (ctl(n) & DMA_IFG))
+        {
+            return 1ull << cfg_.vector;
+        }
+    }
+    return 0;
+}
+
+
+void Dma::reset()
+{
+    for (Channel& ch : ch_)
+    {
+        ch = Channel();
+    }
+    mpy_ = m_.find<Mpy32>();
+    mpySeen_ = 0;
+    running_ = false;
+}
+
+
+void Dma::report(std::FILE* out, double seconds) const
+{
+    (void)seconds;
+    const DmaStats& s = stats_;
+    uint64_t total = s.transfers[0] + s.transfers[1] + s.transfers[2];
+    if (!total)
+    {
+        return;
+    }
+
+    std::fprintf(out, "%-18s %llu transfers (DMA0 %llu, DMA1 %llu, DMA2 %llu), %llu triggers, %llu blocks, "
+                      "%llu MCLK cycles\n",
+                 name(), (unsigned long long)total, (unsigned long long)s.transfers[0],
+                 (unsigned long long)s.transfers[1], (unsigned long long)s.transfers[2],
+                 (unsigned long long)s.triggers, (unsigned long long)s.blocks,
+                 (unsigned long long)m_.stats().dmaCycles);
+}
+
+}   // namespace hostsim
@@ -0,0 +1,149 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        elf.cpp
+ * Description:     ELF32 loader for executables linked by CCS (TI armcl/cl430) or
+ *              msp430-elf-gcc: PT_LOAD segments at their load address and the
+ *              symbol table as labels. No DWARF, so hot spots of an ELF image
+ *              are shown disassembled instead of with their source line
+ *
+ * Input:       .out/.elf file
+ * Output:      Image
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/image.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+// Macros
+#define EM_MSP430       105
+#define PT_LOAD         1
+#define SHT_SYMTAB      2
+#define STT_SECTION     3
+#define STT_FILE        4
+#define STB_GLOBAL      1
+
+
+namespace hostsim
+{
+
+namespace
+{
+
+uint32_t le32(const std::vector<uint8_t>& b, size_t off)
+{
+    if (off + 4 > b.size())
+    {
+        throw std::runtime_error("truncated ELF file");
+    }
+    return b[off] | (b[off + 1] << 8) | (b[off + 2] << 16) | ((uint32_t)b[off + 3] << 24);
+}
+
+uint16_t le16(const std::vector<uint8_t>& b, size_t off)
+{
+    if (off + 2 > b.size())
+    {
+        throw std::runtime_error("truncated ELF file");
+    }
+    return b[off] | (b[off + 1] << 8);
+}
+
+}   // namespace
+
+
+
+//// Loaders
+Image loadElf(const std::string& path, Device device)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+    {
+        throw std::runtime_error(path + ": cannot open");
+    }
+    std::vector<uint8_t> b((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    if (b.size() < 52 || std::memcmp(b.data(), "\x7f" "ELF", 4) || b[4] != 1 || b[5] != 1)
+    {
+        throw std::runtime_error(path + ": not a little-endian ELF32 file");
+    }
+    if (le16(b, 18) != EM_MSP430)
+    {
+        throw std::runtime_error(path + ": not an MSP430 executable");
+    }
+
+    Image img;
+    img.device = device;
+    img.entry = le32(b, 24) & 0xFFFFF;
+
+    // program headers: what the debugger would download
+    uint32_t phoff = le32(b, 28);
+    uint16_t phentsize = le16(b, 42), phnum = le16(b, 44);
+    for (unsigned i = 0; i < phnum; i++)
+    {
+        size_t ph = phoff + (size_t)i * phentsize;
+        if (le32(b, ph) != PT_LOAD)
+        {
+            continue;
+        }
+        uint32_t offset = le32(b, ph + 4), paddr = le32(b, ph + 12), filesz = le32(b, ph + 16);
+        if (!filesz)
+        {
+            continue;
+        }
+        if ((size_t)offset + filesz > b.size())
+        {
+            throw std::runtime_error(path + ": segment outside the file");
+        }
+        char name[16];
+        std::snprintf(name, sizeof(name), "load%u", i);
+        img.segments.push_back({name, paddr, std::vector<uint8_t>(b.begin() + offset, b.begin() + offset + filesz)});
+    }
+
+    // section headers: symbol table -> labels
+    uint32_t shoff = le32(b, 32);
+    uint16_t shentsize = le16(b, 46), shnum = le16(b, 48);
+    for (unsigned i = 0; shoff && i < shnum; i++)
+    {
+        size_t sh = shoff + (size_t)i * shentsize;
+        if (le32(b, sh + 4) != SHT_SYMTAB)
+        {
+            continue;
+        }
+        uint32_t symoff = le32(b, sh + 16), symsize = le32(b, sh + 20), link = le32(b, sh + 24);
+        uint32_t entsize = le32(b, sh + 36) ? le32(b, sh + 36) : 16;
+        uint32_t stroff = le32(b, shoff + (size_t)link * shentsize + 16);
+
+        for (uint32_t s = entsize; s < symsize; s += entsize)
+        {
+            size_t sym = symoff + s;
+            uint32_t nameOff = le32(b, sym), value = le32(b, sym + 4);
+            uint8_t info = b.at(sym + 12);
+            uint16_t shndx = le16(b, sym + 14);
+            if (!shndx || (info & 0xF) == STT_SECTION || (info & 0xF) == STT_FILE)
+            {
+                continue;
+            }
+            const char* name = (const char*)b.data() + stroff + nameOff;
+            if (stroff + nameOff >= b.size() || !*name || *name == '$')
+            {
+                continue;
+            }
+            img.labels.push_back({name, value & 0xFFFFF, (info >> 4) == STB_GLOBAL});
+        }
+    }
+
+    if (img.segments.empty())
+    {
+        throw std::runtime_error(path + ": no loadable segments");
+    }
+    return img;
+}
+
+}   // namespace hostsim
@@ -0,0 +1,292 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        gpio.cpp
+ * Description:     Digital I/O ports. PxIN is recomputed whenever the direction,
+ *              output, resistor or external drive of a pin changes; edges that
+ *              match PxIES latch PxIFG. Output pins count their level changes so
+ *              LED blink rates can be read back from the run report
+ *
+ * Input:       PxOUT/PxDIR/PxREN/PxIES/PxIE writes, scripted external drive
+ * Output:      PxIN, PxIFG/PxIV, port interrupt requests, toggle statistics
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+#include <algorithm>
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+Gpio::Gpio(Machine& m, std::vector<PortConfig> ports)
+    : Peripheral(m)
+{
+    for (auto& cfg : ports)
+    {
+        Port p;
+        p.cfg = cfg;
+        ports_.push_back(p);
+    }
+}
+
+
+Gpio::Port* Gpio::portOf(uint32_t addr)
+{
+    for (auto& p : ports_)
+    {
+        const PortConfig& c = p.cfg;
+        if (addr == c.in || addr == c.out || addr == c.dir || addr == c.ren || addr == c.sel
+            || (c.ifg && (addr == c.ifg || addr == c.ies || addr == c.ie)))
+        {
+            return &p;
+        }
+    }
+    return nullptr;
+}
+
+
+Gpio::Port* Gpio::portNumber(int n)
+{
+    for (auto& p : ports_)
+    {
+        if (p.cfg.number == n)
+        {
+            return &p;
+        }
+    }
+    return nullptr;
+}
+
+
+void Gpio::update(Port& p)
+/* recomputes PxIN, latches edge flags and counts output level changes
+ */
+{
+    const PortConfig& c = p.cfg;
+    uint8_t out = m_.raw8(c.out);
+    uint8_t dir = m_.raw8(c.dir);
+    uint8_t ren = c.ren ? m_.raw8(c.ren) : 0;
+
+    uint8_t in = 0;
+    for (int b = 0; b < 8; b++)
+    {
+        uint8_t bit = 1 << b;
+        int level;
+
+        if (dir & bit)
+        {
+            level = (out & bit) != 0;           // output: reads back what it drives
+        }
+        else if (p.pins[b].drive >= 0)
+        {
+            level = p.pins[b].drive;            // switch/jumper/other chip
+        }
+        else if (ren & bit)
+        {
+            level = (out & bit) != 0;           // PxREN: PxOUT selects pull-up/down
+        }
+        else if (p.pins[b].pull >= 0)
+        {
+            level = p.pins[b].pull;             // resistor on the board
+        }
+        else
+        {
+            level = 0;                          // floating input reads low
+        }
+        in |= level ? bit : 0;
+    }
+
+    // edge detect: PxIES = 1 -> high-to-low, 0 -> low-to-high
+    uint8_t old = m_.raw8(c.in);
+    if (c.ifg)
+    {
+        uint8_t ies = m_.raw8(c.ies);
+        uint8_t edges = (old & ~in & ies) | (~old & in & ~ies);
+        if (edges)
+        {
+            m_.setRaw8(c.ifg, m_.raw8(c.ifg) | edges);
+        }
+    }
+    m_.setRaw8(c.in, in);
+
+    // output toggles
+    uint8_t level = out & dir;
+    uint8_t changed = (level ^ p.level) & dir;
+    for (int b = 0; changed && b < 8; b++)
+    {
+        if (changed & (1 << b))
+        {
+            Pin& pin = p.pins[b];
+            if (!pin.toggles++)
+            {
+                pin.first = m_.now();
+            }
+            pin.last = m_.now();
+        }
+    }
+    p.level = level;
+}
+
+
+uint32_t Gpio::read(uint32_t addr, unsigned bits)
+{
+    for (auto& p : ports_)
+    {
+        const PortConfig& c = p.cfg;
+        if (c.iv && addr == c.iv)
+        {
+            // PxIV: highest priority (lowest numbered) pending pin, cleared by the read
+            uint8_t flags = m_.raw8(c.ifg) & m_.raw8(c.ie);
+            if (!flags)
+            {
+                return 0;
+            }
+            int b = __builtin_ctz(flags);
+            m_.setRaw8(c.ifg, m_.raw8(c.ifg) & ~(1 << b));
+            return 2 * (b + 1);
+        }
+    }
+    return m_.raw(addr, bits);
+}
+
+
+void Gpio::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    for (auto& p : ports_)
+    {
+        if (p.cfg.iv && addr == p.cfg.iv)
+        {
+            return;                             // PxIV is read-only
+        }
+    }
+
+    uint8_t in[16];
+    for (size_t i = 0; i < ports_.size() && i < 16; i++)
+    {
+        in[i] = m_.raw8(ports_[i].cfg.in);
+    }
+
+    m_.setRaw(addr, bits, value);
+
+    // PxIN is read-only: restore it if a word write (PAOUT etc.) or a stray write hit it
+    for (size_t i = 0; i < ports_.size() && i < 16; i++)
+    {
+        m_.setRaw8(ports_[i].cfg.in, in[i]);
+    }
+
+    if (Port* p = portOf(addr))
+    {
+        update(*p);
+    }
+    if (bits == 16)
+    {
+        if (Port* p = portOf(addr + 1))
+        {
+            update(*p);
+        }
+    }
+}
+
+
+void Gpio::advance(uint64_t now)
+{
+    while (!events_.empty() && events_.front().t <= now)
+    {
+        Event e = events_.front();
+        events_.pop_front();
+
+        if (Port* p = portNumber(e.port))
+        {
+            p->pins[e.bit].drive = e.level;
+            update(*p);
+        }
+    }
+}
+
+
+uint64_t Gpio::nextEvent() const
+{
+    return events_.empty() ? NEVER : events_.front().t;
+}
+
+
+uint64_t Gpio::pending() const
+{
+    uint64_t mask = 0;
+    for (auto& p : ports_)
+    {
+        if (p.cfg.ifg && (m_.raw8(p.cfg.ifg) & m_.raw8(p.cfg.ie)))
+        {
+            mask |= 1ull << p.cfg.vector;
+        }
+    }
+    return mask;
+}
+
+
+void Gpio::reset()
+{
+    for (auto& p : ports_)
+    {
+        const PortConfig& c = p.cfg;
+        for (uint32_t a : {c.out, c.dir, c.ren, c.sel, c.ifg, c.ies, c.ie})
+        {
+            if (a)
+            {
+                m_.setRaw8(a, 0);
+            }
+        }
+        p.level = 0;
+        update(p);
+    }
+}
+
+
+void Gpio::drive(uint64_t t, int port, int bit, int level)
+{
+    Event e{t, port, bit, level};
+    auto at = std::upper_bound(events_.begin(), events_.end(), e,
+                               [](const Event& a, const Event& b) { return a.t < b.t; });
+    events_.insert(at, e);
+    m_.scheduleChanged();
+}
+
+
+void Gpio::boardPull(int port, int bit, int level)
+{
+    if (Port* p = portNumber(port))
+    {
+        p->pins[bit].pull = level;
+        update(*p);
+    }
+}
+
+
+void Gpio::report(std::FILE* out, double seconds) const
+{
+    for (auto& p : ports_)
+    {
+        for (int b = 0; b < 8; b++)
+        {
+            const Pin& pin = p.pins[b];
+            if (!pin.toggles)
+            {
+                continue;
+            }
+
+            // full periods between the first and last edge give the blink rate
+            double span = (pin.last - pin.first) / (double)PS_PER_S;
+            double hz = (pin.toggles > 2 && span > 0) ? (pin.toggles - 1) / (2.0 * span) : 0.0;
+            std::fprintf(out, "pin P%d.%d           %llu toggles, %.3f Hz\n", p.cfg.number, b,
+                         (unsigned long long)pin.toggles, hz);
+        }
+    }
+    (void)seconds;
+}
+
+}   // namespace hostsim
@@ -0,0 +1,76 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        intrinsics.cpp
+ * Description:     TI compiler intrinsics forwarded to the current emulated machine
+ *              (see intrinsics.h)
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/intrinsics.h"
+#include "hostsim/machine.h"
+
+using hostsim::Machine;
+
+
+
+//// Function Definitions
+unsigned short __bis_SR_register(unsigned short bits)
+{
+    return Machine::current->bisSR(bits);
+}
+
+
+unsigned short __bic_SR_register(unsigned short bits)
+{
+    return Machine::current->bicSR(bits);
+}
+
+
+unsigned short __bis_SR_register_on_exit(unsigned short bits)
+{
+    unsigned short sr = Machine::current->sr();
+    Machine::current->bisSROnExit(bits);
+    return sr;
+}
+
+
+unsigned short __bic_SR_register_on_exit(unsigned short bits)
+{
+    unsigned short sr = Machine::current->sr();
+    Machine::current->bicSROnExit(bits);
+    return sr;
+}
+
+
+unsigned short __get_SR_register(void)
+{
+    return Machine::current->sr();
+}
+
+
+void __enable_interrupt(void)
+{
+    Machine::current->bisSR(hostsim::SR_GIE);
+}
+
+
+void __disable_interrupt(void)
+{
+    Machine::current->bicSR(hostsim::SR_GIE);
+}
+
+
+void __delay_cycles(unsigned long cycles)
+{
+    Machine::current->delayCycles(cycles);
+}
+
+
+void __no_operation(void)
+{
+    Machine::current->delayCycles(1);
+}
@@ -0,0 +1,53 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        lab.cpp
+ * Description:     Registry of the lab programs linked into the host binary
+ *              (see lab.h)
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/lab.h"
+
+#include <cstring>
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+std::vector<Lab>& labs()
+{
+    static std::vector<Lab> registry;              // filled by static LabRegistrar objects
+    return registry;
+}
+
+
+const Lab* findLab(const char* name)
+{
+    for (const Lab& lab : labs())
+    {
+        if (!std::strcmp(lab.name, name))
+        {
+            return &lab;
+        }
+    }
+    return nullptr;
+}
+
+
+LabCounterRegistrar::LabCounterRegistrar(const char* name, std::initializer_list<LabCounter> counters)
+{
+    for (Lab& lab : labs())
+    {
+        if (!std::strcmp(lab.name, name))
+        {
+            lab.counters.insert(lab.counters.end(), counters);
+        }
+    }
+}
+
+}   // namespace hostsim
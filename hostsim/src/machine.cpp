@@ -0,0 +1,509 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        machine.cpp
+ * Description:     Bus, status register, virtual time and interrupt dispatch of the
+ *              emulated machine (see machine.h)
+ *
+ * Input:       register accesses from the lab program
+ * Output:      peripheral hooks, interrupt handler calls, run statistics
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/machine.h"
+#include "hostsim/reg.h"
+
+#include <algorithm>
+#include <chrono>
+
+
+namespace hostsim
+{
+
+Machine* Machine::current = nullptr;
+
+
+
+//// Function Definitions
+const char* deviceName(Device d)
+{
+    switch (d)
+    {
+        case Device::F5529:  return "MSP430F5529";
+        case Device::FG4618: return "MSP430FG4618";
+        case Device::F2013:  return "MSP430F2013";
+    }
+    return "?";
+}
+
+
+uint32_t busRead(uint32_t addr, unsigned bits)
+{
+    if (!Machine::current)
+    {
+        throw std::logic_error("hostsim: register read with no machine running");
+    }
+    return Machine::current->read(addr, bits);
+}
+
+
+void busWrite(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if (!Machine::current)
+    {
+        throw std::logic_error("hostsim: register write with no machine running");
+    }
+    Machine::current->write(addr, bits, value & ((1u << bits) - 1));
+}
+
+
+uint32_t Peripheral::read(uint32_t addr, unsigned bits)
+{
+    return m_.raw(addr, bits);
+}
+
+
+void Peripheral::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    m_.setRaw(addr, bits, value);
+}
+
+
+
+//// Machine: Construction
+Machine::Machine(Device device)
+    : device_(device), mem_(0x100000, 0), owner_(0x1000, nullptr)
+{
+    current = this;
+}
+
+
+Machine::~Machine()
+{
+    if (current == this)
+    {
+        current = nullptr;
+    }
+}
+
+
+void Machine::map(uint32_t first, uint32_t last, Peripheral& p)
+{
+    for (uint32_t a = first; a <= last && a < owner_.size(); a++)
+    {
+        owner_[a] = &p;
+    }
+}
+
+
+
+//// Machine: Bus
+uint32_t Machine::raw(uint32_t addr, unsigned bits) const
+{
+    switch (bits)
+    {
+        case 8:  return raw8(addr);
+        case 16: return raw16(addr);
+        default: return raw16(addr) | ((raw16(addr + 2) & 0x000F) << 16);  // 20-bit (DMAxSA/DA)
+    }
+}
+
+
+void Machine::setRaw(uint32_t addr, unsigned bits, uint32_t v)
+{
+    switch (bits)
+    {
+        case 8:  setRaw8(addr, v); break;
+        case 16: setRaw16(addr, v); break;
+        default: setRaw16(addr, v); setRaw16(addr + 2, (v >> 16) & 0x000F); break;
+    }
+}
+
+
+uint32_t Machine::read(uint32_t addr, unsigned bits)
+{
+    stats_.reads++;
+    tick(accessCycles_);
+
+    Peripheral* p = addr < owner_.size() ? owner_[addr] : nullptr;
+    if (p)
+    {
+        p->advance(now_);
+        return p->read(addr, bits);
+    }
+    return raw(addr, bits);
+}
+
+
+void Machine::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    stats_.writes++;
+    tick(accessCycles_);
+
+    Peripheral* p = addr < owner_.size() ? owner_[addr] : nullptr;
+    if (p)
+    {
+        p->advance(now_);
+        p->write(addr, bits, value);
+    }
+    else
+    {
+        setRaw(addr, bits, value);
+    }
+
+    deadline_ = 0;                      // configuration may have moved an event
+    service();                          // ... or enabled a pending interrupt
+}
+
+
+uint32_t Machine::load(uint32_t addr, unsigned bits)
+{
+    Peripheral* p = addr < owner_.size() ? owner_[addr] : nullptr;
+    if (p)
+    {
+        stats_.reads++;
+        p->advance(now_);
+        return p->read(addr, bits);
+    }
+    return raw(addr, bits);
+}
+
+
+void Machine::store(uint32_t addr, unsigned bits, uint32_t value)
+{
+    Peripheral* p = addr < owner_.size() ? owner_[addr] : nullptr;
+    if (p)
+    {
+        stats_.writes++;
+        p->advance(now_);
+        p->write(addr, bits, value);
+        deadline_ = 0;                  // serviced by the instruction's tick
+        return;
+    }
+    setRaw(addr, bits, value);
+}
+
+
+
+//// Machine: Time
+void Machine::tick(uint64_t cycles)
+{
+    elapse(cycles);
+
+    if (now_ >= deadline_)
+    {
+        advanceAll();
+        service();
+    }
+}
+
+
+void Machine::stall(uint64_t cycles)
+/* a bus master other than the CPU ran for 'cycles' MCLK cycles: time and
+ * cycles() move on, nothing is advanced or serviced (the caller is a
+ * peripheral's advance())
+ */
+{
+    stats_.dmaCycles += cycles;
+    elapse(cycles);
+}
+
+
+void Machine::elapse(uint64_t cycles)
+{
+    cycles_ += cycles;
+
+    // exact MCLK -> picosecond conversion, carrying the remainder
+    unsigned __int128 num = (unsigned __int128)cycles * PS_PER_S + remainder_;
+    uint64_t hz = clocks_->mclk();
+    now_ += (uint64_t)(num / hz);
+    remainder_ = (uint64_t)(num % hz);
+
+    if (now_ >= limit_)
+    {
+        now_ = limit_;
+        throw Halt("time limit reached");
+    }
+}
+
+
+void Machine::advanceAll()
+{
+    deadline_ = NEVER;
+    for (auto& p : periph_)
+    {
+        p->advance(now_);
+        uint64_t t = p->nextEvent();
+        if (t < deadline_)
+        {
+            deadline_ = t;
+        }
+    }
+}
+
+
+
+//// Machine: CPU
+uint16_t Machine::bisSR(uint16_t bits)
+{
+    uint16_t old = sr_;
+
+    sr_ |= bits;
+    tick(1);
+    service();
+
+    if (sr_ & SR_CPUOFF)
+    {
+        sleep();
+    }
+    return old;
+}
+
+
+uint16_t Machine::bicSR(uint16_t bits)
+{
+    uint16_t old = sr_;
+
+    sr_ &= ~bits;
+    tick(1);
+    return old;
+}
+
+
+void Machine::bicSROnExit(uint16_t bits)
+{
+    if (frames_.empty())
+    {
+        sr_ &= ~bits;                   // outside an ISR the intrinsic degrades to BIC
+        return;
+    }
+    frames_.back() &= ~bits;
+}
+
+
+void Machine::bisSROnExit(uint16_t bits)
+{
+    if (frames_.empty())
+    {
+        sr_ |= bits;
+        return;
+    }
+    frames_.back() |= bits;
+}
+
+
+void Machine::writeSR(uint16_t value)
+{
+    sr_ = value;
+
+    if (sr_ & SR_CPUOFF)
+    {
+        sleep();
+    }
+}
+
+
+void Machine::setSavedSR(uint16_t value)
+{
+    if (frames_.empty())
+    {
+        sr_ = value;
+        return;
+    }
+    frames_.back() = value;
+}
+
+
+void Machine::puc(const char* reason)
+{
+    throw Halt(std::string("PUC: ") + reason);
+}
+
+
+void Machine::sleep()
+/* CPUOFF is set: jump virtual time from one peripheral event to the next until
+ * an interrupt handler clears CPUOFF in its saved SR
+ */
+{
+    stats_.sleeps++;
+
+    while (sr_ & SR_CPUOFF)
+    {
+        if (!(sr_ & SR_GIE))
+        {
+            throw Halt("LPM entered with GIE clear: CPU can never wake up");
+        }
+
+        advanceAll();
+        service();
+        if (!(sr_ & SR_CPUOFF))
+        {
+            break;
+        }
+
+        uint64_t t = deadline_;
+        if (t == NEVER)
+        {
+            throw Halt("CPU asleep with no enabled wake-up source");
+        }
+        if (t >= limit_)
+        {
+            stats_.sleepPs += limit_ - now_;
+            now_ = limit_;
+            throw Halt("time limit reached");
+        }
+        if (t > now_)
+        {
+            stats_.sleepPs += t - now_;
+            now_ = t;
+            remainder_ = 0;
+        }
+    }
+}
+
+
+
+//// Machine: Interrupts
+void Machine::service()
+{
+    for (;;)
+    {
+        uint64_t mask = 0;
+        for (auto& p : periph_)
+        {
+            mask |= p->pending();
+        }
+        requests(mask);
+        if (!mask || !(sr_ & SR_GIE))
+        {
+            return;
+        }
+
+        dispatch(63 - __builtin_clzll(mask));       // highest vector number wins
+    }
+}
+
+
+void Machine::requests(uint64_t mask)
+/* time stamps the vectors that started requesting, forgets the ones withdrawn
+ * without being taken; the stamp is the first access or event that sees the
+ * request, one instruction late at most on the simulated core
+ */
+{
+    for (uint64_t fresh = mask & ~waiting_; fresh; fresh &= fresh - 1)
+    {
+        requestedAt_[__builtin_ctzll(fresh)] = now_;
+    }
+    waiting_ = mask;
+}
+
+
+void Machine::dispatch(int vector)
+{
+    for (auto& p : periph_)
+    {
+        if ((p->pending() >> vector) & 1)
+        {
+            p->acknowledge(vector);
+        }
+    }
+
+    if (!isr_[vector] && !handler_)
+    {
+        throw Halt(std::string("unhandled interrupt: ") + vectorName(vector));
+    }
+
+    VectorStats& vs = stats_.vectors[vector];
+    if ((waiting_ >> vector) & 1)
+    {
+        vs.maxWaitPs = std::max(vs.maxWaitPs, now_ - requestedAt_[vector]);
+        waiting_ &= ~(1ull << vector);              // a request seen again in the handler is a new one
+    }
+
+    // entry: push PC/SR, clear SR (except SCG0)
+    frames_.push_back(sr_);
+    sr_ &= SR_SCG0;
+
+    uint64_t c0 = cycles_;
+    auto h0 = std::chrono::steady_clock::now();
+
+    tick(entryCycles_);
+    if (handler_)
+    {
+        handler_(vector);
+    }
+    else
+    {
+        isr_[vector]();
+    }
+    tick(retiCycles_);
+
+    auto h1 = std::chrono::steady_clock::now();
+    vs.count++;
+    vs.cycles += cycles_ - c0;
+    vs.maxCycles = std::max(vs.maxCycles, cycles_ - c0);
+    vs.hostNs += std::chrono::duration_cast<std::chrono::nanoseconds>(h1 - h0).count();
+
+    sr_ = frames_.back();
+    frames_.pop_back();
+}
+
+
+
+//// Machine: Reporting
+const char* Machine::vectorName(int vector) const
+{
+    static char buf[32];
+
+    if (vector >= 0 && vector < NUM_VECTORS && vectorNames_[vector])
+    {
+        return vectorNames_[vector];
+    }
+    std::snprintf(buf, sizeof(buf), "vector %d", vector);
+    return buf;
+}
+
+
+void Machine::report(std::FILE* out, double hostSeconds) const
+{
+    double seconds = now_ / (double)PS_PER_S;
+    double duty = now_ ? 1.0 - (double)stats_.sleepPs / now_ : 1.0;
+    uint64_t accesses = stats_.reads + stats_.writes;
+
+    std::fprintf(out, "\n---- hostsim: %s ----\n", deviceName(device_));
+    std::fprintf(out, "virtual time      %.6f s\n", seconds);
+    std::fprintf(out, "MCLK cycles       %llu (CPU active %.2f%%, %llu LPM entries)\n",
+                 (unsigned long long)cycles_, duty * 100.0, (unsigned long long)stats_.sleeps);
+    std::fprintf(out, "register access   %llu reads, %llu writes\n",
+                 (unsigned long long)stats_.reads, (unsigned long long)stats_.writes);
+    std::fprintf(out, "host time         %.6f s (%.1f ns/access)\n",
+                 hostSeconds, accesses ? hostSeconds * 1e9 / accesses : 0.0);
+
+    bool header = false;
+    for (int v = NUM_VECTORS - 1; v >= 0; v--)
+    {
+        const VectorStats& vs = stats_.vectors[v];
+        if (!vs.count)
+        {
+            continue;
+        }
+        if (!header)
+        {
+            std::fprintf(out, "%-22s %10s %10s %12s %10s %12s %12s\n", "interrupt", "count", "rate/s", "cycles/call",
+                         "max cycles", "max wait us", "host ns/call");
+            header = true;
+        }
+        std::fprintf(out, "%-22s %10llu %10.1f %12.1f %10llu %12.1f %12.1f\n", vectorName(v),
+                     (unsigned long long)vs.count, seconds > 0 ? vs.count / seconds : 0.0, (double)vs.cycles / vs.count,
+                     (unsigned long long)vs.maxCycles, vs.maxWaitPs / 1e6, (double)vs.hostNs / vs.count);
+    }
+
+    for (auto& p : periph_)
+    {
+        p->report(out, seconds);
+    }
+}
+
+}   // namespace hostsim
@@ -0,0 +1,258 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        matrix.cpp
+ * Description:     Tiled host matrix product with scalar, SSE and AVX2/FMA kernels
+ *              (see matrix.h). k is cut into KC-long blocks and the columns of B
+ *              into JC-wide panels; each panel is copied out transposed (64 KB,
+ *              stays in L2) and A is run against it two rows by four columns
+ *              at a time
+ *
+ * Input:       A, B, sizes
+ * Output:      C
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/matrix.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HOSTSIM_X86 1
+#endif
+
+
+namespace hostsim
+{
+
+namespace
+{
+
+constexpr size_t KC = 256;              // k block
+constexpr size_t JC = 64;               // columns of B per transposed panel
+
+using PanelFn = void (*)(const float* a, size_t lda, size_t in, const float* bt, float* c, size_t ldc, size_t jn,
+                         size_t kn);
+/* c[i][0..jn) += a[i][0..kn) . bt row j for the 'in' rows of A (lda apart) and the jn
+ * rows of the panel (KC apart)
+ */
+
+MatmulIsa forced = MatmulIsa::Auto;
+
+
+void panelScalar(const float* a, size_t lda, size_t in, const float* bt, float* c, size_t ldc, size_t jn, size_t kn)
+{
+    for (size_t i = 0; i < in; i++, a += lda, c += ldc)
+    {
+        for (size_t j = 0; j < jn; j++)
+        {
+            const float* b = bt + j * KC;
+            float s = 0;
+            for (size_t k = 0; k < kn; k++)
+            {
+                s += a[k] * b[k];
+            }
+            c[j] += s;
+        }
+    }
+}
+
+
+#ifdef HOSTSIM_X86
+// Both vector kernels work on 2 rows of A x 4 rows of the panel: 8 accumulators,
+// each load of A or B feeding 4 or 2 multiply-adds
+#define HOSTSIM_PANEL(V, LOAD, ZERO, MADD, HSUM)                                                    \
+    size_t i = 0;                                                                                   \
+    for (; i + 2 <= in; i += 2, a += 2 * lda, c += 2 * ldc)                                         \
+    {                                                                                               \
+        const float* a1 = a + lda;                                                                  \
+        size_t j = 0;                                                                               \
+        for (; j + 4 <= jn; j += 4)                                                                 \
+        {                                                                                           \
+            const float* b0 = bt + j * KC;                                                          \
+            const float* b1 = b0 + KC;                                                              \
+            const float* b2 = b1 + KC;                                                              \
+            const float* b3 = b2 + KC;                                                              \
+            V s00 = ZERO, s01 = ZERO, s02 = ZERO, s03 = ZERO;                                       \
+            V s10 = ZERO, s11 = ZERO, s12 = ZERO, s13 = ZERO;                                       \
+                                                                                                    \
+            size_t k = 0;                                                                           \
+            for (; k + sizeof(V) / sizeof(float) <= kn; k += sizeof(V) / sizeof(float))             \
+            {                                                                                       \
+                V va0 = LOAD(a + k), va1 = LOAD(a1 + k);                                            \
+                V vb = LOAD(b0 + k);                                                                \
+                s00 = MADD(va0, vb, s00);                                                           \
+                s10 = MADD(va1, vb, s10);                                                           \
+                vb = LOAD(b1 + k);                                                                  \
+                s01 = MADD(va0, vb, s01);                                                           \
+                s11 = MADD(va1, vb, s11);                                                           \
+                vb = LOAD(b2 + k);                                                                  \
+                s02 = MADD(va0, vb, s02);                                                           \
+                s12 = MADD(va1, vb, s12);                                                           \
+                vb = LOAD(b3 + k);                                                                  \
+                s03 = MADD(va0, vb, s03);                                                           \
+                s13 = MADD(va1, vb, s13);                                                           \
+            }                                                                                       \
+                                                                                                    \
+            float r[2][4] = {{HSUM(s00), HSUM(s01), HSUM(s02), HSUM(s03)},                          \
+                             {HSUM(s10), HSUM(s11), HSUM(s12), HSUM(s13)}};                         \
+            for (; k < kn; k++)                                                                     \
+            {                                                                                       \
+                for (int q = 0; q < 4; q++)                                                         \
+                {                                                                                   \
+                    r[0][q] += a[k] * b0[q * KC + k];                                               \
+                    r[1][q] += a1[k] * b0[q * KC + k];                                              \
+                }                                                                                   \
+            }                                                                                       \
+            for (int q = 0; q < 4; q++)                                                             \
+            {                                                                                       \
+                c[j + q] += r[0][q];                                                                \
+                c[ldc + j + q] += r[1][q];                                                          \
+            }                                                                                       \
+        }                                                                                           \
+        panelScalar(a, lda, 2, bt + j * KC, c + j, ldc, jn - j, kn);                                \
+    }                                                                                               \
+    panelScalar(a, lda, in - i, bt, c, ldc, jn, kn)
+
+
+__attribute__((target("sse2"))) inline __m128 maddSse(__m128 a, __m128 b, __m128 s)
+{
+    return _mm_add_ps(s, _mm_mul_ps(a, b));
+}
+
+
+__attribute__((target("sse2"))) inline float hsum128(__m128 v)
+{
+    v = _mm_add_ps(v, _mm_movehl_ps(v, v));
+    v = _mm_add_ss(v, _mm_shuffle_ps(v, v, 1));
+    return _mm_cvtss_f32(v);
+}
+
+
+__attribute__((target("sse2"))) void panelSse(const float* a, size_t lda, size_t in, const float* bt, float* c, size_t ldc,
+                                              size_t jn, size_t kn)
+{
+    HOSTSIM_PANEL(__m128, _mm_loadu_ps, _mm_setzero_ps(), maddSse, hsum128);
+}
+
+
+__attribute__((target("avx2,fma"))) inline float hsum256(__m256 v)
+{
+    __m128 lo = _mm256_castps256_ps128(v);
+    __m128 hi = _mm256_extractf128_ps(v, 1);
+    lo = _mm_add_ps(lo, hi);
+    lo = _mm_add_ps(lo, _mm_movehl_ps(lo, lo));
+    lo = _mm_add_ss(lo, _mm_shuffle_ps(lo, lo, 1));
+    return _mm_cvtss_f32(lo);
+}
+
+
+__attribute__((target("avx2,fma"))) void panelAvx2(const float* a, size_t lda, size_t in, const float* bt, float* c,
+                                                   size_t ldc, size_t jn, size_t kn)
+{
+    HOSTSIM_PANEL(__m256, _mm256_loadu_ps, _mm256_setzero_ps(), _mm256_fmadd_ps, hsum256);
+}
+
+#undef HOSTSIM_PANEL
+#endif
+
+
+MatmulIsa best()
+{
+#ifdef HOSTSIM_X86
+    static const MatmulIsa detected = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") ? MatmulIsa::Avx2
+                                      : __builtin_cpu_supports("sse2")                                ? MatmulIsa::Sse
+                                                                                                      : MatmulIsa::Scalar;
+    return detected;
+#else
+    return MatmulIsa::Scalar;
+#endif
+}
+
+
+PanelFn panelFor(MatmulIsa isa)
+{
+    switch (isa)
+    {
+#ifdef HOSTSIM_X86
+        case MatmulIsa::Avx2:
+            return panelAvx2;
+        case MatmulIsa::Sse:
+            return panelSse;
+#endif
+        default:
+            return panelScalar;
+    }
+}
+
+}   // namespace
+
+
+
+//// Function Definitions
+const char* isaName(MatmulIsa isa)
+{
+    switch (isa)
+    {
+        case MatmulIsa::Scalar:
+            return "scalar";
+        case MatmulIsa::Sse:
+            return "sse";
+        case MatmulIsa::Avx2:
+            return "avx2";
+        default:
+            return "auto";
+    }
+}
+
+
+MatmulIsa matmulIsa()
+{
+    if (forced == MatmulIsa::Auto)
+    {
+        return best();
+    }
+    return std::min(forced, best());
+}
+
+
+void setMatmulIsa(MatmulIsa isa)
+{
+    forced = isa;
+}
+
+
+void matmul(const float* a, const float* b, float* c, size_t rows, size_t inner, size_t cols)
+{
+    PanelFn panel = panelFor(matmulIsa());
+    static thread_local std::vector<float> bt(JC * KC);
+
+    std::memset(c, 0, rows * cols * sizeof(float));
+    for (size_t kc = 0; kc < inner; kc += KC)
+    {
+        size_t kn = std::min(KC, inner - kc);
+        for (size_t jc = 0; jc < cols; jc += JC)
+        {
+            size_t jn = std::min(JC, cols - jc);
+
+            // B[kc.., jc..] transposed: row j of the panel is column jc + j of B
+            for (size_t k = 0; k < kn; k++)
+            {
+                const float* src = b + (kc + k) * cols + jc;
+                for (size_t j = 0; j < jn; j++)
+                {
+                    bt[j * KC + k] = src[j];
+                }
+            }
+
+            panel(a + kc, inner, rows, bt.data(), c + jc, cols, jn, kn);
+        }
+    }
+}
+
+}   // namespace hostsim
@@ -0,0 +1,403 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        mpy32.cpp
+ * Description:     Hardware multiplier: MPY32 on the F5529 (8/16/24/32-bit operands,
+ *              64-bit result, MPYFRAC/MPYSAT, delayed write) and the 16x16 MPY
+ *              of the FG4618. Writing the second operand starts the operation;
+ *              each result word becomes valid the number of MCLK cycles after
+ *              that write given in SLAU208 "Result Availability", and a read
+ *              before then returns the previous contents, as on the device
+ *
+ * Input:       operand/control register writes, MCLK cycle count
+ * Output:      RESLO/RESHI/RES0..RES3, SUMEXT, MPYC, timing hazard counters
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+// Macros (register offsets from MPY)
+#define MPY_OP1         0x00            // MPY, MPYS, MAC, MACS
+#define MPY_OP2         0x08
+#define MPY_RESLO       0x0A
+#define MPY_RESHI       0x0C
+#define MPY_SUMEXT      0x0E
+#define MPY_OP1_32      0x10            // MPY32L/H, MPYS32L/H, MAC32L/H, MACS32L/H
+#define MPY_OP2L        0x20
+#define MPY_OP2H        0x22
+#define MPY_RES0        0x24
+#define MPY_CTL0        0x2C
+
+// Macros (MPY32CTL0 bits)
+#define MPY_C           0x0001
+#define MPY_FRAC        0x0004
+#define MPY_SAT         0x0008
+#define MPY_M           0x0030
+#define MPY_OP1WIDE     0x0040
+#define MPY_OP2WIDE     0x0080
+#define MPY_DLYWRTEN    0x0100
+#define MPY_DLY32       0x0200
+#define MPY_CTL_RW      (MPY_C | MPY_FRAC | MPY_SAT | MPY_DLYWRTEN | MPY_DLY32)
+
+
+namespace hostsim
+{
+
+//// Local Functions
+namespace
+{
+
+int64_t operand(uint32_t v, unsigned bits, bool sign)
+{
+    uint64_t mask = (1ull << bits) - 1;
+    uint64_t x = v & mask;
+    if (sign && (x >> (bits - 1)) & 1)
+    {
+        return (int64_t)(x | ~mask);
+    }
+    return (int64_t)x;
+}
+
+}   // namespace
+
+
+
+//// Function Definitions
+Mpy32::Mpy32(Machine& m, MpyConfig cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+bool Mpy32::busy() const
+/* an operation is still writing its result: until the 32-bit result is in
+ * with MPYDLY32, until MPYC otherwise
+ */
+{
+    return m_.cycles() < ready_[(ctl_ & MPY_DLY32) ? 1 : 4];
+}
+
+
+void Mpy32::start(unsigned op2Bits)
+{
+    bool sign = mode_ & 1;
+    bool accumulate = mode_ & 2;
+    bool wide = op1Bits_ > 16 || op2Bits > 16;
+    unsigned width = wide ? 64 : 32;
+
+    for (int i = 0; i < 4; i++)
+    {
+        old_[i] = res_[i];
+    }
+    old_[4] = sumext_;
+
+    // product and sum in 128 bits, then split into RESx, SUMEXT and MPYC the way
+    // the 32/64-bit adder with its carry/sign extension does
+    __int128 sum = (__int128)operand(op1_, op1Bits_, sign) * operand(op2_, op2Bits, sign);
+    if (accumulate)
+    {
+        uint64_t acc = 0;
+        for (unsigned i = 0; i < width / 16; i++)
+        {
+            acc |= (uint64_t)res_[i] << (16 * i);
+        }
+        if (sign && width == 32)
+        {
+            sum += (int32_t)(uint32_t)acc;
+        }
+        else if (sign)
+        {
+            sum += (int64_t)acc;
+        }
+        else
+        {
+            sum += acc;
+        }
+    }
+
+    bool msb = (sum >> (width - 1)) & 1;
+    bool carry = false;
+    overflow_ = false;
+    switch (mode_)
+    {
+        case 0:                                     // MPY
+            sumext_ = 0;
+            break;
+
+        case 1:                                     // MPYS
+            carry = sum < 0;
+            sumext_ = carry ? 0xFFFF : 0;
+            break;
+
+        case 2:                                     // MAC
+            carry = (sum >> width) & 1;
+            sumext_ = carry;
+            break;
+
+        default:                                    // MACS
+            carry = sum < 0;
+            sumext_ = carry ? 0xFFFF : 0;
+            overflow_ = carry != msb;
+            stats_.overflows += overflow_;
+            break;
+    }
+
+    for (unsigned i = 0; i < 4; i++)
+    {
+        // 16x16 leaves RES2/RES3 holding the sign (MPYS/MACS) of the 32-bit result
+        res_[i] = i < width / 16 ? (uint16_t)(sum >> (16 * i)) : ((sign && msb) ? 0xFFFF : 0);
+    }
+    ctl_ = (ctl_ & ~(MPY_C | MPY_OP1WIDE | MPY_OP2WIDE)) | (carry ? MPY_C : 0) |
+           (op1Bits_ > 16 ? MPY_OP1WIDE : 0) | (op2Bits > 16 ? MPY_OP2WIDE : 0);
+
+    // SLAU208 Result Availability (cycles after the OP2 write): RES0, RES1, RES2,
+    // RES3, MPYC; one more with MPYFRAC or MPYSAT. The 16x16 MPY of the 4xx has its
+    // result in the next instruction
+    static const uint8_t narrow[5] = {3, 3, 3, 3, 3};
+    static const uint8_t narrowSigned[5] = {3, 3, 4, 4, 3};
+    static const uint8_t half[5] = {3, 5, 6, 7, 7};
+    static const uint8_t full[5] = {3, 8, 10, 11, 11};
+    const uint8_t* lat = !wide ? (sign ? narrowSigned : narrow) : (op1Bits_ > 16 && op2Bits > 16) ? full : half;
+    unsigned extra = (ctl_ & (MPY_FRAC | MPY_SAT)) ? 1 : 0;
+
+    started_ = m_.cycles();
+    for (int i = 0; i < 5; i++)
+    {
+        ready_[i] = started_ + (cfg_.mpy32 ? lat[i] + extra : 3);
+    }
+
+    stats_.ops[mode_]++;
+    stats_.wide += wide;
+    stats_.busyCycles += ready_[4] - started_;
+}
+
+
+uint64_t Mpy32::result()
+{
+    uint64_t v = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        v |= (uint64_t)res_[i] << (16 * i);
+    }
+    if (!cfg_.mpy32 || !(ctl_ & (MPY_FRAC | MPY_SAT)))
+    {
+        return v;
+    }
+
+    // saturation and fractional shift act on the value read, not on the stored
+    // result, so a MACS chain keeps accumulating the unclipped sum
+    unsigned width = (ctl_ & (MPY_OP1WIDE | MPY_OP2WIDE)) ? 64 : 32;
+    uint64_t mask = width == 64 ? ~0ull : 0xFFFFFFFFull;
+    uint64_t top = 1ull << (width - 1);
+    bool sat = (ctl_ & MPY_SAT) && (mode_ & 1);
+    bool negative = sumext_ & 0x8000;
+    uint64_t clip = negative ? top : top - 1;
+
+    if (sat && overflow_)
+    {
+        stats_.saturatedReads++;
+        v = (v & ~mask) | clip;
+    }
+    if (ctl_ & MPY_FRAC)
+    {
+        uint64_t r = v & mask;
+        if (sat && ((r & top) != 0) != ((r & (top >> 1)) != 0))
+        {
+            stats_.saturatedReads++;
+            v = (v & ~mask) | ((r & top) ? top : top - 1);     // 0x8000 * 0x8000 -> 0x7FFFFFFF
+        }
+        else
+        {
+            v = (v & ~mask) | ((r << 1) & mask);
+        }
+    }
+    return v;
+}
+
+
+uint32_t Mpy32::read(uint32_t addr, unsigned bits)
+{
+    uint32_t off = (addr - cfg_.base) & ~1u;
+    uint16_t value;
+    int word = -1;                                  // result word read (for the timing check)
+
+    if (off < MPY_OP2)
+    {
+        value = (uint16_t)op1_;
+    }
+    else if (off == MPY_OP2 || off == MPY_OP2L)
+    {
+        value = (uint16_t)op2_;
+    }
+    else if (off == MPY_OP2H)
+    {
+        value = (uint16_t)(op2_ >> 16);
+    }
+    else if (off == MPY_RESLO || off == MPY_RESHI)
+    {
+        word = (off - MPY_RESLO) / 2;
+    }
+    else if (off >= MPY_RES0 && off < MPY_CTL0)
+    {
+        word = (off - MPY_RES0) / 2;
+    }
+    else if (off == MPY_SUMEXT)
+    {
+        word = 4;
+    }
+    else if (off == MPY_CTL0)
+    {
+        value = ctl_;
+    }
+    else
+    {
+        value = (uint16_t)(op1_ >> ((off & 2) ? 16 : 0));    // MPY32L/H ...
+    }
+
+    if (word >= 0)
+    {
+        if (m_.cycles() < ready_[word])
+        {
+            stats_.earlyReads++;
+            value = old_[word];
+        }
+        else
+        {
+            value = word == 4 ? sumext_ : (uint16_t)(result() >> (16 * word));
+        }
+    }
+
+    if (bits == 8)
+    {
+        return (addr & 1) ? value >> 8 : value & 0xFF;
+    }
+    return value;
+}
+
+
+void Mpy32::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    uint32_t off = (addr - cfg_.base) & ~1u;
+    uint16_t v = (uint16_t)value;
+
+    if (off == MPY_CTL0)
+    {
+        uint16_t w = bits == 8 ? ((addr & 1) ? (uint16_t)((ctl_ & 0x00FF) | (v << 8)) : (uint16_t)((ctl_ & 0xFF00) | (v & 0xFF)))
+                               : v;
+        ctl_ = (ctl_ & ~MPY_CTL_RW) | (w & MPY_CTL_RW);
+        return;
+    }
+    if (off == MPY_SUMEXT)
+    {
+        return;                                     // read only
+    }
+
+    if (busy())
+    {
+        if (ctl_ & MPY_DLYWRTEN)
+        {
+            stats_.delayedWrites++;                 // the hardware holds it until the result is in
+        }
+        else
+        {
+            stats_.writeHazards++;                  // result of the running operation is undefined
+        }
+    }
+
+    if (off < MPY_OP2)
+    {
+        mode_ = off / 2;
+        op1_ = v;
+        op1Bits_ = bits == 8 ? 8 : 16;
+        ctl_ = (ctl_ & ~MPY_M) | (mode_ << 4);
+    }
+    else if (off == MPY_OP2)
+    {
+        op2_ = v;
+        start(bits == 8 ? 8 : 16);
+    }
+    else if (off == MPY_RESLO || off == MPY_RESHI || (off >= MPY_RES0 && off < MPY_CTL0))
+    {
+        int word = off < MPY_RES0 ? (off - MPY_RESLO) / 2 : (off - MPY_RES0) / 2;
+        res_[word] = bits == 8 ? (uint16_t)(v & 0xFF) : v;
+        ready_[word] = m_.cycles();
+        overflow_ = false;
+    }
+    else if (off < MPY_OP2L)
+    {
+        // MPY32L..MACS32H: the low word starts a 32-bit operand, the high word
+        // completes it (a byte write there makes it 24 bits)
+        mode_ = (off - MPY_OP1_32) / 4;
+        ctl_ = (ctl_ & ~MPY_M) | (mode_ << 4);
+        if (off & 2)
+        {
+            op1_ = (op1_ & 0xFFFF) | ((uint32_t)(bits == 8 ? v & 0xFF : v) << 16);
+            op1Bits_ = bits == 8 ? 24 : 32;
+        }
+        else
+        {
+            op1_ = v;
+            op1Bits_ = 32;
+        }
+    }
+    else if (off == MPY_OP2L)
+    {
+        op2_ = v;
+    }
+    else if (off == MPY_OP2H)
+    {
+        op2_ = (op2_ & 0xFFFF) | ((uint32_t)(bits == 8 ? v & 0xFF : v) << 16);
+        start(bits == 8 ? 24 : 32);
+    }
+}
+
+
+void Mpy32::reset()
+{
+    op1_ = op2_ = 0;
+    op1Bits_ = 16;
+    mode_ = 0;
+    sumext_ = 0;
+    ctl_ = 0;
+    overflow_ = false;
+    for (int i = 0; i < 5; i++)
+    {
+        if (i < 4)
+        {
+            res_[i] = 0;
+        }
+        old_[i] = 0;
+        ready_[i] = 0;
+    }
+    started_ = 0;
+}
+
+
+void Mpy32::report(std::FILE* out, double seconds) const
+{
+    (void)seconds;
+    const MpyStats& s = stats_;
+    uint64_t total = s.ops[0] + s.ops[1] + s.ops[2] + s.ops[3];
+    if (!total)
+    {
+        return;
+    }
+
+    std::fprintf(out, "%-18s %llu operations (MPY %llu, MPYS %llu, MAC %llu, MACS %llu; %llu with 32-bit operands), "
+                      "%llu busy cycles\n",
+                 name(), (unsigned long long)total, (unsigned long long)s.ops[0], (unsigned long long)s.ops[1],
+                 (unsigned long long)s.ops[2], (unsigned long long)s.ops[3], (unsigned long long)s.wide,
+                 (unsigned long long)s.busyCycles);
+    if (s.earlyReads || s.writeHazards || s.delayedWrites || s.overflows || s.saturatedReads)
+    {
+        std::fprintf(out, "%-18s %llu early result reads, %llu write hazards, %llu delayed writes, "
+                          "%llu overflows, %llu saturated reads\n",
+                     name(), (unsigned long long)s.earlyReads, (unsigned long long)s.writeHazards,
+                     (unsigned long long)s.delayedWrites, (unsigned long long)s.overflows,
+                     (unsigned long long)s.saturatedReads);
+    }
+}
+
+}   // namespace hostsim
@@ -0,0 +1,246 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        textfilter.cpp
+ * Description:     Alphanumeric filter with scalar, SSE4.2 and AVX2 kernels (see
+ *              textfilter.h). A byte is alphanumeric when it is in '0'..'9' or,
+ *              with bit 5 set, in 'a'..'z': four signed byte compares, so bytes
+ *              0x80..0xFF fall out as they do in the lab's signed cmp.b chain.
+ *              The compare mask's bits index compact8, which holds for every
+ *              8-bit mask the PSHUFB indices of its set bits; each half block
+ *              is shuffled and stored 8 bytes wide, and the output advances by
+ *              the popcount. The output never gets ahead of the input, so the
+ *              wide stores stay inside the n bytes of dst
+ *
+ * Input:       buffer, length
+ * Output:      compacted alphanumerics, their count
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/textfilter.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HOSTSIM_X86 1
+#endif
+
+
+namespace hostsim
+{
+
+namespace
+{
+
+FilterIsa forced = FilterIsa::Auto;
+
+
+constexpr bool alnum(unsigned c)
+{
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z');
+}
+
+
+constexpr std::array<bool, 256> makeClasses()
+{
+    std::array<bool, 256> t{};
+    for (unsigned c = 0; c < 256; c++)
+    {
+        t[c] = alnum(c);
+    }
+    return t;
+}
+
+constexpr std::array<bool, 256> classes = makeClasses();
+
+
+size_t filterScalar(const char* src, size_t n, char* dst, size_t k)
+/* byte at a time from src[0] on, output from dst[k]: every byte is stored and
+ * only the kept ones advance k, so there is no branch on the class
+ */
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        const unsigned char c = (unsigned char)src[i];
+        dst[k] = (char)c;
+        k += classes[c];
+    }
+    return k;
+}
+
+
+#ifdef HOSTSIM_X86
+constexpr std::array<uint64_t, 256> makeCompact8()
+{
+    std::array<uint64_t, 256> t{};
+    for (unsigned m = 0; m < 256; m++)
+    {
+        unsigned n = 0;
+        for (unsigned b = 0; b < 8; b++)
+        {
+            if (m & (1u << b))
+            {
+                t[m] |= (uint64_t)b << (8 * n++);
+            }
+        }
+    }
+    return t;
+}
+
+alignas(64) constexpr std::array<uint64_t, 256> compact8 = makeCompact8();
+
+
+__attribute__((target("sse4.2,popcnt"))) inline __m128i classify128(__m128i v)
+/* 0xFF in every alphanumeric byte of v
+ */
+{
+    const __m128i l = _mm_or_si128(v, _mm_set1_epi8(0x20));
+    const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                        _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), v));
+    const __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(l, _mm_set1_epi8('a' - 1)),
+                                         _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), l));
+    return _mm_or_si128(digit, letter);
+}
+
+
+__attribute__((target("sse4.2,popcnt"))) inline size_t compact128(__m128i v, unsigned mask, char* dst)
+/* the bytes of v selected by the 16-bit mask, stored at dst; returns their count
+ */
+{
+    const unsigned m0 = mask & 0xFF, m1 = mask >> 8;
+    const __m128i i0 = _mm_loadl_epi64((const __m128i*)&compact8[m0]);
+    const __m128i i1 = _mm_loadl_epi64((const __m128i*)&compact8[m1]);
+    const size_t n0 = (size_t)_mm_popcnt_u32(m0);
+
+    _mm_storel_epi64((__m128i*)dst, _mm_shuffle_epi8(v, i0));
+    _mm_storel_epi64((__m128i*)(dst + n0), _mm_shuffle_epi8(_mm_srli_si128(v, 8), i1));
+    return n0 + (size_t)_mm_popcnt_u32(m1);
+}
+
+
+__attribute__((target("sse4.2,popcnt"))) size_t filterSse(const char* src, size_t n, char* dst)
+{
+    size_t i = 0, k = 0;
+    for (; i + 16 <= n; i += 16)
+    {
+        const __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        const unsigned mask = (unsigned)_mm_movemask_epi8(classify128(v));
+
+        if (mask == 0xFFFF)                         // all kept: one plain store
+        {
+            _mm_storeu_si128((__m128i*)(dst + k), v);
+            k += 16;
+        }
+        else if (mask)
+        {
+            k += compact128(v, mask, dst + k);
+        }
+    }
+    return filterScalar(src + i, n - i, dst, k);
+}
+
+
+__attribute__((target("avx2,popcnt"))) size_t filterAvx2(const char* src, size_t n, char* dst)
+{
+    const __m256i bit5 = _mm256_set1_epi8(0x20);
+    const __m256i below0 = _mm256_set1_epi8('0' - 1), above9 = _mm256_set1_epi8('9' + 1);
+    const __m256i belowA = _mm256_set1_epi8('a' - 1), aboveZ = _mm256_set1_epi8('z' + 1);
+    size_t i = 0, k = 0;
+
+    for (; i + 32 <= n; i += 32)
+    {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i l = _mm256_or_si256(v, bit5);
+        const __m256i keep = _mm256_or_si256(
+            _mm256_and_si256(_mm256_cmpgt_epi8(v, below0), _mm256_cmpgt_epi8(above9, v)),
+            _mm256_and_si256(_mm256_cmpgt_epi8(l, belowA), _mm256_cmpgt_epi8(aboveZ, l)));
+        const unsigned mask = (unsigned)_mm256_movemask_epi8(keep);
+
+        if (mask == 0xFFFFFFFFu)
+        {
+            _mm256_storeu_si256((__m256i*)(dst + k), v);
+            k += 32;
+        }
+        else if (mask)
+        {
+            k += compact128(_mm256_castsi256_si128(v), mask & 0xFFFF, dst + k);
+            k += compact128(_mm256_extracti128_si256(v, 1), mask >> 16, dst + k);
+        }
+    }
+    return filterScalar(src + i, n - i, dst, k);
+}
+#endif
+
+
+FilterIsa best()
+{
+#ifdef HOSTSIM_X86
+    static const FilterIsa detected =
+        !__builtin_cpu_supports("popcnt") ? FilterIsa::Scalar
+        : __builtin_cpu_supports("avx2")  ? FilterIsa::Avx2
+        : __builtin_cpu_supports("sse4.2") ? FilterIsa::Sse
+                                           : FilterIsa::Scalar;
+    return detected;
+#else
+    return FilterIsa::Scalar;
+#endif
+}
+
+}   // namespace
+
+
+
+//// Function Definitions
+const char* isaName(FilterIsa isa)
+{
+    switch (isa)
+    {
+        case FilterIsa::Scalar:
+            return "scalar";
+        case FilterIsa::Sse:
+            return "sse4.2";
+        case FilterIsa::Avx2:
+            return "avx2";
+        default:
+            return "auto";
+    }
+}
+
+
+FilterIsa filterIsa()
+{
+    if (forced == FilterIsa::Auto)
+    {
+        return best();
+    }
+    return std::min(forced, best());
+}
+
+
+void setFilterIsa(FilterIsa isa)
+{
+    forced = isa;
+}
+
+
+size_t alnumFilter(const char* src, size_t n, char* dst)
+{
+    switch (filterIsa())
+    {
+#ifdef HOSTSIM_X86
+        case FilterIsa::Avx2:
+            return filterAvx2(src, n, dst);
+        case FilterIsa::Sse:
+            return filterSse(src, n, dst);
+#endif
+        default:
+            return filterScalar(src, n, dst, 0);
+    }
+}
+
+}   // namespace hostsim
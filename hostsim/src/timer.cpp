@@ -0,0 +1,399 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        timer.cpp
+ * Description:     Timer_A / Timer_B in stop, up, continuous and up/down mode. The
+ *              counter is advanced in closed form: for every compare value the
+ *              number of times it is reached between two accesses is computed
+ *              directly, so an LPM3 sleep of several seconds costs the same as
+ *              a single register read
+ *
+ * Input:       TAxCTL/TAxCCTLn/TAxCCRn/TAxR/TAxEX0 accesses, ACLK/SMCLK rate
+ * Output:      CCIFG/TAIFG flags, TAxIV, CCR0 and CCR1..n/TAIFG interrupt requests
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+// Macros (TAxCTL / TAxCCTLn fields, common to Timer_A and Timer_B)
+#define TCTL_IFG        0x0001
+#define TCTL_IE         0x0002
+#define TCTL_CLR        0x0004
+#define CCTL_IFG        0x0001
+#define CCTL_IE         0x0010
+#define CCTL_CAP        0x0100
+#define CCTL_OUTMOD(c)  (((c) >> 5) & 7)
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+uint64_t TickCounter::ticksAt(uint64_t t) const
+{
+    if (!hz || t <= baseTime)
+    {
+        return baseTicks;
+    }
+    return baseTicks + (uint64_t)((unsigned __int128)(t - baseTime) * hz / ((unsigned __int128)PS_PER_S * div));
+}
+
+
+uint64_t TickCounter::timeOf(uint64_t tick) const
+{
+    if (!hz)
+    {
+        return NEVER;
+    }
+    if (tick <= baseTicks)
+    {
+        return baseTime;
+    }
+    unsigned __int128 num = (unsigned __int128)(tick - baseTicks) * PS_PER_S * div;
+    return baseTime + (uint64_t)((num + hz - 1) / hz);
+}
+
+
+void TickCounter::rebase(uint64_t t, uint64_t ticks, uint64_t newHz, uint64_t newDiv)
+{
+    baseTime = t;
+    baseTicks = ticks;
+    hz = newHz;
+    div = newDiv ? newDiv : 1;
+}
+
+
+
+//// Timer
+Timer::Timer(Machine& m, TimerConfig cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+uint64_t Timer::sourceHz() const
+{
+    switch ((ctl() >> 8) & 3)                       // TASSEL
+    {
+        case 1:  return m_.clocks().aclk();
+        case 2:  return m_.clocks().smclk();
+        default: return 0;                          // TACLK/INCLK pins are not driven
+    }
+}
+
+
+uint64_t Timer::period() const
+{
+    switch ((ctl() >> 4) & 3)                       // MC
+    {
+        case 1:  return ccr(0) ? ccr(0) + 1ull : 0;         // up
+        case 2:  return 0x10000;                            // continuous
+        case 3:  return ccr(0) ? 2ull * ccr(0) : 0;         // up/down
+        default: return 0;                                  // stop
+    }
+}
+
+
+uint16_t Timer::counterAt(uint64_t phase) const
+{
+    if (((ctl() >> 4) & 3) == 3 && phase > ccr(0))
+    {
+        return 2 * ccr(0) - phase;                  // counting down
+    }
+    return phase;
+}
+
+
+uint64_t Timer::firstHit(uint64_t phase, uint64_t target) const
+{
+    uint64_t p = period();
+    uint64_t k = (target + p - phase % p) % p;
+    return k ? k : p;
+}
+
+
+void Timer::hitCount(int channel, uint64_t hits)
+{
+    if (!hits)
+    {
+        return;
+    }
+    flags_ += hits;
+    if (channel >= 0)
+    {
+        m_.setRaw16(cfg_.cctl0 + 2 * channel, cctl(channel) | CCTL_IFG);
+        if (CCTL_OUTMOD(cctl(channel)) == 4)
+        {
+            toggles_[channel] += hits;              // OUTMOD_4: toggle on every compare
+        }
+    }
+    else
+    {
+        m_.setRaw16(cfg_.ctl, ctl() | TCTL_IFG);
+    }
+}
+
+
+void Timer::reconfigure()
+{
+    uint64_t div = 1ull << ((ctl() >> 6) & 3);      // ID
+    if (cfg_.ex0)
+    {
+        div *= (m_.raw16(cfg_.ex0) & 7) + 1;        // TAIDEX
+    }
+    clock_.rebase(m_.now(), counted_, sourceHz(), div);
+    last_ = m_.now();
+
+    uint64_t p = period();
+    if (p && phase_ >= p)
+    {
+        phase_ = 0;
+    }
+}
+
+
+void Timer::advance(uint64_t now)
+{
+    if (sourceHz() != clock_.hz)
+    {
+        // clock tree changed since the last access (m_.sync() ran just before it did)
+        uint64_t div = clock_.div;
+        clock_.rebase(last_, counted_, sourceHz(), div);
+    }
+    last_ = now;
+
+    uint64_t target = clock_.ticksAt(now);
+    uint64_t n = target - counted_;
+    counted_ = target;
+
+    uint64_t p = period();
+    if (!n || !p)
+    {
+        return;
+    }
+
+    auto hits = [&](uint64_t phase) -> uint64_t
+    {
+        uint64_t k = firstHit(phase_, phase);
+        return n >= k ? 1 + (n - k) / p : 0;
+    };
+
+    unsigned mode = (ctl() >> 4) & 3;
+    uint16_t top = ccr(0);
+
+    for (int c = 0; c < cfg_.channels; c++)
+    {
+        if (cctl(c) & CCTL_CAP)
+        {
+            continue;                               // capture mode: no compare events
+        }
+
+        uint64_t v = ccr(c);
+        uint64_t count = 0;
+        if (mode == 2)
+        {
+            count = hits(v);
+        }
+        else if (v <= top)
+        {
+            count = hits(v);
+            if (mode == 3 && v != 0 && v != top)
+            {
+                count += hits(p - v);               // reached again while counting down
+            }
+        }
+        hitCount(c, count);
+    }
+    hitCount(-1, hits(0));                          // TAIFG: counter wraps to zero
+
+    phase_ = (phase_ + n) % p;
+}
+
+
+uint64_t Timer::nextEvent() const
+{
+    uint64_t p = period();
+    if (!p || !clock_.hz)
+    {
+        return NEVER;
+    }
+
+    unsigned mode = (ctl() >> 4) & 3;
+    uint64_t best = NEVER;
+
+    auto consider = [&](uint64_t phase)
+    {
+        uint64_t k = firstHit(phase_, phase);
+        if (k < best)
+        {
+            best = k;
+        }
+    };
+
+    for (int c = 0; c < cfg_.channels; c++)
+    {
+        if (!(cctl(c) & CCTL_IE) || (cctl(c) & CCTL_CAP))
+        {
+            continue;
+        }
+        uint64_t v = ccr(c);
+        if (mode == 2 || v <= ccr(0))
+        {
+            consider(v);
+            if (mode == 3 && v != 0 && v != ccr(0))
+            {
+                consider(p - v);
+            }
+        }
+    }
+    if (ctl() & TCTL_IE)
+    {
+        consider(0);
+    }
+
+    return best == NEVER ? NEVER : clock_.timeOf(counted_ + best);
+}
+
+
+uint32_t Timer::read(uint32_t addr, unsigned bits)
+{
+    if (addr == cfg_.r)
+    {
+        return counterAt(phase_);
+    }
+
+    if (addr == cfg_.iv)
+    {
+        // TAxIV: CCR1 highest ... TAIFG lowest; the read clears the reported flag
+        for (int c = 1; c < cfg_.channels; c++)
+        {
+            if ((cctl(c) & CCTL_IE) && (cctl(c) & CCTL_IFG))
+            {
+                m_.setRaw16(cfg_.cctl0 + 2 * c, cctl(c) & ~CCTL_IFG);
+                return 2 * c;
+            }
+        }
+        if ((ctl() & TCTL_IE) && (ctl() & TCTL_IFG))
+        {
+            m_.setRaw16(cfg_.ctl, ctl() & ~TCTL_IFG);
+            return cfg_.ivOverflow;
+        }
+        return 0;
+    }
+
+    return m_.raw(addr, bits);
+}
+
+
+void Timer::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if (addr == cfg_.iv)
+    {
+        return;                                     // read-only
+    }
+
+    m_.setRaw(addr, bits, value);
+
+    if (addr == cfg_.ctl || addr == cfg_.ctl + 1 || addr == cfg_.ex0)
+    {
+        if (ctl() & TCTL_CLR)
+        {
+            phase_ = 0;                             // TACLR: clear counter and divider
+            m_.setRaw16(cfg_.ctl, ctl() & ~TCTL_CLR);
+        }
+        reconfigure();
+    }
+    else if (addr == cfg_.r)
+    {
+        phase_ = value & 0xFFFF;
+        uint64_t p = period();
+        if (p && phase_ >= p)
+        {
+            phase_ = 0;
+        }
+    }
+    else if (addr == cfg_.ccr0)
+    {
+        // up mode: a new CCR0 below the count makes the timer roll to zero
+        uint64_t p = period();
+        if (p && phase_ >= p)
+        {
+            phase_ = 0;
+        }
+    }
+}
+
+
+uint64_t Timer::pending() const
+{
+    uint64_t mask = 0;
+
+    if ((cctl(0) & CCTL_IE) && (cctl(0) & CCTL_IFG))
+    {
+        mask |= 1ull << cfg_.vector0;
+    }
+    for (int c = 1; c < cfg_.channels; c++)
+    {
+        if ((cctl(c) & CCTL_IE) && (cctl(c) & CCTL_IFG))
+        {
+            mask |= 1ull << cfg_.vector1;
+        }
+    }
+    if ((ctl() & TCTL_IE) && (ctl() & TCTL_IFG))
+    {
+        mask |= 1ull << cfg_.vector1;
+    }
+    return mask;
+}
+
+
+void Timer::acknowledge(int vector)
+{
+    if (vector == cfg_.vector0)
+    {
+        m_.setRaw16(cfg_.cctl0, cctl(0) & ~CCTL_IFG);   // CCR0 CCIFG is single-source: auto-cleared
+    }
+}
+
+
+void Timer::reset()
+{
+    m_.setRaw16(cfg_.ctl, 0);
+    m_.setRaw16(cfg_.r, 0);
+    m_.setRaw16(cfg_.iv, 0);
+    if (cfg_.ex0)
+    {
+        m_.setRaw16(cfg_.ex0, 0);
+    }
+    for (int c = 0; c < cfg_.channels; c++)
+    {
+        m_.setRaw16(cfg_.cctl0 + 2 * c, 0);
+        m_.setRaw16(cfg_.ccr0 + 2 * c, 0);
+    }
+    phase_ = 0;
+    counted_ = 0;
+    reconfigure();
+}
+
+
+void Timer::report(std::FILE* out, double seconds) const
+{
+    if (!flags_)
+    {
+        return;
+    }
+
+    std::fprintf(out, "timer %-12s %llu compare/overflow events\n", cfg_.name, (unsigned long long)flags_);
+    for (int c = 0; c < cfg_.channels; c++)
+    {
+        if (toggles_[c])
+        {
+            std::fprintf(out, "timer %s.OUT%d      %llu toggles, %.3f Hz\n", cfg_.name, c,
+                         (unsigned long long)toggles_[c], seconds > 0 ? toggles_[c] / (2.0 * seconds) : 0.0);
+        }
+    }
+}
+
+}   // namespace hostsim
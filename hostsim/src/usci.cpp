@@ -0,0 +1,329 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        usci.cpp
+ * Description:     USCI_Ax/Bx in UART mode and SPI master mode. Transmit is double
+ *              buffered like the hardware: TXBUF moves into the shift register,
+ *              TXIFG sets again, and the character leaves after one frame time
+ *              derived from UCBRx/UCBRSx/UCOS16 and the selected BRCLK. UART
+ *              output goes to the host (stdout by default); UART input and SPI
+ *              slave replies come from the driver's script
+ *
+ * Input:       UCxCTL0/1, UCxBRx, UCxMCTL, UCxTXBUF, scripted RX bytes
+ * Output:      UCxRXBUF, RX/TX flags (UCAxIFG or IFG2), UCAxIV, interrupt requests
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+#include <algorithm>
+
+// Macros (UCxCTL0 / UCxCTL1 / UCxMCTL / UCxSTAT fields)
+#define CTL0_PEN    0x80
+#define CTL0_7BIT   0x10
+#define CTL0_SPB    0x08
+#define CTL1_SWRST  0x01
+#define MCTL_OS16   0x01
+#define STAT_OE     0x20
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+Usci::Usci(Machine& m, UsciConfig cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+uint64_t Usci::bitTime() const
+{
+    uint64_t hz;
+    switch ((m_.raw8(cfg_.ctl1) >> 6) & 3)          // UCSSEL
+    {
+        case 1:  hz = m_.clocks().aclk(); break;
+        default: hz = m_.clocks().smclk(); break;   // UCLK pin is not modelled
+    }
+
+    uint64_t br = m_.raw8(cfg_.br0) | (m_.raw8(cfg_.br1) << 8);
+    if (!br)
+    {
+        br = 1;
+    }
+
+    // divisor in 1/16 BRCLK units
+    uint64_t div16;
+    uint8_t mctl = cfg_.mctl ? m_.raw8(cfg_.mctl) : 0;
+    if (sync())
+    {
+        div16 = br * 16;                            // SPI: BRCLK / UCBRx
+    }
+    else if (mctl & MCTL_OS16)
+    {
+        div16 = br * 256 + ((mctl >> 4) & 15) * 16; // oversampling: 16 * (UCBRx + UCBRFx/16)
+    }
+    else
+    {
+        div16 = br * 16 + ((mctl >> 1) & 7) * 2;    // low frequency: UCBRx + UCBRSx/8
+    }
+
+    return (uint64_t)((unsigned __int128)div16 * PS_PER_S / (16 * hz));
+}
+
+
+uint64_t Usci::frameTime() const
+{
+    if (sync())
+    {
+        return 8 * bitTime();
+    }
+
+    uint8_t ctl0 = m_.raw8(cfg_.ctl0);
+    unsigned bits = 1 + ((ctl0 & CTL0_7BIT) ? 7 : 8) + ((ctl0 & CTL0_PEN) ? 1 : 0) + ((ctl0 & CTL0_SPB) ? 2 : 1);
+    return bits * bitTime();
+}
+
+
+void Usci::shiftDone(uint8_t byte)
+{
+    sent_++;
+
+    if (!sync())
+    {
+        if (hex_)
+        {
+            std::fprintf(sink_, "%02X ", byte);
+        }
+        else
+        {
+            std::fputc(byte, sink_);
+        }
+        return;
+    }
+
+    // SPI master: the slave's byte arrives in the same eight clocks
+    uint8_t in = 0x00;
+    if (!spi_.empty())
+    {
+        in = spi_.front();
+        spi_.pop_front();
+    }
+    if (m_.raw8(cfg_.ifg) & cfg_.rxBit)
+    {
+        overruns_++;
+        m_.setRaw8(cfg_.stat, m_.raw8(cfg_.stat) | STAT_OE);
+    }
+    m_.setRaw8(cfg_.rxbuf, in);
+    setFlag(cfg_.rxBit);
+    received_++;
+}
+
+
+void Usci::advance(uint64_t now)
+{
+    // transmit side
+    while (busy_ && done_ <= now)
+    {
+        shiftDone(shift_);
+        if (txFull_)
+        {
+            shift_ = tx_;
+            txFull_ = false;
+            setFlag(cfg_.txBit);
+            done_ += frameTime();
+        }
+        else
+        {
+            busy_ = false;
+            done_ = NEVER;
+        }
+    }
+
+    // scripted UART receive, one character per frame time
+    if (sync() || inReset())
+    {
+        return;
+    }
+    while (!rx_.empty())
+    {
+        uint64_t at = std::max(rx_.front().t, lastRx_ + frameTime());
+        if (at > now)
+        {
+            break;
+        }
+
+        if (m_.raw8(cfg_.ifg) & cfg_.rxBit)
+        {
+            overruns_++;                            // previous character never read
+            m_.setRaw8(cfg_.stat, m_.raw8(cfg_.stat) | STAT_OE);
+        }
+        m_.setRaw8(cfg_.rxbuf, rx_.front().byte);
+        setFlag(cfg_.rxBit);
+        received_++;
+
+        lastRx_ = at;
+        rx_.pop_front();
+    }
+}
+
+
+uint64_t Usci::nextEvent() const
+{
+    uint64_t t = done_;
+    if (!rx_.empty() && !sync() && !inReset())
+    {
+        t = std::min(t, std::max(rx_.front().t, lastRx_ + frameTime()));
+    }
+    return t;
+}
+
+
+uint32_t Usci::read(uint32_t addr, unsigned bits)
+{
+    if (addr == cfg_.rxbuf)
+    {
+        clearFlag(cfg_.rxBit);                      // reading RXBUF clears RXIFG and UCOE
+        m_.setRaw8(cfg_.stat, m_.raw8(cfg_.stat) & ~STAT_OE);
+        return m_.raw8(cfg_.rxbuf);
+    }
+
+    if (cfg_.iv && addr == cfg_.iv)
+    {
+        uint8_t flags = m_.raw8(cfg_.ifg) & m_.raw8(cfg_.ie);
+        if (flags & cfg_.rxBit)
+        {
+            clearFlag(cfg_.rxBit);
+            return 2;
+        }
+        if (flags & cfg_.txBit)
+        {
+            clearFlag(cfg_.txBit);
+            return 4;
+        }
+        return 0;
+    }
+
+    return m_.raw(addr, bits);
+}
+
+
+void Usci::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if (addr == cfg_.rxbuf || (cfg_.iv && addr == cfg_.iv))
+    {
+        return;                                     // read-only
+    }
+
+    if (addr == cfg_.txbuf)
+    {
+        if (inReset())
+        {
+            return;
+        }
+        tx_ = value;
+        if (!busy_)
+        {
+            shift_ = tx_;                           // straight into the shift register
+            busy_ = true;
+            done_ = m_.now() + frameTime();
+        }
+        else
+        {
+            txFull_ = true;
+            clearFlag(cfg_.txBit);
+        }
+        return;
+    }
+
+    bool wasReset = inReset();
+    m_.setRaw(addr, bits, value);
+
+    if (!wasReset && inReset())
+    {
+        // UCSWRST: abort transfers, RXIFG cleared, TXIFG set
+        busy_ = false;
+        txFull_ = false;
+        done_ = NEVER;
+        clearFlag(cfg_.rxBit);
+        setFlag(cfg_.txBit);
+    }
+    else if (wasReset && !inReset())
+    {
+        lastRx_ = m_.now();
+    }
+}
+
+
+uint64_t Usci::pending() const
+{
+    uint8_t flags = m_.raw8(cfg_.ifg) & m_.raw8(cfg_.ie);
+    uint64_t mask = 0;
+
+    if (flags & cfg_.rxBit)
+    {
+        mask |= 1ull << cfg_.rxVector;
+    }
+    if (flags & cfg_.txBit)
+    {
+        mask |= 1ull << cfg_.txVector;
+    }
+    return mask;
+}
+
+
+void Usci::reset()
+{
+    for (uint32_t a : {cfg_.ctl0, cfg_.br0, cfg_.br1, cfg_.stat, cfg_.rxbuf, cfg_.txbuf})
+    {
+        m_.setRaw8(a, 0);
+    }
+    if (cfg_.mctl)
+    {
+        m_.setRaw8(cfg_.mctl, 0);
+    }
+    m_.setRaw8(cfg_.ctl1, CTL1_SWRST);
+    m_.setRaw8(cfg_.ie, m_.raw8(cfg_.ie) & ~(cfg_.rxBit | cfg_.txBit));
+    clearFlag(cfg_.rxBit);
+    setFlag(cfg_.txBit);
+
+    busy_ = false;
+    txFull_ = false;
+    done_ = NEVER;
+}
+
+
+void Usci::receive(uint64_t t, const std::string& bytes)
+{
+    for (unsigned char c : bytes)
+    {
+        rx_.push_back({t, c});
+    }
+    m_.scheduleChanged();
+}
+
+
+void Usci::spiReplies(const std::vector<uint8_t>& bytes)
+{
+    spi_.insert(spi_.end(), bytes.begin(), bytes.end());
+}
+
+
+void Usci::report(std::FILE* out, double seconds) const
+{
+    if (!sent_ && !received_)
+    {
+        return;
+    }
+    std::fflush(sink_);
+
+    double baud = bitTime() ? (double)PS_PER_S / bitTime() : 0.0;
+    std::fprintf(out, "%s %-13s %llu bytes sent, %llu received, %llu overruns (%.0f bit/s, %.1f bytes/s)\n",
+                 cfg_.name, sync() ? "(SPI master)" : "(UART)", (unsigned long long)sent_,
+                 (unsigned long long)received_, (unsigned long long)overruns_, baud,
+                 seconds > 0 ? sent_ / seconds : 0.0);
+}
+
+}   // namespace hostsim
@@ -0,0 +1,109 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        usi.cpp
+ * Description:     USI in SPI slave mode (F2013 side of lab09). Each byte clocked in
+ *              by the (scripted) master swaps with USISRL when the bit counter was
+ *              loaded, then sets USIIFG
+ *
+ * Input:       USICTL0/1, USICNT, USISRL, scripted master bytes
+ * Output:      USISRL, USIIFG, USI interrupt requests, reply trace (the first
+ *              TRACE_LIMIT transfers)
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+// Macros
+#define CTL0_SWRST  0x01
+#define CTL1_IFG    0x01
+#define CTL1_IE     0x10
+#define CNT_IFGCC   0x20
+#define CNT_BITS    0x1F
+
+#define TRACE_LIMIT 32          // transfers traced to stderr; a flood is only counted
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+Usi::Usi(Machine& m, UsiConfig cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+void Usi::advance(uint64_t now)
+{
+    while (!master_.empty() && master_.front().t <= now)
+    {
+        uint8_t in = master_.front().byte;
+        master_.pop_front();
+
+        if ((m_.raw8(cfg_.ctl0) & CTL0_SWRST) || !(m_.raw8(cfg_.cnt) & CNT_BITS))
+        {
+            if (lost_++ < TRACE_LIMIT)
+            {
+                std::fprintf(stderr, "hostsim: USI not ready, master byte 0x%02X lost\n", in);
+            }
+            continue;
+        }
+
+        uint8_t out = m_.raw8(cfg_.srl);
+        m_.setRaw8(cfg_.srl, in);
+        m_.setRaw8(cfg_.cnt, m_.raw8(cfg_.cnt) & ~CNT_BITS);
+        m_.setRaw8(cfg_.ctl1, m_.raw8(cfg_.ctl1) | CTL1_IFG);
+        if (transfers_++ < TRACE_LIMIT)
+        {
+            std::fprintf(stderr, "hostsim: USI master sent 0x%02X, slave replied 0x%02X\n", in, out);
+        }
+    }
+}
+
+
+void Usi::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    m_.setRaw(addr, bits, value);
+
+    if (addr == cfg_.cnt && !(value & CNT_IFGCC))
+    {
+        m_.setRaw8(cfg_.ctl1, m_.raw8(cfg_.ctl1) & ~CTL1_IFG);     // loading USICNT clears USIIFG
+    }
+}
+
+
+uint64_t Usi::pending() const
+{
+    uint8_t ctl1 = m_.raw8(cfg_.ctl1);
+    return ((ctl1 & CTL1_IE) && (ctl1 & CTL1_IFG)) ? 1ull << cfg_.vector : 0;
+}
+
+
+void Usi::reset()
+{
+    m_.setRaw8(cfg_.ctl0, CTL0_SWRST);
+    m_.setRaw8(cfg_.ctl1, CTL1_IFG);
+    m_.setRaw8(cfg_.ckctl, 0x01);
+    m_.setRaw8(cfg_.cnt, 0);
+    m_.setRaw8(cfg_.srl, 0);
+    m_.setRaw8(cfg_.srh, 0);
+}
+
+
+void Usi::report(std::FILE* out, double seconds) const
+{
+    if (transfers_)
+    {
+        std::fprintf(out, "usi                %llu SPI transfers\n", (unsigned long long)transfers_);
+    }
+    if (lost_)
+    {
+        std::fprintf(out, "usi                %llu master bytes lost (USICNT not loaded)\n", (unsigned long long)lost_);
+    }
+    (void)seconds;
+}
+
+}   // namespace hostsim
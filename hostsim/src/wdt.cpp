@@ -0,0 +1,167 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        wdt.cpp
+ * Description:     Watchdog timer: WDT_A on the F5529 (WDTIS 2^31..2^6, SMCLK/ACLK/
+ *              VLO) and WDT+ on the FG4618/F2013 (32768/8192/512/64 clocks of
+ *              SMCLK or ACLK). Interval mode raises WDTIFG in the SFR flag
+ *              register; watchdog mode expiry or a bad password is a PUC, which
+ *              stops the run
+ *
+ * Input:       WDTCTL writes, SMCLK/ACLK rate
+ * Output:      WDTIFG in SFRIFG1/IFG1, WDT interrupt requests, PUC
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/peripherals.h"
+
+// Macros (WDTCTL fields)
+#define WDT_HOLD    0x0080
+#define WDT_TMSEL   0x0010
+#define WDT_CNTCL   0x0008
+#define WDT_PW      0x5A
+
+
+namespace hostsim
+{
+
+//// Function Definitions
+Wdt::Wdt(Machine& m, WdtConfig cfg)
+    : Peripheral(m), cfg_(cfg)
+{
+}
+
+
+uint64_t Wdt::interval() const
+{
+    if (cfg_.wdtA)
+    {
+        static const uint8_t log2[8] = {31, 27, 23, 19, 15, 13, 9, 6};
+        return 1ull << log2[ctl_ & 7];
+    }
+    static const uint16_t clocks[4] = {32768, 8192, 512, 64};
+    return clocks[ctl_ & 3];
+}
+
+
+void Wdt::reconfigure()
+{
+    uint64_t hz;
+
+    if (ctl_ & WDT_HOLD)
+    {
+        hz = 0;
+    }
+    else if (cfg_.wdtA)
+    {
+        switch ((ctl_ >> 5) & 3)                    // WDTSSEL
+        {
+            case 0:  hz = m_.clocks().smclk(); break;
+            case 1:  hz = m_.clocks().aclk(); break;
+            default: hz = m_.clocks().vlo(); break;
+        }
+    }
+    else
+    {
+        hz = (ctl_ & 0x04) ? m_.clocks().aclk() : m_.clocks().smclk();
+    }
+
+    if (hz != clock_.hz)
+    {
+        clock_.rebase(last_, counted_, hz, 1);
+    }
+}
+
+
+void Wdt::advance(uint64_t now)
+{
+    reconfigure();                                  // follows clock tree changes
+    last_ = now;
+
+    uint64_t target = clock_.ticksAt(now);
+    uint64_t n = target - counted_;
+    counted_ = target;
+    if (!n)
+    {
+        return;
+    }
+
+    uint64_t span = interval();
+    uint64_t expired = (count_ + n) / span;
+    count_ = (count_ + n) % span;
+
+    if (expired)
+    {
+        if (!(ctl_ & WDT_TMSEL))
+        {
+            m_.puc("watchdog timer expired (WDTCTL not serviced or held)");
+        }
+        m_.setRaw8(cfg_.ifg, m_.raw8(cfg_.ifg) | cfg_.ifgBit);
+    }
+}
+
+
+uint64_t Wdt::nextEvent() const
+{
+    if (!clock_.hz)
+    {
+        return NEVER;
+    }
+    return clock_.timeOf(counted_ + (interval() - count_));
+}
+
+
+uint32_t Wdt::read(uint32_t addr, unsigned bits)
+{
+    (void)bits;
+    return addr == cfg_.ctl ? 0x6900 | ctl_ : ctl_ >> 8;    // password reads back as 0x69
+}
+
+
+void Wdt::write(uint32_t addr, unsigned bits, uint32_t value)
+{
+    if (addr != cfg_.ctl || bits != 16 || (value >> 8) != WDT_PW)
+    {
+        m_.puc("WDTCTL written without the 0x5A password");
+    }
+
+    ctl_ = value & 0xFF;
+    if (ctl_ & WDT_CNTCL)
+    {
+        count_ = 0;                                 // WDTCNTCL is self-clearing
+        ctl_ &= ~WDT_CNTCL;
+    }
+    last_ = m_.now();
+    reconfigure();
+    clock_.rebase(m_.now(), counted_, clock_.hz, 1);
+}
+
+
+uint64_t Wdt::pending() const
+{
+    bool flag = m_.raw8(cfg_.ifg) & cfg_.ifgBit;
+    bool enabled = m_.raw8(cfg_.ie) & cfg_.ieBit;
+    return (ctl_ & WDT_TMSEL) && flag && enabled ? 1ull << cfg_.vector : 0;
+}
+
+
+void Wdt::acknowledge(int vector)
+{
+    (void)vector;
+    m_.setRaw8(cfg_.ifg, m_.raw8(cfg_.ifg) & ~cfg_.ifgBit);    // interval mode: auto-cleared
+}
+
+
+void Wdt::reset()
+{
+    ctl_ = cfg_.wdtA ? 0x04 : 0x00;                 // watchdog mode, SMCLK, 2^15 / 32768 clocks
+    count_ = 0;
+    counted_ = 0;
+    last_ = m_.now();
+    clock_ = TickCounter();
+    reconfigure();
+}
+
+}   // namespace hostsim
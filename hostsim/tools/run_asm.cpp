@@ -0,0 +1,289 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        run_asm.cpp
+ * Description:     Host driver for the assembly labs. Assembles and links the
+ *              given .asm files (or loads a CCS-linked .out), runs them on the
+ *              instruction-set model of the device's core from the reset vector
+ *              and prints the exact MCLK cycles of every routine call and the
+ *              hottest instructions with their source lines
+ *
+ * Input:       command line (run with --help)
+ * Output:      run report on stderr, --dump memory on stdout
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/cpu.h"
+#include "hostsim/image.h"
+#include "hostsim/peripherals.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace hostsim;
+
+
+
+//// Function Prototypes
+static void usage(void);
+/* prints the command line summary
+ */
+static uint64_t parseTime(const std::string& s);
+/* "250ms" / "2s" / "100us" / "10ns" / "1500" (ps) -> picoseconds
+ */
+static bool parsePin(const std::string& s, int& port, int& bit);
+/* "P2.1" -> port 2, bit 1
+ */
+static void dump(const Machine& m, const Image& img, const std::string& spec);
+/* "label:bytes" or "0x2400:16" -> hex dump on stdout
+ */
+
+
+
+//// Stimulus
+struct Press
+{
+    uint64_t t, len;
+    int port, bit;
+};
+
+
+
+//// Call to Main
+int main(int argc, char** argv)
+{
+    Device device = Device::F5529;
+    uint64_t time = 10 * PS_PER_S;
+    bool trace = false, quiet = false;
+    int top = 10;
+    const char* elf = nullptr;
+    std::vector<std::string> files, dumps;
+    std::vector<Press> presses;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "run_asm: %s needs an argument\n", a.c_str());
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (a == "--device")
+        {
+            std::string d = next();
+            if (d == "f5529")       device = Device::F5529;
+            else if (d == "fg4618") device = Device::FG4618;
+            else if (d == "f2013")  device = Device::F2013;
+            else
+            {
+                usage();
+                return 2;
+            }
+        }
+        else if (a == "--time")
+        {
+            time = parseTime(next());
+        }
+        else if (a == "--trace")
+        {
+            trace = true;
+        }
+        else if (a == "--top")
+        {
+            top = std::atoi(next().c_str());
+        }
+        else if (a == "--dump")
+        {
+            dumps.push_back(next());
+        }
+        else if (a == "--press")
+        {
+            // P2.1@1s+200ms: switch to ground at 1 s, released 200 ms later
+            std::string p = next();
+            size_t at = p.find('@'), plus = p.find('+');
+            Press pr{};
+            if (at == std::string::npos || !parsePin(p.substr(0, at), pr.port, pr.bit))
+            {
+                usage();
+                return 2;
+            }
+            pr.t = parseTime(p.substr(at + 1, plus == std::string::npos ? std::string::npos : plus - at - 1));
+            pr.len = plus == std::string::npos ? 100 * PS_PER_S / 1000 : parseTime(p.substr(plus + 1));
+            presses.push_back(pr);
+        }
+        else if (a == "--elf")
+        {
+            elf = argv[i + 1 < argc ? ++i : i];
+        }
+        else if (a == "--quiet")
+        {
+            quiet = true;
+        }
+        else if (a[0] == '-')
+        {
+            usage();
+            return a == "--help" || a == "-h" ? 0 : 2;
+        }
+        else
+        {
+            files.push_back(a);
+        }
+    }
+    if (files.empty() == !elf)
+    {
+        usage();
+        return 2;
+    }
+
+
+    /// Image
+    Image img;
+    try
+    {
+        img = elf ? loadElf(elf, device) : assemble(files, device);
+    }
+    catch (const std::exception& e)
+    {
+        std::fprintf(stderr, "run_asm: %s\n", e.what());
+        return 1;
+    }
+
+
+    /// Machine
+    auto machine = makeMachine(device);
+    machine->setTimeLimit(time);
+    if (Usci* u = machine->find<Usci>())
+    {
+        u->setSink(stdout, false);
+    }
+    if (Gpio* g = machine->find<Gpio>())
+    {
+        for (const Press& p : presses)
+        {
+            g->drive(p.t, p.port, p.bit, 0);
+            g->drive(p.t + p.len, p.port, p.bit, -1);
+        }
+    }
+
+    Cpu cpu(*machine, coreOf(device));
+    cpu.load(img);
+    cpu.setProfile(true);
+    if (trace)
+    {
+        cpu.setTrace(stderr, &img);
+    }
+
+
+    /// Run
+    std::string end;
+    auto h0 = std::chrono::steady_clock::now();
+    try
+    {
+        cpu.reset();
+        cpu.run();
+    }
+    catch (const Halt& h)
+    {
+        end = h.what();
+    }
+    auto h1 = std::chrono::steady_clock::now();
+    std::fflush(stdout);
+
+    for (const std::string& d : dumps)
+    {
+        dump(*machine, img, d);
+    }
+
+    if (!quiet)
+    {
+        double host = std::chrono::duration<double>(h1 - h0).count();
+        std::fprintf(stderr, "\nrun_asm: stopped at %s: %s\n", img.describe(cpu.pc()).c_str(), end.c_str());
+        std::fprintf(stderr, "registers        ");
+        for (int r = 4; r < 16; r++)
+        {
+            std::fprintf(stderr, " R%d=%04X", r, cpu.reg(r));
+        }
+        std::fprintf(stderr, "\nhost             %.1f ns/instruction\n",
+                     cpu.instructions() ? host * 1e9 / cpu.instructions() : 0.0);
+        cpu.report(stderr, &img, top);
+        machine->report(stderr, host);
+    }
+    return 0;
+}
+
+
+
+//// Function Definitions
+static void usage(void)
+{
+    std::fprintf(stderr,
+        "usage: run_asm [options] file.asm...   |   run_asm [options] --elf prog.out\n"
+        "  --device f5529|fg4618|f2013  target (default f5529): memory map, core, peripherals\n"
+        "  --time T                 virtual time limit (default 10s; units s/ms/us/ns)\n"
+        "  --top N                  hot spots to list (default 10)\n"
+        "  --press P2.1@1s+200ms    switch press: pin grounded at 1s for 200ms\n"
+        "  --dump label:bytes       memory to print after the run (also 0x2400:16, P4OUT:1)\n"
+        "  --trace                  every instruction with its cycle stamp\n"
+        "  --quiet                  no run report\n");
+}
+
+
+static uint64_t parseTime(const std::string& s)
+{
+    char* end = nullptr;
+    double v = std::strtod(s.c_str(), &end);
+    std::string unit = end;
+
+    if (unit == "s")  return (uint64_t)(v * PS_PER_S);
+    if (unit == "ms") return (uint64_t)(v * PS_PER_S / 1e3);
+    if (unit == "us") return (uint64_t)(v * PS_PER_S / 1e6);
+    if (unit == "ns") return (uint64_t)(v * PS_PER_S / 1e9);
+    return (uint64_t)v;
+}
+
+
+static bool parsePin(const std::string& s, int& port, int& bit)
+{
+    return std::sscanf(s.c_str(), "P%d.%d", &port, &bit) == 2 && bit >= 0 && bit < 8;
+}
+
+
+static void dump(const Machine& m, const Image& img, const std::string& spec)
+{
+    size_t colon = spec.rfind(':');
+    std::string where = spec.substr(0, colon);
+    unsigned len = colon == std::string::npos ? 16 : std::atoi(spec.c_str() + colon + 1);
+
+    uint32_t addr = std::strtoul(where.c_str(), nullptr, 0);
+    if (!img.find(where, addr))
+    {
+        for (const Symbol& s : deviceSymbols(img.device))
+        {
+            if (where == s.name)
+            {
+                addr = s.value;
+            }
+        }
+    }
+
+    for (unsigned i = 0; i < len; i += 16)
+    {
+        std::printf("%05X:", addr + i);
+        for (unsigned j = i; j < len && j < i + 16; j++)
+        {
+            std::printf(" %02X", m.raw8(addr + j));
+        }
+        std::printf("\n");
+    }
+}
@@ -0,0 +1,449 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        run_bench.cpp
+ * Description:     Driver of the kernel benchmark suite. Runs every selected
+ *              kernel over its sizes and input distributions: the host
+ *              implementation is timed (ns per call, best of three batches),
+ *              the assembly routine, where there is one, runs on the
+ *              instruction-set model (MCLK cycles and stack bytes per call, and
+ *              of the cycles those the CPU itself executed and an energy proxy,
+ *              which differ from them for DMA-driven routines), and the two
+ *              output checksums are compared. Results go out as a table and
+ *              optionally as JSON; a previous JSON run can be given as the
+ *              baseline to flag regressions between revisions
+ *
+ * Input:       command line (run with --help)
+ * Output:      result table on stderr, JSON to --json, exit status 1 on a
+ *              regression or a host/target mismatch
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/bench.h"
+#include "hostsim/peripherals.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace hostsim;
+
+
+
+//// Function Prototypes
+static void usage(void);
+/* prints the command line summary
+ */
+static std::vector<std::string> split(const std::string& s);
+/* "a,b,c" -> {"a", "b", "c"}
+ */
+static double timeHost(const Kernel& k, const Input& in, double minSeconds, uint64_t& sum);
+/* ns per call of the host implementation: calls are batched until a batch takes
+ * minSeconds / 3, then the best of three batches is kept
+ */
+static std::string field(const std::string& line, const char* key);
+/* value of "key" in one result line of a JSON file written by this driver
+ */
+
+
+
+//// Results
+struct Result
+{
+    const Kernel* kernel = nullptr;
+    size_t size = 0;
+    std::string dist;
+    size_t elements = 0;
+    double hostNs = NAN;
+    double cycles = NAN;
+    double cpuCycles = NAN;         // cycles without the DMA's and LPM's
+    double energy = NAN;            // Target::energy()
+    double stack = NAN;             // target stack bytes per call
+    bool checked = false;           // target ran and its checksum was compared
+    bool match = false;
+    std::string error;
+};
+
+
+
+//// Call to Main
+int main(int argc, char** argv)
+{
+    std::vector<std::string> only, sizes, dists;
+    std::string root = ".", json, baseline, label;
+    double minTime = 0.02, tolerance = 0.25;
+    uint64_t seed = 1;
+    bool runHost = true, runTarget = true, list = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "run_bench: %s needs an argument\n", a.c_str());
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (a == "--list")                  list = true;
+        else if (a == "--kernel")           for (auto& k : split(next())) only.push_back(k);
+        else if (a == "--size")             sizes = split(next());
+        else if (a == "--dist")             dists = split(next());
+        else if (a == "--seed")             seed = std::strtoull(next().c_str(), nullptr, 0);
+        else if (a == "--min-time")         minTime = std::atof(next().c_str()) / 1000.0;
+        else if (a == "--host-only")        runTarget = false;
+        else if (a == "--target-only")      runHost = false;
+        else if (a == "--root")             root = next();
+        else if (a == "--json")             json = next();
+        else if (a == "--baseline")         baseline = next();
+        else if (a == "--tolerance")        tolerance = std::atof(next().c_str()) / 100.0;
+        else if (a == "--label")            label = next();
+        else
+        {
+            usage();
+            return a == "--help" || a == "-h" ? 0 : 2;
+        }
+    }
+
+    if (list)
+    {
+        for (const Kernel& k : kernels())
+        {
+            std::string s, d;
+            for (size_t n : k.sizes) s += (s.empty() ? "" : ",") + std::to_string(n);
+            for (auto& x : k.dists)  d += (d.empty() ? "" : ",") + x;
+            std::printf("%-20s %-8s %-52s sizes %s, dists %s\n", k.name, k.target ? "host+sim" : "host", k.source,
+                        s.c_str(), d.c_str());
+        }
+        return 0;
+    }
+
+
+    /// Run
+    std::vector<Result> results;
+    std::fprintf(stderr, "%-18s %6s %-10s %12s %10s %7s %12s %10s %12s %12s %6s  %s\n", "kernel", "size", "dist",
+                 "host ns/call", "ns/elem", "GB/s", "cycles/call", "cyc/elem", "cpu cyc/call", "energy/call", "stack",
+                 "check");
+
+    for (const Kernel& k : kernels())
+    {
+        bool selected = only.empty();
+        for (auto& o : only)
+        {
+            selected |= o == k.name;
+        }
+        if (!selected)
+        {
+            continue;
+        }
+
+        std::unique_ptr<Target> target;
+        std::string targetError;
+        if (runTarget && k.target)
+        {
+            try
+            {
+                target = std::make_unique<Target>(*k.target, root);
+            }
+            catch (const std::exception& e)
+            {
+                targetError = e.what();
+            }
+        }
+
+        std::vector<size_t> ns = k.sizes;
+        if (!sizes.empty())
+        {
+            ns.clear();
+            for (auto& s : sizes) ns.push_back(std::strtoul(s.c_str(), nullptr, 0));
+        }
+
+        for (size_t n : ns)
+        {
+            for (const std::string& d : dists.empty() ? k.dists : dists)
+            {
+                Result r;
+                r.kernel = &k;
+                r.size = n;
+                r.dist = d;
+                Input in;
+                in.n = n;
+                in.dist = d;
+                Rng rng(seed ^ (n * 0x9E3779B97F4A7C15ull));
+                k.generate(in, rng);
+                r.elements = in.elements ? in.elements : n;
+
+                uint64_t hostSum = k.host(in), sink = 0;
+                if (runHost)
+                {
+                    r.hostNs = timeHost(k, in, minTime, sink);
+                }
+
+                if (target)
+                {
+                    try
+                    {
+                        target->prepare();
+                        k.target->setup(*target, in);
+                        r.cycles = (double)target->run();
+                        r.cpuCycles = (double)target->cpuCycles();
+                        r.energy = target->energy();
+                        r.stack = target->stackBytes();
+                        r.checked = true;
+                        r.match = k.target->result(*target, in) == hostSum;
+                    }
+                    catch (const std::exception& e)
+                    {
+                        r.error = e.what();
+                    }
+                }
+                else if (!targetError.empty())
+                {
+                    r.error = targetError;
+                }
+
+                auto cell = [](double v, int width, int prec)
+                {
+                    char buf[32];
+                    if (std::isnan(v))
+                    {
+                        std::snprintf(buf, sizeof(buf), "%*s", width, "-");        // no such backend
+                    }
+                    else
+                    {
+                        std::snprintf(buf, sizeof(buf), "%*.*f", width, prec, v);
+                    }
+                    return std::string(buf);
+                };
+                std::fprintf(stderr, "%-18s %6zu %-10s %s %s %s %s %s %s %s %s  %s\n", k.name, n, d.c_str(),
+                             cell(r.hostNs, 12, 1).c_str(), cell(r.hostNs / r.elements, 10, 2).c_str(),
+                             cell(k.stream ? r.elements / r.hostNs : NAN, 7, 2).c_str(),
+                             cell(r.cycles, 12, 0).c_str(), cell(r.cycles / r.elements, 10, 2).c_str(),
+                             cell(r.cpuCycles, 12, 0).c_str(), cell(r.energy, 12, 0).c_str(),
+                             cell(r.stack, 6, 0).c_str(),
+                             !r.error.empty() ? r.error.c_str() : !r.checked ? "-" : r.match ? "ok" : "MISMATCH");
+                results.push_back(r);
+            }
+        }
+    }
+
+
+    /// JSON
+    if (!json.empty())
+    {
+        std::FILE* out = json == "-" ? stdout : std::fopen(json.c_str(), "w");
+        if (!out)
+        {
+            std::fprintf(stderr, "run_bench: cannot write %s\n", json.c_str());
+            return 1;
+        }
+        auto num = [](double v, char* buf) -> const char*
+        {
+            if (std::isnan(v))
+            {
+                return "null";
+            }
+            std::snprintf(buf, 32, "%.3f", v);
+            return buf;
+        };
+
+        std::fprintf(out, "{\n  \"suite\": \"hostsim-bench\",\n  \"label\": \"%s\",\n  \"seed\": %llu,\n"
+                          "  \"results\": [\n", label.c_str(), (unsigned long long)seed);
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Result& r = results[i];
+            char b[7][32];
+            std::fprintf(out,
+                         "    {\"kernel\": \"%s\", \"source\": \"%s\", \"size\": %zu, \"dist\": \"%s\", "
+                         "\"elements\": %zu, \"host_ns_per_call\": %s, \"host_ns_per_elem\": %s, "
+                         "\"target\": %s%s%s, \"cycles_per_call\": %s, \"cycles_per_elem\": %s, "
+                         "\"cpu_cycles_per_call\": %s, \"energy_per_call\": %s, \"stack_bytes\": %s, "
+                         "\"verified\": %s}%s\n",
+                         r.kernel->name, r.kernel->source, r.size, r.dist.c_str(), r.elements, num(r.hostNs, b[0]),
+                         num(r.hostNs / r.elements, b[1]), r.kernel->target ? "\"" : "",
+                         r.kernel->target ? deviceName(r.kernel->target->device) : "null",
+                         r.kernel->target ? "\"" : "", num(r.cycles, b[2]), num(r.cycles / r.elements, b[3]),
+                         num(r.cpuCycles, b[4]), num(r.energy, b[5]), num(r.stack, b[6]),
+                         !r.checked ? "null" : r.match ? "true" : "false", i + 1 < results.size() ? "," : "");
+        }
+        std::fprintf(out, "  ]\n}\n");
+        if (out != stdout)
+        {
+            std::fclose(out);
+        }
+    }
+
+
+    /// Verdict
+    int status = 0;
+    for (const Result& r : results)
+    {
+        if ((r.checked && !r.match) || !r.error.empty())
+        {
+            status = 1;
+        }
+    }
+
+    if (!baseline.empty())
+    {
+        std::ifstream f(baseline);
+        if (!f)
+        {
+            std::fprintf(stderr, "run_bench: cannot read %s\n", baseline.c_str());
+            return 1;
+        }
+
+        struct Base
+        {
+            double ns, cycles, stack;
+        };
+        auto value = [](const std::string& v) { return v.empty() || v == "null" ? NAN : std::atof(v.c_str()); };
+        std::map<std::string, Base> base;
+        std::string line;
+        while (std::getline(f, line))
+        {
+            std::string k = field(line, "kernel");
+            if (!k.empty())
+            {
+                std::string key = k + "/" + field(line, "size") + "/" + field(line, "dist");
+                base[key] = {value(field(line, "host_ns_per_call")), value(field(line, "cycles_per_call")),
+                             value(field(line, "stack_bytes"))};
+            }
+        }
+
+        // cycles and stack bytes are exact, so any increase counts; host time only beyond the tolerance
+        int regressions = 0;
+        for (const Result& r : results)
+        {
+            auto it = base.find(std::string(r.kernel->name) + "/" + std::to_string(r.size) + "/" + r.dist);
+            if (it == base.end())
+            {
+                continue;
+            }
+            double ns = it->second.ns, cy = it->second.cycles, st = it->second.stack;
+            if (!std::isnan(cy) && !std::isnan(r.cycles) && r.cycles > cy)
+            {
+                std::fprintf(stderr, "regression: %s size %zu %s: %.0f -> %.0f cycles/call\n", r.kernel->name, r.size,
+                             r.dist.c_str(), cy, r.cycles);
+                regressions++;
+            }
+            if (!std::isnan(st) && !std::isnan(r.stack) && r.stack > st)
+            {
+                std::fprintf(stderr, "regression: %s size %zu %s: %.0f -> %.0f stack bytes\n", r.kernel->name, r.size,
+                             r.dist.c_str(), st, r.stack);
+                regressions++;
+            }
+            if (!std::isnan(ns) && !std::isnan(r.hostNs) && r.hostNs > ns * (1.0 + tolerance))
+            {
+                std::fprintf(stderr, "regression: %s size %zu %s: %.1f -> %.1f host ns/call\n", r.kernel->name,
+                             r.size, r.dist.c_str(), ns, r.hostNs);
+                regressions++;
+            }
+        }
+        std::fprintf(stderr, "run_bench: %d regressions against %s\n", regressions, baseline.c_str());
+        if (regressions)
+        {
+            status = 1;
+        }
+    }
+    return status;
+}
+
+
+
+//// Function Definitions
+static void usage(void)
+{
+    std::fprintf(stderr,
+        "usage: run_bench [options]\n"
+        "  --list                   kernels, their backends, sizes and distributions\n"
+        "  --kernel A,B             run only these kernels (default: all)\n"
+        "  --size 8,64              sizes instead of each kernel's defaults\n"
+        "  --dist uniform,small     distributions instead of each kernel's defaults\n"
+        "  --seed S                 input generator seed (default 1)\n"
+        "  --min-time MS            host timing per case (default 20 ms)\n"
+        "  --host-only | --target-only\n"
+        "  --root DIR               repository root the .asm paths are relative to (default .)\n"
+        "  --json FILE              write the results as JSON ('-' for stdout)\n"
+        "  --label TEXT             label stored in the JSON (revision, host)\n"
+        "  --baseline FILE          compare with an earlier --json run: any cycle increase or\n"
+        "                           host time beyond --tolerance is a regression (exit 1)\n"
+        "  --tolerance PCT          host time tolerance against the baseline (default 25)\n");
+}
+
+
+static std::vector<std::string> split(const std::string& s)
+{
+    std::vector<std::string> out;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ','))
+    {
+        if (!item.empty())
+        {
+            out.push_back(item);
+        }
+    }
+    return out;
+}
+
+
+static double timeHost(const Kernel& k, const Input& in, double minSeconds, uint64_t& sum)
+{
+    using Clock = std::chrono::steady_clock;
+    auto batch = [&](uint64_t calls)
+    {
+        auto t0 = Clock::now();
+        for (uint64_t i = 0; i < calls; i++)
+        {
+            sum += k.host(in);
+        }
+        return std::chrono::duration<double>(Clock::now() - t0).count();
+    };
+
+    uint64_t calls = 1;
+    double t = batch(calls);
+    while (t < minSeconds / 3 && calls < (1ull << 40))
+    {
+        calls *= 2;
+        t = batch(calls);
+    }
+
+    double best = t;
+    for (int rep = 0; rep < 2; rep++)
+    {
+        best = std::min(best, batch(calls));
+    }
+    return best * 1e9 / calls;
+}
+
+
+static std::string field(const std::string& line, const char* key)
+{
+    std::string k = std::string("\"") + key + "\": ";
+    size_t p = line.find(k);
+    if (p == std::string::npos)
+    {
+        return "";
+    }
+    p += k.size();
+    if (line[p] == '"')
+    {
+        size_t e = line.find('"', p + 1);
+        return line.substr(p + 1, e - p - 1);
+    }
+    size_t e = line.find_first_of(",}", p);
+    return line.substr(p, e - p);
+}
@@ -0,0 +1,377 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        run_lab.cpp
+ * Description:     Host driver for the lab programs. Builds the emulated device
+ *              the lab was written for, binds its interrupt handlers, applies
+ *              the scripted stimulus (switch presses, UART/SPI input, ADC codes)
+ *              and runs the lab's main until it returns or the virtual time
+ *              limit is reached, then prints loop/ISR statistics and the lab's
+ *              own counters (HOSTSIM_LAB_COUNTERS) to stderr
+ *
+ * Input:       command line (run with --help)
+ * Output:      lab output on stdout (printf and UART text), run report on stderr
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "hostsim/lab.h"
+#include "hostsim/peripherals.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace hostsim;
+
+
+
+//// Function Prototypes
+static void usage(void);
+/* prints the command line summary
+ */
+static uint64_t parseTime(const std::string& s);
+/* "250ms" / "2s" / "100us" / "10ns" / "1500" (ps) -> picoseconds
+ */
+static bool parsePin(const std::string& s, int& port, int& bit);
+/* "P2.1" -> port 2, bit 1
+ */
+static std::string unescape(const std::string& s);
+/* C escapes (\r \n \t \\ \xNN) -> bytes
+ */
+
+
+
+//// Stimulus
+struct PinDrive
+{
+    uint64_t t;
+    int port, bit, level;
+};
+
+struct Options
+{
+    const char* lab = nullptr;
+    uint64_t time = 10 * PS_PER_S;
+    unsigned accessCycles = 3;
+    bool quiet = false;
+    bool uartHex = false;
+    std::vector<PinDrive> pins;
+    std::vector<std::pair<uint64_t, std::string>> uart;
+    std::vector<std::pair<uint64_t, uint8_t>> spi;
+    std::vector<std::pair<int, uint16_t>> adc;
+};
+
+
+
+//// Call to Main
+int main(int argc, char** argv)
+{
+    Options opt;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string a = argv[i];
+        auto next = [&]() -> std::string
+        {
+            if (i + 1 >= argc)
+            {
+                std::fprintf(stderr, "run_lab: %s needs an argument\n", a.c_str());
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (a == "--lab")
+        {
+            opt.lab = argv[i + 1 < argc ? ++i : i];
+        }
+        else if (a == "--list")
+        {
+            for (const Lab& lab : labs())
+            {
+                std::printf("%-20s %s\n", lab.name, deviceName(lab.device));
+            }
+            return 0;
+        }
+        else if (a == "--time")
+        {
+            opt.time = parseTime(next());
+        }
+        else if (a == "--access-cycles")
+        {
+            opt.accessCycles = std::atoi(next().c_str());
+        }
+        else if (a == "--quiet")
+        {
+            opt.quiet = true;
+        }
+        else if (a == "--uart-hex")
+        {
+            opt.uartHex = true;
+        }
+        else if (a == "--pin")
+        {
+            // P2.1=0@100ms, level 0/1 or z (release)
+            std::string s = next();
+            size_t eq = s.find('='), at = s.find('@');
+            PinDrive d{};
+            if (eq == std::string::npos || !parsePin(s.substr(0, eq), d.port, d.bit))
+            {
+                usage();
+                return 2;
+            }
+            char lvl = s[eq + 1];
+            d.level = lvl == 'z' || lvl == 'Z' ? -1 : lvl - '0';
+            d.t = at == std::string::npos ? 0 : parseTime(s.substr(at + 1));
+            opt.pins.push_back(d);
+        }
+        else if (a == "--press")
+        {
+            // P2.1@1s+200ms: switch to ground at 1 s, released 200 ms later
+            std::string s = next();
+            size_t at = s.find('@'), plus = s.find('+');
+            int port, bit;
+            if (at == std::string::npos || !parsePin(s.substr(0, at), port, bit))
+            {
+                usage();
+                return 2;
+            }
+            uint64_t t = parseTime(s.substr(at + 1, plus == std::string::npos ? std::string::npos : plus - at - 1));
+            uint64_t len = plus == std::string::npos ? 100 * PS_PER_S / 1000 : parseTime(s.substr(plus + 1));
+            opt.pins.push_back({t, port, bit, 0});
+            opt.pins.push_back({t + len, port, bit, -1});
+        }
+        else if (a == "--uart")
+        {
+            // "Hey, Bot!\r"@2s
+            std::string s = next();
+            size_t at = s.rfind('@');
+            uint64_t t = 0;
+            if (at != std::string::npos && at + 1 < s.size() && isdigit((unsigned char)s[at + 1]))
+            {
+                t = parseTime(s.substr(at + 1));
+                s = s.substr(0, at);
+            }
+            opt.uart.push_back({t, unescape(s)});
+        }
+        else if (a == "--spi-rx")
+        {
+            // 50@10ms,255@20ms or 0x12,0x34; 50@10ms*1000/100us repeats the byte
+            // 1000 times, 100us apart (an SPI flood for the queue stress test)
+            std::string s = next();
+            size_t pos = 0;
+            while (pos <= s.size())
+            {
+                size_t comma = s.find(',', pos);
+                std::string item = s.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+                size_t at = item.find('@'), star = item.find('*'), slash = item.find('/');
+                uint64_t t = at == std::string::npos ? 0 : parseTime(item.substr(at + 1, star == std::string::npos ? std::string::npos : star - at - 1));
+                unsigned long repeat = 1;
+                uint64_t period = 0;
+                if (star != std::string::npos)
+                {
+                    if (slash == std::string::npos || slash < star)
+                    {
+                        usage();
+                        return 2;
+                    }
+                    repeat = std::strtoul(item.substr(star + 1, slash - star - 1).c_str(), nullptr, 0);
+                    period = parseTime(item.substr(slash + 1));
+                }
+                const uint8_t byte = (uint8_t)std::strtoul(item.substr(0, std::min(at, star)).c_str(), nullptr, 0);
+                for (unsigned long r = 0; r < repeat; r++)
+                {
+                    opt.spi.push_back({t + r * period, byte});
+                }
+                if (comma == std::string::npos)
+                {
+                    break;
+                }
+                pos = comma + 1;
+            }
+        }
+        else if (a == "--adc")
+        {
+            // A3=2048
+            std::string s = next();
+            size_t eq = s.find('=');
+            if (s.size() < 4 || (s[0] != 'A' && s[0] != 'a') || eq == std::string::npos)
+            {
+                usage();
+                return 2;
+            }
+            opt.adc.push_back({std::atoi(s.c_str() + 1), (uint16_t)std::strtoul(s.c_str() + eq + 1, nullptr, 0)});
+        }
+        else
+        {
+            usage();
+            return a == "--help" || a == "-h" ? 0 : 2;
+        }
+    }
+
+    const Lab* lab = opt.lab ? findLab(opt.lab) : nullptr;
+    if (!lab)
+    {
+        std::fprintf(stderr, "run_lab: %s lab (see --list)\n", opt.lab ? "unknown" : "no");
+        return 2;
+    }
+
+
+    /// Machine
+    auto machine = makeMachine(lab->device);
+    machine->setTimeLimit(opt.time);
+    machine->setAccessCycles(opt.accessCycles);
+    for (const IsrBinding& b : lab->isrs)
+    {
+        machine->attach(b.vector, b.isr);
+    }
+
+
+    /// Stimulus
+    if (Gpio* g = machine->find<Gpio>())
+    {
+        for (const PinDrive& d : opt.pins)
+        {
+            g->drive(d.t, d.port, d.bit, d.level);
+        }
+    }
+    if (Usci* u = machine->find<Usci>())            // UCA0 is the first USCI on every device
+    {
+        u->setSink(stdout, opt.uartHex);
+        for (auto& [t, text] : opt.uart)
+        {
+            u->receive(t, text);
+        }
+    }
+    std::vector<uint8_t> replies;
+    for (auto& [t, byte] : opt.spi)
+    {
+        replies.push_back(byte);
+    }
+    for (auto& p : machine->peripherals())
+    {
+        auto u = dynamic_cast<Usci*>(p.get());
+        if (u && !std::strncmp(u->name(), "UCB0", 4))
+        {
+            u->spiReplies(replies);
+        }
+    }
+    if (Usi* usi = machine->find<Usi>())
+    {
+        for (auto& [t, byte] : opt.spi)
+        {
+            usi->masterSends(t, byte);
+        }
+    }
+    if (Adc12* adc = machine->find<Adc12>())
+    {
+        for (auto& [ch, code] : opt.adc)
+        {
+            adc->setInput(ch, code);
+        }
+    }
+
+
+    /// Run
+    std::string end;
+    auto h0 = std::chrono::steady_clock::now();
+    try
+    {
+        int rc = lab->entry();
+        end = "main returned " + std::to_string(rc);
+    }
+    catch (const Halt& h)
+    {
+        end = h.what();
+    }
+    auto h1 = std::chrono::steady_clock::now();
+    std::fflush(stdout);
+
+    if (!opt.quiet)
+    {
+        double host = std::chrono::duration<double>(h1 - h0).count();
+        std::fprintf(stderr, "\nrun_lab: %s stopped: %s\n", lab->name, end.c_str());
+        machine->report(stderr, host);
+
+        const double seconds = machine->now() / (double)PS_PER_S;
+        for (const LabCounter& c : lab->counters)
+        {
+            std::fprintf(stderr, "%-18s %u (%.1f/s)\n", c.name, (unsigned)*c.value,
+                         seconds > 0 ? *c.value / seconds : 0.0);
+        }
+    }
+    return 0;
+}
+
+
+
+//// Function Definitions
+static void usage(void)
+{
+    std::fprintf(stderr,
+        "usage: run_lab --lab NAME [options]\n"
+        "  --list                   labs linked into this binary\n"
+        "  --time T                 virtual time limit (default 10s; units s/ms/us/ns)\n"
+        "  --pin P2.1=0@100ms       drive a pin 0/1 (z releases it) at a time\n"
+        "  --press P2.1@1s+200ms    switch press: pin grounded at 1s for 200ms\n"
+        "  --uart \"text\\r\"@2s       characters arriving on UCA0 RXD\n"
+        "  --spi-rx 50@10ms,255     SPI bytes: slave replies (USCI master) or master bytes (USI)\n"
+        "           50@1s*1000/100us  the byte 1000 times, 100us apart\n"
+        "  --adc A3=2048            ADC12 conversion code for an input channel\n"
+        "  --access-cycles N        MCLK cycles charged per register access (default 3)\n"
+        "  --uart-hex               print UART output as hex bytes\n"
+        "  --quiet                  no run report\n");
+}
+
+
+static uint64_t parseTime(const std::string& s)
+{
+    char* end = nullptr;
+    double v = std::strtod(s.c_str(), &end);
+    std::string unit = end;
+
+    if (unit == "s")  return (uint64_t)(v * PS_PER_S);
+    if (unit == "ms") return (uint64_t)(v * PS_PER_S / 1e3);
+    if (unit == "us") return (uint64_t)(v * PS_PER_S / 1e6);
+    if (unit == "ns") return (uint64_t)(v * PS_PER_S / 1e9);
+    return (uint64_t)v;
+}
+
+
+static bool parsePin(const std::string& s, int& port, int& bit)
+{
+    return std::sscanf(s.c_str(), "P%d.%d", &port, &bit) == 2 && bit >= 0 && bit < 8;
+}
+
+
+static std::string unescape(const std::string& s)
+{
+    std::string out;
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        if (s[i] != '\\' || i + 1 == s.size())
+        {
+            out += s[i];
+            continue;
+        }
+        switch (s[++i])
+        {
+            case 'r': out += '\r'; break;
+            case 'n': out += '\n'; break;
+            case 't': out += '\t'; break;
+            case 'x':
+                out += (char)std::strtoul(s.substr(i + 1, 2).c_str(), nullptr, 16);
+                i += 2;
+                break;
+            default:  out += s[i]; break;
+        }
+    }
+    return out;
+}
@@ -9,13 +9,39 @@
  * Output:      Console print of the two hardcoded numbers as well as the function value
  * Author:      Polickoski, Nick
  * Date:        August 17, 2023
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. CalcPower() squares and multiplies (O(log P) multiplications instead of P)
+ *              2. Results are 32-bit; CalcPowerChecked() flags results that do not fit,
+ *                  CalcPower() saturates them
+ *              3. CalcPowerBatch() over arrays of (base, exponent) pairs
+ *              4. Multiplications go through the MPY32 hardware multiplier when the
+ *                  device has one (MSP430F5529)
  *----------------------------------------------------------------------------*/
 
 #include <msp430.h>
 #include <stdio.h>
 
+// Macros
+#define POWER_MAX       2147483647L     // results are 32-bit signed (long int on the MSP430)
+#define POWER_MIN       (-POWER_MAX - 1)
+#define MPY32_SETTLE    5               // cycles before RES0; RES3 of a signed 32x32 is ready after 11
+
+// Type Definitions
+typedef struct
+{
+    int base;
+    int exponent;
+} PowerPair;
+
 // Function Prototypes
-long int CalcPower(int, int);           // calculates a number to a power
+long int CalcPower(int, int);           // calculates a number to a power (saturated)
+int CalcPowerChecked(int, int, long int*);                  // calculates a number to a power, flags overflow
+unsigned int CalcPowerBatch(const PowerPair[], long int[], unsigned char[], unsigned int);  // one power per pair
+int MulChecked(long int, long int, long int*);              // 32x32 multiply, flags overflow
 
 
 // Call to Main
@@ -29,22 +55,134 @@ int main()
 
     printf("%d raised to the power %d is %ld\n", a, p, b);
 
+    // batch of pairs, including ones that do not fit in 32 bits
+    const PowerPair pairs[] = {{3, 0}, {-3, 5}, {10, 9}, {10, 10}, {-2, 31}, {7, 12}, {2, -1}};
+    const unsigned int count = sizeof(pairs) / sizeof(pairs[0]);
+    long int results[sizeof(pairs) / sizeof(pairs[0])];
+    unsigned char overflow[sizeof(pairs) / sizeof(pairs[0])];
+    unsigned int i, overflows;
+
+    overflows = CalcPowerBatch(pairs, results, overflow, count);
+
+    for (i = 0; i < count; i++)
+    {
+        printf("%d raised to the power %d is %ld%s\n", pairs[i].base, pairs[i].exponent, results[i],
+               overflow[i] ? " (overflow)" : "");
+    }
+    printf("%u of %u results overflowed\n", overflows, count);
+
     return 0;
 }
 
 
 // Function Definitions
 long int CalcPower(int A, int P)
-/* function to calculate number A to the power P
+/* function to calculate number A to the power P; results that do not fit in
+ * 32 bits saturate to POWER_MAX/POWER_MIN
  */
 {
-    long int total = A;                  // 'total' variable --> to be changed
+    long int total;
 
-    for (; P > 1; P--)                   // multiplies number 'A' to changing variable 'total' 'P' times
+    CalcPowerChecked(A, P, &total);
+
+    return total;
+}
+
+
+int CalcPowerChecked(int A, int P, long int* result)
+/* function to calculate number A to the power P by square-and-multiply: walks the bits
+ * of P from the lowest, multiplying 'total' by A^(2^k) for every set bit k.
+ * Negative P gives the integer part of 1/A^-P. Returns 1 (result saturated) on overflow
+ */
+{
+    long int base = A;                   // A^(2^k)
+    long int total = 1;
+    const int odd = P & 1;               // sign of the result for negative A
+    int overflow = 0;
+
+    if (P < 0)                           // |1/A^-P| < 1 unless A is 1 or -1
     {
-        total *= A;
+        if (A == 0)
+        {
+            *result = POWER_MAX;         // 1/0
+            return 1;
+        }
+        *result = (A == 1 || A == -1) ? (A < 0 && odd ? -1 : 1) : 0;
+        return 0;
     }
 
-    return total;                        // returns total multiplied number
+    for (; P > 0 && !overflow; P >>= 1)
+    {
+        if (P & 1)
+        {
+            overflow |= MulChecked(total, base, &total);
+        }
+        if (P > 1)                       // an overflowing square is only an overflow if it is used
+        {
+            overflow |= MulChecked(base, base, &base);
+        }
+    }
+
+    if (overflow)
+    {
+        total = (A < 0 && odd) ? POWER_MIN : POWER_MAX;
+    }
+    *result = total;
+
+    return overflow;
+}
+
+
+unsigned int CalcPowerBatch(const PowerPair pairs[], long int results[], unsigned char overflow[], unsigned int count)
+/* function to calculate base^exponent of every pair into results[]; overflow[] (may be
+ * NULL) gets the flag of each one. Returns the number of results that overflowed
+ */
+{
+    unsigned int i, overflows = 0;
+    int flag;
+
+    for (i = 0; i < count; i++)
+    {
+        flag = CalcPowerChecked(pairs[i].base, pairs[i].exponent, &results[i]);
+        if (overflow)
+        {
+            overflow[i] = (unsigned char)flag;
+        }
+        overflows += flag;
+    }
+
+    return overflows;
 }
 
+
+int MulChecked(long int x, long int y, long int* product)
+/* function to multiply two 32-bit signed numbers; 'product' gets the low 32 bits.
+ * Returns 1 if the full 64-bit product does not fit in 32 bits
+ */
+{
+#if defined(__MSP430_HAS_MPY32__)
+    unsigned int res0, res1, res2, res3, ext;
+
+    MPYS32L = (unsigned int)x;           // signed 32x32: the multiplication starts on the write of OP2H
+    MPYS32H = (unsigned int)(x >> 16);
+    OP2L = (unsigned int)y;
+    OP2H = (unsigned int)(y >> 16);
+    __delay_cycles(MPY32_SETTLE);
+
+    res0 = RES0;
+    res1 = RES1;
+    res2 = RES2;
+    res3 = RES3;
+
+    *product = (long int)(signed short)res1 * 65536L + res0;
+    ext = (res1 & 0x8000) ? 0xFFFF : 0x0000;   // RES3:RES2 must be the sign extension of RES1
+
+    return res2 != ext || res3 != ext;
+#else
+    long long int full = (long long int)x * y;
+
+    *product = (long int)full;
+
+    return full > POWER_MAX || full < POWER_MIN;
+#endif
+}
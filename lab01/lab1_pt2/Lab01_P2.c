@@ -31,6 +31,20 @@
  *              - moved trailing comments to be on the same line, section title comments
  *                  remain in the same position
  *              - added trailing comments for logical and syntactical errors
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. get_prime_factors() takes full 32-bit inputs and returns (prime, exponent)
+ *                  pairs instead of one array element per factor
+ *              2. Trial division resumes from the last factor found and stops at the square
+ *                  root of the remaining value; candidates come from a small-prime table in
+ *                  flash, then a 2/3/5 wheel (8 of every 30 integers)
+ *              3. One division per candidate: the quotient is checked instead of taking '%'
+ *              4. Past WHEEL_STOP the cofactor is tested with deterministic Miller-Rabin and
+ *                  split with Pollard-rho (Brent), both on Montgomery multiplication through
+ *                  the MPY32; the wheel takes over if rho does not split within its budget
  *-----------------------------------------------------------------------------------------------*/
 
 #include <msp430.h>
@@ -40,45 +54,424 @@
 #define     false   0
 
 
-// This function finds all of the factors in `value`
-// .. Factors of `value` are output as elements of `factors`
-// .. Function return value is number of factors found (0xFFFF for error)
-int get_prime_factors(int *factors, long int value)
+#define     MAX_PRIME_POWERS    9       // 2*3*5*7*11*13*17*19*23*29 > 2^32: at most 9 distinct primes
+
+
+// One prime of a factorization and its multiplicity
+typedef struct
 {
-    int output_factor_num = 0;                                                      // SYNTAX ERROR: variable commented out
-    int factor;
-    char factor_found;
-    
-    if (value < 0)
-        return 0xFFFF;
-    
-    // Loop while remaining value is not prime
-    while (true)                                                                    // LOGICAL ERROR: "!true = false" loop would never run
+    unsigned long int prime;
+    unsigned char exponent;
+} PrimePower;
+
+
+// Primes below 256, in flash; trial division continues on the 2/3/5 wheel from 253
+static const unsigned char SMALL_PRIMES[] =
+{
+      2,   3,   5,   7,  11,  13,  17,  19,  23,  29,  31,  37,  41,  43,  47,  53,  59,  61,
+     67,  71,  73,  79,  83,  89,  97, 101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151,
+    157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251
+};
+
+// Gaps between the integers coprime to 30, starting from 1 (mod 30)
+static const unsigned char WHEEL_GAPS[8] = {6, 4, 2, 4, 2, 4, 6, 2};
+
+#define     WHEEL_START     253         // first wheel candidate above the table (13 mod 30)
+#define     WHEEL_INDEX     3           // gap after 13 (mod 30)
+#define     WHEEL_STOP      1024        // cofactors with no factor below this go to Miller-Rabin/rho
+
+#define     WORD32          0xFFFFFFFFUL
+#define     MPY32_SETTLE    5           // cycles before RES0; RES3 of a 32x32 is ready after 11
+#define     RHO_BATCH       64          // |x - y| products per gcd in Brent's cycle search
+#define     RHO_STEPS       65536UL     // iterations per attempt (smallest factor < 2^16 needs ~2^8)
+#define     RHO_TRIES       8           // polynomial constants tried before falling back to the wheel
+
+
+// Montgomery arithmetic modulo an odd `n` with R = 2^32
+typedef struct
+{
+    unsigned long int n;
+    unsigned long int ninv;             // -1/n mod R
+    unsigned long int one;              // R mod n (1 in Montgomery form)
+    unsigned long int r2;               // R^2 mod n (converts into Montgomery form)
+} Montgomery;
+
+
+// This function returns floor(sqrt(`value`)) using shifts and subtractions only
+static unsigned int isqrt32(unsigned long int value)
+{
+    unsigned long int root = 0;
+    unsigned long int bit = 1UL << 30;
+
+    while (bit > value)
+        bit >>= 2;
+
+    while (bit != 0)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (unsigned int)root;
+}
+
+
+// This function divides every power of `factor` out of `*value`
+// .. Multiplicity is stored in `power` when `factor` divides `*value`
+// .. Function return value is true if `factor` divides `*value`
+static char divide_out(unsigned long int *value, unsigned long int factor, PrimePower *power)
+{
+    unsigned long int quotient = *value / factor;
+
+    if (quotient * factor != *value)
+        return false;
+
+    power->prime = factor;
+    power->exponent = 0;
+    do
+    {
+        *value = quotient;
+        power->exponent++;
+        quotient = *value / factor;
+    } while (quotient * factor == *value);
+
+    return true;
+}
+
+
+// This function returns the 64-bit product of two 32-bit values
+static unsigned long long mul32(unsigned long int a, unsigned long int b)
+{
+#if defined(__MSP430_HAS_MPY32__)
+    unsigned int res0, res1, res2, res3;
+
+    MPY32L = (unsigned int)a;           // unsigned 32x32: starts on the write of OP2H
+    MPY32H = (unsigned int)(a >> 16);
+    OP2L = (unsigned int)b;
+    OP2H = (unsigned int)(b >> 16);
+    __delay_cycles(MPY32_SETTLE);
+
+    res0 = RES0;
+    res1 = RES1;
+    res2 = RES2;
+    res3 = RES3;
+
+    return ((unsigned long long)((unsigned long int)res3 << 16 | res2) << 32) | ((unsigned long int)res1 << 16 | res0);
+#else
+    return (unsigned long long)a * b;
+#endif
+}
+
+
+// This function sets up Montgomery arithmetic modulo the odd value `n`
+static void mont_init(Montgomery *m, unsigned long int n)
+{
+    unsigned long int inv = n;          // n*n = 1 (mod 8): correct to 3 bits
+    int i;
+
+    for (i = 0; i < 4; i++)             // Newton: 3 -> 6 -> 12 -> 24 -> 48 bits
+        inv = (inv * (2 - n * inv)) & WORD32;
+
+    m->n = n;
+    m->ninv = (0 - inv) & WORD32;
+    m->one = (unsigned long int)(0x100000000ULL % n);
+    m->r2 = (unsigned long int)((unsigned long long)m->one * m->one % n);
+}
+
+
+// This function returns a*b/R mod n (Montgomery product), with no division
+static unsigned long int mont_mul(const Montgomery *m, unsigned long int a, unsigned long int b)
+{
+    unsigned long long t = mul32(a, b);
+    unsigned long int lo = (unsigned long int)t & WORD32;
+    unsigned long int q = (unsigned long int)mul32(lo, m->ninv) & WORD32;
+    unsigned long long u;
+
+    // t + q*n is a multiple of R; its low half carries out exactly when lo != 0
+    u = (t >> 32) + (mul32(q, m->n) >> 32) + (lo != 0);
+    if (u >= m->n)
+        u -= m->n;
+
+    return (unsigned long int)u;
+}
+
+
+// This function returns a + b mod n for a, b < n, without overflowing 32 bits
+static unsigned long int add_mod(unsigned long int a, unsigned long int b, unsigned long int n)
+{
+    unsigned long int room = n - b;
+
+    return a >= room ? a - room : a + b;
+}
+
+
+// This function returns `base`^`e` in Montgomery form (`base` in Montgomery form)
+static unsigned long int mont_pow(const Montgomery *m, unsigned long int base, unsigned long int e)
+{
+    unsigned long int result = m->one;
+
+    for (; e != 0; e >>= 1)
+    {
+        if (e & 1)
+            result = mont_mul(m, result, base);
+        base = mont_mul(m, base, base);
+    }
+
+    return result;
+}
+
+
+// This function returns the greatest common divisor of `a` and `b` (binary, no division)
+static unsigned long int gcd32(unsigned long int a, unsigned long int b)
+{
+    unsigned long int t;
+    int shift = 0;
+
+    if (a == 0)
+        return b;
+    if (b == 0)
+        return a;
+
+    while (((a | b) & 1) == 0)
+    {
+        a >>= 1;
+        b >>= 1;
+        shift++;
+    }
+    while ((a & 1) == 0)
+        a >>= 1;
+
+    do
+    {
+        while ((b & 1) == 0)
+            b >>= 1;
+        if (a > b)
+        {
+            t = a;
+            a = b;
+            b = t;
+        }
+        b -= a;
+    } while (b != 0);
+
+    return a << shift;
+}
+
+
+// This function tests `n` for primality
+// .. Miller-Rabin with bases 2, 7 and 61 is exact for every n < 4759123141
+// .. Function return value is true if `n` is prime
+char is_prime32(unsigned long int n)
+{
+    static const unsigned char BASES[] = {2, 7, 61};
+    Montgomery m;
+    unsigned long int d, x, minus_one;
+    unsigned int i;
+    int s, r;
+
+    if (n < 2)
+        return false;
+    if ((n & 1) == 0)
+        return n == 2;
+    for (i = 0; i < sizeof(BASES); i++)
     {
-        factor_found = false;
-        factor = 2;
-        
-        // Get lowest remaining factor of `value`
-        while (factor <= value)                                                     // LOGICAL ERROR: "factor <= value/2" skips the last value of the factorization
+        if (n == BASES[i])
+            return true;
+    }
+
+    // n - 1 = d * 2^s with d odd
+    for (d = n - 1, s = 0; (d & 1) == 0; d >>= 1)
+        s++;
+
+    mont_init(&m, n);
+    minus_one = n - m.one;
+
+    for (i = 0; i < sizeof(BASES); i++)
+    {
+        x = mont_pow(&m, mont_mul(&m, BASES[i], m.r2), d);
+        if (x == m.one || x == minus_one)
+            continue;
+
+        for (r = 1; r < s && x != minus_one; r++)
+            x = mont_mul(&m, x, x);
+
+        if (x != minus_one)
+            return false;
+    }
+
+    return true;
+}
+
+
+// This function looks for a nontrivial factor of the odd composite `n`
+// .. Pollard-rho on x -> x^2 + c with Brent's cycle search and batched gcds
+// .. Function return value is the factor, or 0 if none was found in RHO_TRIES * RHO_STEPS steps
+unsigned long int pollard_brent(unsigned long int n)
+{
+    Montgomery m;
+    unsigned long int c, x, y, ys, q, g, diff;
+    unsigned long int r, k, i, steps;
+    int tries;
+
+    mont_init(&m, n);
+
+    for (tries = 1; tries <= RHO_TRIES; tries++)
+    {
+        c = mont_mul(&m, tries, m.r2);
+        y = add_mod(m.one, m.one, n);
+        q = m.one;
+        g = 1;
+        x = ys = y;
+
+        for (r = 1; g == 1 && r <= RHO_STEPS; r <<= 1)
         {
-            if (value % factor == 0) // Is `factor` a factor of `value`?            // LOGICAL ERROR: "value % factor == 1" doesn't find a factor of value
-            {  
-                factor_found = true; // Factor found
-                break;
+            x = y;
+            for (i = 0; i < r; i++)
+                y = add_mod(mont_mul(&m, y, y), c, n);
+
+            for (k = 0; k < r && g == 1; k += steps)
+            {
+                ys = y;
+                steps = (r - k < RHO_BATCH) ? r - k : RHO_BATCH;
+                for (i = 0; i < steps; i++)
+                {
+                    y = add_mod(mont_mul(&m, y, y), c, n);
+                    diff = x > y ? x - y : y - x;
+                    q = mont_mul(&m, q, diff);
+                }
+                g = gcd32(q, n);
             }
-            
-            factor++;                // Factor not found
         }
-        
-        if (!factor_found)
-            break;
-        
-        // Add factor to array, and divide out of working value
-        factors[output_factor_num] = factor;                                        // SYNTAX ERROR: missing semicolon
+
+        if (g == n)                     // the batch overshot: step through it one gcd at a time
+        {
+            do
+            {
+                ys = add_mod(mont_mul(&m, ys, ys), c, n);
+                diff = x > ys ? x - ys : ys - x;
+                g = gcd32(diff, n);
+            } while (g == 1);
+        }
+
+        if (g != 1 && g != n)
+            return g;
+    }
+
+    return 0;
+}
+
+
+// This function adds `exponent` to the entry of `prime` in `factors`, keeping them in order
+static void add_prime_power(PrimePower *factors, int *count, unsigned long int prime, unsigned char exponent)
+{
+    int i, j;
+
+    for (i = *count; i > 0 && factors[i - 1].prime >= prime; i--)
+    {
+        if (factors[i - 1].prime == prime)
+        {
+            factors[i - 1].exponent += exponent;
+            return;
+        }
+    }
+
+    for (j = *count; j > i; j--)
+        factors[j] = factors[j - 1];
+    factors[i].prime = prime;
+    factors[i].exponent = exponent;
+    (*count)++;
+}
+
+
+// This function finds the prime factorization of `value`
+// .. Primes of `value` are output low to high as (prime, exponent) elements of `factors`,
+//    which must hold MAX_PRIME_POWERS elements
+// .. Function return value is number of distinct primes found (0 for values below 2)
+int get_prime_factors(PrimePower *factors, unsigned long int value)
+{
+    int output_factor_num = 0;
+    unsigned int limit = isqrt32(value);        // no factor above this is left to find
+    unsigned long int factor, part;
+    unsigned long int pending[4];               // composites still to split (at most 3 primes >= WHEEL_STOP)
+    int num_pending;
+    unsigned int i, gap;
+    PrimePower power;
+
+    if (value < 2)
+        return 0;
+
+    // Primes from the table
+    for (i = 0; i < sizeof(SMALL_PRIMES) && SMALL_PRIMES[i] <= limit; i++)
+    {
+        if (divide_out(&value, SMALL_PRIMES[i], &factors[output_factor_num]))
+        {
+            output_factor_num++;
+            limit = isqrt32(value);
+        }
+    }
+
+    // Candidates coprime to 2, 3 and 5 past the table
+    for (factor = WHEEL_START, gap = WHEEL_INDEX; factor <= limit && factor < WHEEL_STOP; factor += WHEEL_GAPS[gap], gap = (gap + 1) & 7)
+    {
+        if (divide_out(&value, factor, &factors[output_factor_num]))
+        {
+            output_factor_num++;
+            limit = isqrt32(value);
+        }
+    }
+
+    // What is left has no factor at or below its square root
+    if (value > 1 && factor > limit)
+    {
+        factors[output_factor_num].prime = value;
+        factors[output_factor_num].exponent = 1;
         output_factor_num++;
-        value /= factor;
+        return output_factor_num;
     }
-    
+
+    // Larger cofactors: primes are recognized, composites are split
+    pending[0] = value;
+    num_pending = value > 1;
+    while (num_pending > 0)
+    {
+        value = pending[--num_pending];
+
+        if (is_prime32(value))
+        {
+            add_prime_power(factors, &output_factor_num, value, 1);
+            continue;
+        }
+
+        part = pollard_brent(value);
+        if (part != 0)
+        {
+            pending[num_pending++] = part;
+            pending[num_pending++] = value / part;
+            continue;
+        }
+
+        // Rho gave up: finish this part on the wheel
+        limit = isqrt32(value);
+        for (part = factor, i = gap; part <= limit; part += WHEEL_GAPS[i], i = (i + 1) & 7)
+        {
+            if (divide_out(&value, part, &power))
+            {
+                add_prime_power(factors, &output_factor_num, power.prime, power.exponent);
+                limit = isqrt32(value);
+            }
+        }
+        if (value > 1)
+            add_prime_power(factors, &output_factor_num, value, 1);
+    }
+
     return output_factor_num;
 }
 
@@ -88,32 +481,34 @@ int main(void)
 	// stop watchdog timer
     WDTCTL = WDTPW + WDTHOLD;                                                       // LOGICAL ERROR: no code for watchdog timer implementation
     
-    // Input value for factorization
-    const long int INPUT_VALUE = 84;
-    
+    // Input values for factorization
+    const unsigned long int INPUT_VALUES[] = {84, 4294967291UL, 4294967295UL, 4292870399UL, 4293001441UL};
+
     // Output array
-    // Array must have at least as many elements as factors of INPUT_VALUE
-    int prime_factors[10] = {};
-    
+    PrimePower prime_factors[MAX_PRIME_POWERS] = {};
+
     int num_factors;
+    unsigned int v;
     int i;
-    
-    // Calculate prime factors, and check for function error
-    num_factors = get_prime_factors(prime_factors, INPUT_VALUE);
-    if (num_factors == 0xFFFF)
-    {
-        return 1;
-    }
-    
-    // Print input value & output prime factors separated by spaces
-    printf("Input value:\n %d \n", INPUT_VALUE);
-    printf("Output factors: \n");
-    for (i = 0; i < num_factors; i++)
+
+    for (v = 0; v < sizeof(INPUT_VALUES) / sizeof(INPUT_VALUES[0]); v++)
     {
-        printf("%d ", prime_factors[i]);
+        num_factors = get_prime_factors(prime_factors, INPUT_VALUES[v]);
+
+        // Print input value & output prime factors separated by spaces
+        printf("Input value:\n %lu \n", INPUT_VALUES[v]);
+        printf("Output factors: \n");
+        for (i = 0; i < num_factors; i++)
+        {
+            if (prime_factors[i].exponent > 1)
+                printf("%lu^%d ", prime_factors[i].prime, prime_factors[i].exponent);
+            else
+                printf("%lu ", prime_factors[i].prime);
+        }
+
+        printf("\n");
     }
-    
-    printf("\n");
+
     fflush(stdout);
     
 	return 0;
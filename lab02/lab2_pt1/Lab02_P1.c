@@ -64,7 +64,7 @@ int main()
 
     // float
     printf("| %-22s | %-15d | %-20e | %-20e |\n", "float", sizeof(float), FLT_MIN, FLT_MAX);
-ft
+
     // double
     printf("| %-22s | %-15d | %-20e | %-20e |\n", "double", sizeof(double), DBL_MIN, DBL_MAX);
 
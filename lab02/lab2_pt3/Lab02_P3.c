@@ -11,6 +11,28 @@
  *              on the two inputted arrrays
  * Author:      Polickoski, Nick
  * Date:        August 28, 2023
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. MatrixMulQ15(): fixed-point product of size x size matrices (size set at
+ *                  run time) with Q15 elements and Q31 results, accumulated in the MPY32
+ *                  (MACS with MPYFRAC and MPYSAT) instead of with soft-float multiply-adds
+ *              2. main() also runs the matrices through MatrixMulQ15() and prints the result
+ *              3. MatrixMulAuto(): classifies both operands (identity, diagonal, permutation,
+ *                  row-rotation/circulant, dense) in O(SIZE^2) and runs the cheapest kernel:
+ *                  a copy, a row/column permutation, a diagonal scaling, or one row plus
+ *                  rotations when both operands are circulant; dense MatrixMul() otherwise
+ *              4. matrix1/matrix2 are const file-scope tables (FLASH) instead of initialised
+ *                  locals copied onto the stack by every call of main(). MatrixView points
+ *                  at matrix data with row/column strides, so transposed and strided
+ *                  (sub-block, every n-th row/column) views need no copy; MatrixMulView()
+ *                  and PrintMatrixView() take views, MatrixMul()/PrintMatrix() wrap them
+ *              5. PrintMatrixView() formats with FormatFloat() (FormatFixed() for Q31 results)
+ *                  instead of printf("%10f"): fixed-point digit generation, no float printf
+ *                  in the image, and each row goes out in one fputs() from a buffer of
+ *                  one SIZE-column row (188 bytes of RAM)
  *----------------------------------------------------------------------------*/
 
 /// Preprocessor Directives
@@ -23,15 +45,146 @@
  * the call to main, and the function definitions
  */
 
+#define MPY32_SETTLE 4
+/* cycles between the last OP2 write and reading RESLO/RESHI: a 16x16 MACS has them
+ * after 3, one more with MPYFRAC or MPYSAT (both set by MatrixMulQ15())
+ */
+
+#define Q15_SCALE 32.0f
+#define Q15_SCALE_BITS 5
+/* both matrices are divided by this (2^5) before going to Q15, so elements up to 8 in
+ * magnitude keep every sum of SIZE products below 1 (the Q31 range)
+ */
+
+#define FORMAT_PRECISION_MAX 9
+#define FORMAT_MAX 22
+/* FormatFloat()/FormatFixed(): the fraction is carried in Q32, good for 9 decimals;
+ * a field is at most sign, 10 digits, point and 9 decimals plus the NUL (or the
+ * width plus the NUL when that is more)
+ */
+
+#define PRINT_PRECISION 6
+#define PRINT_WIDTH 10
+#define PRINT_ROW_MAX(cols) (4 + (cols) * (FORMAT_MAX + 1))
+#define PRINT_BUFFER PRINT_ROW_MAX(SIZE)
+/* matrix prints: "%10f, " fields, "[...]\n" rows (with the NUL, PRINT_ROW_MAX bytes at
+ * most); the buffer holds one row of SIZE columns, so a print costs a flush per row
+ * but only that much RAM
+ */
+
+
+
+/// Type Definitions
+typedef enum
+{
+    MATRIX_DENSE,
+    MATRIX_IDENTITY,
+    MATRIX_DIAGONAL,
+    MATRIX_PERMUTATION,                 // one 1.0 per row and column, zeros elsewhere
+    MATRIX_CIRCULANT                    // each row is the previous one rotated right by a fixed shift
+} MatrixKind;
+
+typedef struct
+{
+    const float* data;                  // element (0, 0); may point at const data in FLASH
+    short int rowStride;                // elements from one row to the next
+    short int colStride;                // elements from one column to the next
+    unsigned short int rows, cols;
+} MatrixView;
+
 
 
 /// Function Prototypes
-void MatrixMul(float[SIZE][SIZE], float[SIZE][SIZE], float[SIZE][SIZE]);
+void MatrixMul(const float[SIZE][SIZE], const float[SIZE][SIZE], float[SIZE][SIZE]);
 /* takes in two matrices and multiplies them by each other
  */
-void PrintMatrix(float[SIZE][SIZE]);
+void PrintMatrix(const float[SIZE][SIZE]);
 /* prints all elements of a matrix
 */
+MatrixView MatrixViewOf(const float*, unsigned short int, unsigned short int);
+/* view of a row-major rows x cols array
+ */
+MatrixView MatrixViewTranspose(MatrixView);
+/* the same elements with rows and columns swapped
+ */
+MatrixView MatrixViewBlock(MatrixView, unsigned short int, unsigned short int, unsigned short int,
+                           unsigned short int, unsigned short int);
+/* rows x cols elements starting at (row, col), taking every step-th row and column
+ */
+int MatrixMulView(const MatrixView*, const MatrixView*, float*);
+/* multiplies two views into a row-major array, returns 1 if their shapes do not match
+ */
+void PrintMatrixView(const MatrixView*);
+/* prints all elements of a view
+ */
+void PrintMatrixFixed(const long int*, unsigned short int, unsigned short int, unsigned char);
+/* prints a row-major rows x cols matrix of fixed-point numbers with the given fraction bits
+ */
+unsigned int FormatMatrixRow(char*, const MatrixView*, unsigned short int);
+/* formats one row of a view as "[field, field, ]\n", returns its length
+ */
+unsigned int FormatFloat(char*, float, unsigned char, unsigned char);
+/* formats a float with 'precision' decimals right-aligned in 'width', returns the length
+ */
+unsigned int FormatFixed(char*, long int, unsigned char, unsigned char, unsigned char);
+/* formats a fixed-point number with 'fracBits' fraction bits like FormatFloat()
+ */
+void MatrixMulQ15(const int*, const int*, long int*, unsigned int);
+/* multiplies two size x size Q15 matrices (row-major) into a Q31 matrix
+ */
+int FloatToQ15(float);
+/* converts a number in [-1, 1) to Q15, saturating outside it
+ */
+float Q31ToFloat(long int);
+/* converts a Q31 number to float
+ */
+MatrixKind MatrixClassify(const float[SIZE][SIZE], unsigned char[SIZE]);
+/* finds the structure of a matrix (permutation columns or circulant shift in the array)
+ */
+MatrixKind MatrixMulAuto(const float[SIZE][SIZE], const float[SIZE][SIZE], float[SIZE][SIZE]);
+/* multiplies two matrices with the kernel their structure allows, returns the kernel used
+ */
+
+
+
+/// Print Buffer
+static char printBuffer[PRINT_BUFFER];
+
+static const char PRINT_RULE[] = "------------------------------\n";
+
+static const unsigned long int POWERS_OF_10[] = {1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+                                                 10000UL, 1000UL, 100UL, 10UL, 1UL};
+
+
+
+/// Matrices
+// const: kept in FLASH and read in place, instead of being copied onto the stack by main()
+static const float matrix1[SIZE][SIZE] = {1.0,2.0,3.0,4.0,5.0,6.0,7.0,8.0,
+                                          8.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0,
+                                          7.0,8.0,1.0,2.0,3.0,4.0,5.0,6.0,
+                                          6.0,7.0,8.0,1.0,2.0,3.0,4.0,5.0,
+                                          5.0,6.0,7.0,8.0,1.0,2.0,3.0,4.0,
+                                          4.0,5.0,6.0,7.0,8.0,1.0,2.0,3.0,
+                                          3.0,4.0,5.0,6.0,7.0,8.0,1.0,2.0,
+                                          2.0,3.0,4.0,5.0,6.0,7.0,8.0,1.0};
+
+static const float matrix2[SIZE][SIZE] = {1.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,
+                                          0.0,1.0,0.0,0.0,0.0,0.0,0.0,0.0,
+                                          0.0,0.0,1.0,0.0,0.0,0.0,0.0,0.0,
+                                          0.0,0.0,0.0,1.0,0.0,0.0,0.0,0.0,
+                                          0.0,0.0,0.0,0.0,1.0,0.0,0.0,0.0,
+                                          0.0,0.0,0.0,0.0,0.0,1.0,0.0,0.0,
+                                          0.0,0.0,0.0,0.0,0.0,0.0,1.0,0.0,
+                                          0.0,0.0,0.0,0.0,0.0,0.0,0.0,1.0};
+
+//static const float matrix2[SIZE][SIZE] = {2.0,3.0,4.0,5.0,6.0,7.0,8.0,1.0,
+//                                          3.0,4.0,5.0,6.0,7.0,8.0,1.0,2.0,
+//                                          4.0,5.0,6.0,7.0,8.0,1.0,2.0,3.0,
+//                                          5.0,6.0,7.0,8.0,1.0,2.0,3.0,4.0,
+//                                          6.0,7.0,8.0,1.0,2.0,3.0,4.0,5.0,
+//                                          7.0,8.0,1.0,2.0,3.0,4.0,5.0,6.0,
+//                                          8.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0,
+//                                          1.0,2.0,3.0,4.0,5.0,6.0,7.0,8.0};
 
 
 
@@ -42,54 +195,61 @@ int main()
     WDTCTL = WDTPW + WDTHOLD;
 
 
-    // Initialization of Matrices
-    float matrix1[SIZE][SIZE] = {1.0,2.0,3.0,4.0,5.0,6.0,7.0,8.0,
-                                 8.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0,
-                                 7.0,8.0,1.0,2.0,3.0,4.0,5.0,6.0,
-                                 6.0,7.0,8.0,1.0,2.0,3.0,4.0,5.0,
-                                 5.0,6.0,7.0,8.0,1.0,2.0,3.0,4.0,
-                                 4.0,5.0,6.0,7.0,8.0,1.0,2.0,3.0,
-                                 3.0,4.0,5.0,6.0,7.0,8.0,1.0,2.0,
-                                 2.0,3.0,4.0,5.0,6.0,7.0,8.0,1.0};
-
-    float matrix2[SIZE][SIZE] = {1.0,0.0,0.0,0.0,0.0,0.0,0.0,0.0,
-                                 0.0,1.0,0.0,0.0,0.0,0.0,0.0,0.0,
-                                 0.0,0.0,1.0,0.0,0.0,0.0,0.0,0.0,
-                                 0.0,0.0,0.0,1.0,0.0,0.0,0.0,0.0,
-                                 0.0,0.0,0.0,0.0,1.0,0.0,0.0,0.0,
-                                 0.0,0.0,0.0,0.0,0.0,1.0,0.0,0.0,
-                                 0.0,0.0,0.0,0.0,0.0,0.0,1.0,0.0,
-                                 0.0,0.0,0.0,0.0,0.0,0.0,0.0,1.0};
-
-//    float matrix2[SIZE][SIZE] = {2.0,3.0,4.0,5.0,6.0,7.0,8.0,1.0,
-//                                 3.0,4.0,5.0,6.0,7.0,8.0,1.0,2.0,
-//                                 4.0,5.0,6.0,7.0,8.0,1.0,2.0,3.0,
-//                                 5.0,6.0,7.0,8.0,1.0,2.0,3.0,4.0,
-//                                 6.0,7.0,8.0,1.0,2.0,3.0,4.0,5.0,
-//                                 7.0,8.0,1.0,2.0,3.0,4.0,5.0,6.0,
-//                                 8.0,1.0,2.0,3.0,4.0,5.0,6.0,7.0,
-//                                 1.0,2.0,3.0,4.0,5.0,6.0,7.0,8.0};
-
     float matrixResult[SIZE][SIZE];
 
 
     // Matrix Multiplication Function Call
-    MatrixMul(matrix1, matrix2, matrixResult);
+    MatrixKind kernel = MatrixMulAuto(matrix1, matrix2, matrixResult);
+
+    // Views of the FLASH tables, no copies
+    const MatrixView view1 = MatrixViewOf(&matrix1[0][0], SIZE, SIZE);
+    const MatrixView view2 = MatrixViewOf(&matrix2[0][0], SIZE, SIZE);
+    const MatrixView view1T = MatrixViewTranspose(view1);
+    const MatrixView view1Even = MatrixViewBlock(view1, 0, 0, SIZE / 2, SIZE / 2, 2);
 
 
     // Print to Console
     printf("\nMatrix #1: \n");
-    PrintMatrix(matrix1);
+    PrintMatrixView(&view1);
 
     printf("\nMatrix #2: \n");
-    PrintMatrix(matrix2);
+    PrintMatrixView(&view2);
 
     printf("\n============================================"
             "====================================================\n");
 
-    printf("\nMultiplied Matrix: \n");
+    static const char* const KIND_NAMES[] = {"dense", "identity", "diagonal", "permutation", "circulant"};
+    printf("\nMultiplied Matrix (%s kernel): \n", KIND_NAMES[kernel]);
     PrintMatrix(matrixResult);
 
+    MatrixMulView(&view1T, &view2, &matrixResult[0][0]);
+    printf("\nMatrix #1 Transposed x Matrix #2 (views): \n");
+    PrintMatrix(matrixResult);
+
+    printf("\nEven Rows and Columns of Matrix #1 (view): \n");
+    PrintMatrixView(&view1Even);
+
+
+    // Fixed-Point Matrix Multiplication (Q15 x Q15 -> Q31)
+    int matrix1Q15[SIZE * SIZE], matrix2Q15[SIZE * SIZE];
+    long int matrixResultQ31[SIZE * SIZE];
+    unsigned short int row, col;
+
+    for (row = 0; row < SIZE; row++)
+    {
+        for (col = 0; col < SIZE; col++)
+        {
+            matrix1Q15[row * SIZE + col] = FloatToQ15(matrix1[row][col] / Q15_SCALE);
+            matrix2Q15[row * SIZE + col] = FloatToQ15(matrix2[row][col] / Q15_SCALE);
+        }
+    }
+
+    MatrixMulQ15(matrix1Q15, matrix2Q15, matrixResultQ31, SIZE);
+
+    // printed straight from Q31, undoing the scaling of both operands in the fraction bits
+    printf("\nMultiplied Matrix (Q15): \n");
+    PrintMatrixFixed(matrixResultQ31, SIZE, SIZE, 31 - 2 * Q15_SCALE_BITS);
+
 
     return 0;
 }
@@ -97,53 +257,650 @@ int main()
 
 
 /// Function Definitions
-void MatrixMul(float mtx1[SIZE][SIZE], float mtx2[SIZE][SIZE], float mtxRslt[SIZE][SIZE])
+void MatrixMul(const float mtx1[SIZE][SIZE], const float mtx2[SIZE][SIZE], float mtxRslt[SIZE][SIZE])
 /* takes in two matrices and multiplies them by each other
  */
 {
-    // Iterates through each element in the result matrix
+    const MatrixView view1 = MatrixViewOf(&mtx1[0][0], SIZE, SIZE);
+    const MatrixView view2 = MatrixViewOf(&mtx2[0][0], SIZE, SIZE);
+
+    MatrixMulView(&view1, &view2, &mtxRslt[0][0]);
+
+    return;
+}
+
+
+void PrintMatrix(const float mtx[SIZE][SIZE])
+/* prints all elements of a matrix
+*/
+{
+    const MatrixView view = MatrixViewOf(&mtx[0][0], SIZE, SIZE);
+
+    PrintMatrixView(&view);
+
+    return;
+}
+
+
+MatrixView MatrixViewOf(const float* data, unsigned short int rows, unsigned short int cols)
+/* view of a row-major rows x cols array
+ */
+{
+    MatrixView view;
+
+    view.data = data;
+    view.rowStride = (short int)cols;
+    view.colStride = 1;
+    view.rows = rows;
+    view.cols = cols;
+
+    return view;
+}
+
+
+MatrixView MatrixViewTranspose(MatrixView view)
+/* the same elements with rows and columns swapped: only the strides and sizes change
+ */
+{
+    short int stride = view.rowStride;
+    unsigned short int size = view.rows;
+
+    view.rowStride = view.colStride;
+    view.colStride = stride;
+    view.rows = view.cols;
+    view.cols = size;
+
+    return view;
+}
+
+
+MatrixView MatrixViewBlock(MatrixView view, unsigned short int row, unsigned short int col, unsigned short int rows,
+                           unsigned short int cols, unsigned short int step)
+/* rows x cols elements starting at (row, col), taking every step-th row and column
+ * (step 1: a plain sub-block); the caller keeps the block inside the view
+ */
+{
+    view.data += row * view.rowStride + col * view.colStride;
+    view.rowStride *= step;
+    view.colStride *= step;
+    view.rows = rows;
+    view.cols = cols;
+
+    return view;
+}
+
+
+int MatrixMulView(const MatrixView* mtx1, const MatrixView* mtx2, float* mtxRslt)
+/* multiplies two views into a row-major mtx1->rows x mtx2->cols array; the strides are
+ * walked with pointer steps, so a view costs no more than a plain array
+ */
+{
     unsigned short int row, col, temp;
-    for (row = 0; row < SIZE; row++)
+    const float* rowPtr;
+    const float* colPtr;
+    float sum;
+
+    if (mtx1->cols != mtx2->rows)
     {
-        for (col = 0; col < SIZE; col++)
+        return 1;
+    }
+
+    // Iterates through each element in the result matrix
+    for (row = 0; row < mtx1->rows; row++)
+    {
+        for (col = 0; col < mtx2->cols; col++)
         {
-            mtxRslt[row][col] = 0; // sets current matrix element to 0 before value assigning
+            rowPtr = mtx1->data + row * mtx1->rowStride;
+            colPtr = mtx2->data + col * mtx2->colStride;
+            sum = 0; // sets current matrix element to 0 before value assigning
 
             // Iterator that adds every vector combo of the original two matrices
-            for (temp = 0; temp < SIZE; temp++)
+            for (temp = 0; temp < mtx1->cols; temp++)
             {
-                mtxRslt[row][col] += mtx1[row][temp] * mtx2[temp][col];
+                sum += *rowPtr * *colPtr;
+                rowPtr += mtx1->colStride;
+                colPtr += mtx2->rowStride;
             }
+
+            *mtxRslt++ = sum;
         }
     }
 
-    return;
+    return 0;
 }
 
 
-void PrintMatrix(float mtx[SIZE][SIZE])
-/* prints all elements of a matrix
-*/
+static unsigned int print_rule(void)
+/* starts printBuffer with the rule above a matrix, returns its length
+ */
+{
+    unsigned int i;
+
+    for (i = 0; i < sizeof(PRINT_RULE); i++) // with the NUL
+    {
+        printBuffer[i] = PRINT_RULE[i];
+    }
+
+    return sizeof(PRINT_RULE) - 1;
+}
+
+
+static unsigned int print_reserve(unsigned int length, unsigned int bytes)
+/* flushes the 'length' bytes in printBuffer if 'bytes' more (with the NUL) may not
+ * fit after them, returns where the next ones go
+ */
 {
-    printf("------------------------------\n");
+    if (length + bytes > PRINT_BUFFER)
+    {
+        printBuffer[length] = '\0';
+        fputs(printBuffer, stdout);
+        length = 0;
+    }
+
+    return length;
+}
 
-    // For-loops iterate through each element for the given matrix
+
+void PrintMatrixView(const MatrixView* mtx)
+/* prints all elements of a view: each row is formatted into printBuffer and goes out
+ * with one fputs(); a row wider than SIZE columns is formatted and flushed field by
+ * field
+ */
+{
+    unsigned int length = print_rule();
     unsigned short int row, col;
-    for (row = 0; row < SIZE; row++)
+
+    // For-loop formats each row of the given view
+    for (row = 0; row < mtx->rows; row++)
     {
-        for (col = 0; col < SIZE; col++)
+        if (PRINT_ROW_MAX(mtx->cols) <= PRINT_BUFFER)
+        {
+            length = print_reserve(length, PRINT_ROW_MAX(mtx->cols)); // sends the row before it
+            length += FormatMatrixRow(&printBuffer[length], mtx, row);
+            continue;
+        }
+
+        const float* element = mtx->data + row * mtx->rowStride;
+
+        length = print_reserve(length, 2);
+        printBuffer[length++] = '[';
+        for (col = 0; col < mtx->cols; col++, element += mtx->colStride)
+        {
+            length = print_reserve(length, FORMAT_MAX + 2);
+            length += FormatFloat(&printBuffer[length], *element, PRINT_PRECISION, PRINT_WIDTH);
+            printBuffer[length++] = ',';
+            printBuffer[length++] = ' ';
+        }
+        length = print_reserve(length, 3);
+        printBuffer[length++] = ']';
+        printBuffer[length++] = '\n';
+        printBuffer[length] = '\0';
+    }
+
+    fputs(printBuffer, stdout);
+
+    return;
+}
+
+
+void PrintMatrixFixed(const long int* mtx, unsigned short int rows, unsigned short int cols, unsigned char fracBits)
+/* prints a row-major rows x cols matrix of fixed-point numbers in the layout of
+ * PrintMatrixView(), field by field where a row is wider than printBuffer
+ */
+{
+    unsigned int length = print_rule();
+    unsigned short int row, col;
+
+    for (row = 0; row < rows; row++)
+    {
+        length = print_reserve(length, PRINT_ROW_MAX(cols) <= PRINT_BUFFER ? PRINT_ROW_MAX(cols) : 2);
+        printBuffer[length++] = '[';
+        for (col = 0; col < cols; col++)
+        {
+            length = print_reserve(length, FORMAT_MAX + 2); // only once the whole row could not be
+            length += FormatFixed(&printBuffer[length], *mtx++, fracBits, PRINT_PRECISION, PRINT_WIDTH);
+            printBuffer[length++] = ',';
+            printBuffer[length++] = ' ';
+        }
+        length = print_reserve(length, 3);
+        printBuffer[length++] = ']';
+        printBuffer[length++] = '\n';
+        printBuffer[length] = '\0';
+    }
+
+    fputs(printBuffer, stdout);
+
+    return;
+}
+
+
+unsigned int FormatMatrixRow(char* buf, const MatrixView* mtx, unsigned short int row)
+/* formats one row of a view as "[field, field, ]\n" with PRINT_PRECISION decimals in
+ * PRINT_WIDTH, the layout printf("%10f, ") gave; returns its length, buf needs
+ * PRINT_ROW_MAX(mtx->cols) bytes
+ */
+{
+    const float* element = mtx->data + row * mtx->rowStride;
+    unsigned int length = 0;
+    unsigned short int col;
+
+    buf[length++] = '[';
+    for (col = 0; col < mtx->cols; col++, element += mtx->colStride)
+    {
+        length += FormatFloat(&buf[length], *element, PRINT_PRECISION, PRINT_WIDTH);
+        buf[length++] = ',';
+        buf[length++] = ' ';
+    }
+    buf[length++] = ']';
+    buf[length++] = '\n';
+    buf[length] = '\0';
+
+    return length;
+}
+
+
+static unsigned int format_decimal(char* buf, char negative, unsigned long int whole, unsigned long int frac,
+                                   char sticky, unsigned char precision, unsigned char width)
+/* writes [-]whole.frac right-aligned in 'width' with 'precision' decimals, rounded to
+ * nearest, ties to even as printf does ('sticky': nonzero bits below the Q32 fraction
+ * were dropped, so it is not a tie). Each decimal is frac * 10 in two 16-bit halves and
+ * the integer digits come from subtracting powers of ten: no division anywhere.
+ * Returns the length written, without the NUL
+ */
+{
+    char fraction[FORMAT_PRECISION_MAX];
+    char integer[10];
+    unsigned long int low, high;
+    unsigned int count = 0, length, i;
+    char digit;
+
+    if (precision > FORMAT_PRECISION_MAX)
+    {
+        precision = FORMAT_PRECISION_MAX;
+    }
+
+    for (i = 0; i < precision; i++) // the digit is what frac * 10 carries out of 32 bits
+    {
+        low = (frac & 0xFFFFUL) * 10;
+        high = (frac >> 16) * 10 + (low >> 16);
+        fraction[i] = (char)('0' + (high >> 16));
+        frac = (high & 0xFFFFUL) << 16 | (low & 0xFFFFUL);
+    }
+
+    digit = precision ? fraction[precision - 1] : (char)whole; // only its parity is used
+    if (frac > 0x80000000UL || (frac == 0x80000000UL && (sticky || (digit & 1)))) // round up, carrying
+    {                                                                             //   into the integer part
+        for (i = precision; i > 0 && fraction[i - 1] == '9'; i--)
+        {
+            fraction[i - 1] = '0';
+        }
+        if (i > 0)
+        {
+            fraction[i - 1]++;
+        }
+        else
         {
-            if (col == 0) // conditional to create more eye-pleasing console print output
+            whole++;
+        }
+    }
+
+    for (i = 0; i < 10; i++)
+    {
+        for (digit = '0'; whole >= POWERS_OF_10[i]; digit++)
+        {
+            whole -= POWERS_OF_10[i];
+        }
+        if (digit != '0' || count > 0 || i == 9) // no leading zeros, but at least one digit
+        {
+            integer[count++] = digit;
+        }
+    }
+
+    length = negative + count + (precision ? 1 + precision : 0);
+    for (; length < width; length++)
+    {
+        *buf++ = ' ';
+    }
+
+    if (negative)
+    {
+        *buf++ = '-';
+    }
+    for (i = 0; i < count; i++)
+    {
+        *buf++ = integer[i];
+    }
+    if (precision)
+    {
+        *buf++ = '.';
+        for (i = 0; i < precision; i++)
+        {
+            *buf++ = fraction[i];
+        }
+    }
+    *buf = '\0';
+
+    return length;
+}
+
+
+unsigned int FormatFloat(char* buf, float value, unsigned char precision, unsigned char width)
+/* formats a float like printf("%*.*f") for magnitudes below 2^32 (-0.0 prints without
+ * the sign); NaN, infinities and larger values fill the field with '*'. buf needs
+ * FORMAT_MAX bytes, or width + 1 if that is more. Returns the length, without the NUL
+ */
+{
+    const char negative = value < 0.0f;
+    const float magnitude = negative ? -value : value;
+    unsigned long int whole, frac;
+    float scaled;
+    unsigned int length;
+
+    if (!(magnitude < 4294967296.0f)) // also catches NaN
+    {
+        for (length = 0; length < width || length == 0; length++)
+        {
+            buf[length] = '*';
+        }
+        buf[length] = '\0';
+
+        return length;
+    }
+
+    // magnitude - whole is exact, and so is scaling it by 2^32; only bits below 2^-32 are dropped
+    whole = (unsigned long int)magnitude;
+    scaled = (magnitude - (float)whole) * 4294967296.0f;
+    frac = (unsigned long int)scaled;
+
+    return format_decimal(buf, negative, whole, frac, (float)frac != scaled, precision, width);
+}
+
+
+unsigned int FormatFixed(char* buf, long int value, unsigned char fracBits, unsigned char precision, unsigned char width)
+/* formats a 32-bit fixed-point number with 'fracBits' (0..31) fraction bits, e.g. Q31
+ * with 31, like FormatFloat(); returns the length, without the NUL
+ */
+{
+    const char negative = value < 0;
+    const unsigned long int magnitude = negative ? 0UL - (unsigned long int)value : (unsigned long int)value;
+    const unsigned long int frac = fracBits ? (magnitude << (32 - fracBits)) & 0xFFFFFFFFUL : 0;
+
+    return format_decimal(buf, negative, magnitude >> fracBits, frac, 0, precision, width);
+}
+
+
+void MatrixMulQ15(const int* mtx1, const int* mtx2, long int* mtxRslt, unsigned int size)
+/* multiplies two size x size Q15 matrices (row-major) into a Q31 matrix; each result
+ * element is the dot product of a row of mtx1 and a column of mtx2, saturated to the
+ * Q31 range
+ */
+{
+    unsigned int row, col, temp;
+    const int* rowPtr;
+    const int* colPtr;
+
+#if defined(__MSP430_HAS_MPY32__)
+    const unsigned int mpyCtl = MPY32CTL0;
+    unsigned int resLo, resHi;
+
+    // results read shifted to Q31 and clipped; operand writes wait for the running MAC
+    MPY32CTL0 = mpyCtl | MPYFRAC | MPYSAT | MPYDLYWRTEN;
+
+    for (row = 0; row < size; row++)
+    {
+        for (col = 0; col < size; col++)
+        {
+            rowPtr = &mtx1[row * size];
+            colPtr = &mtx2[col];
+
+            RESLO = 0;                  // the MACS chain accumulates into RESHI:RESLO
+            RESHI = 0;
+            for (temp = 0; temp < size; temp++, colPtr += size)
             {
-                printf("[");
+                MACS = *rowPtr++;
+                OP2 = *colPtr;          // starts the multiply-accumulate
             }
+            __delay_cycles(MPY32_SETTLE);
 
-            printf("%10f, ", mtx[row][col]); // prints every element in the inputted matrix
+            resLo = RESLO;
+            resHi = RESHI;
+            mtxRslt[row * size + col] = (long int)(signed short)resHi * 65536L + resLo;
         }
+    }
+
+    MPY32CTL0 = mpyCtl;
+#else
+    long long int sum;
+
+    for (row = 0; row < size; row++)
+    {
+        for (col = 0; col < size; col++)
+        {
+            rowPtr = &mtx1[row * size];
+            colPtr = &mtx2[col];
 
-        printf("]\n"); // adds a ending bracket and new line character after each
-    }                  //   row finishes printing to console
+            sum = 0;                    // Q30 products
+            for (temp = 0; temp < size; temp++, colPtr += size)
+            {
+                sum += (long int)*rowPtr++ * *colPtr;
+            }
+
+            sum *= 2;                   // Q31
+            if (sum > 2147483647LL)
+            {
+                sum = 2147483647LL;
+            }
+            else if (sum < -2147483647LL - 1)
+            {
+                sum = -2147483647LL - 1;
+            }
+            mtxRslt[row * size + col] = (long int)sum;
+        }
+    }
+#endif
 
     return;
 }
 
+
+int FloatToQ15(float value)
+/* converts a number in [-1, 1) to Q15, saturating outside it
+ */
+{
+    if (value >= 32767.0f / 32768.0f)
+    {
+        return 32767;
+    }
+    if (value <= -1.0f)
+    {
+        return -32768;
+    }
+
+    return (int)(value * 32768.0f);
+}
+
+
+float Q31ToFloat(long int value)
+/* converts a Q31 number to float
+ */
+{
+    return (float)value / 2147483648.0f;
+}
+
+
+MatrixKind MatrixClassify(const float mtx[SIZE][SIZE], unsigned char info[SIZE])
+/* finds the structure of a matrix in at most a few passes over it: info[row] gets the
+ * column of the 1.0 of each row for a permutation, info[0] the shift of a circulant
+ */
+{
+    unsigned short int row, col, shift;
+    unsigned short int ones, used;
+    char diagonal = 1, identity = 1, permutation = 1;
+
+    // Diagonal / identity
+    for (row = 0; row < SIZE && diagonal; row++)
+    {
+        for (col = 0; col < SIZE; col++)
+        {
+            if (row != col && mtx[row][col] != 0.0f)
+            {
+                diagonal = 0;
+                break;
+            }
+        }
+        identity = identity && mtx[row][row] == 1.0f;
+    }
+    if (diagonal)
+    {
+        return identity ? MATRIX_IDENTITY : MATRIX_DIAGONAL;
+    }
+
+    // Permutation: one 1.0 per row, no column used twice
+    for (row = 0, used = 0; row < SIZE && permutation; row++)
+    {
+        for (col = 0, ones = 0; col < SIZE; col++)
+        {
+            if (mtx[row][col] == 1.0f)
+            {
+                ones++;
+                info[row] = (unsigned char)col;
+            }
+            else if (mtx[row][col] != 0.0f)
+            {
+                ones = 2;
+            }
+        }
+        if (ones != 1)
+        {
+            permutation = 0;                        // info[row] is not a column here
+        }
+        else
+        {
+            permutation = !(used & (1u << info[row]));
+            used |= 1u << info[row];
+        }
+    }
+    if (permutation)
+    {
+        return MATRIX_PERMUTATION;
+    }
+
+    // Circulant: the shift that turns row 0 into row 1 must turn every row into the next
+    for (shift = 0; shift < SIZE; shift++)
+    {
+        for (col = 0; col < SIZE && mtx[1][(col + shift) % SIZE] == mtx[0][col]; col++)
+        {
+        }
+        if (col == SIZE)
+        {
+            break;
+        }
+    }
+    if (shift == SIZE)
+    {
+        return MATRIX_DENSE;
+    }
+    for (row = 2; row < SIZE; row++)
+    {
+        for (col = 0; col < SIZE; col++)
+        {
+            if (mtx[row][(col + shift) % SIZE] != mtx[row - 1][col])
+            {
+                return MATRIX_DENSE;
+            }
+        }
+    }
+    info[0] = (unsigned char)shift;
+
+    return MATRIX_CIRCULANT;
+}
+
+
+MatrixKind MatrixMulAuto(const float mtx1[SIZE][SIZE], const float mtx2[SIZE][SIZE], float mtxRslt[SIZE][SIZE])
+/* multiplies two matrices with the kernel their structure allows and returns the kernel
+ * used; only products with no usable structure take the SIZE^3 multiply-adds of MatrixMul
+ */
+{
+    unsigned char info1[SIZE], info2[SIZE];
+    MatrixKind kind1 = MatrixClassify(mtx1, info1);
+    MatrixKind kind2 = MatrixClassify(mtx2, info2);
+    unsigned short int row, col, temp, shift;
+    float first[SIZE];
+
+    if (kind1 == MATRIX_IDENTITY || kind2 == MATRIX_IDENTITY)      // copy of the other one
+    {
+        for (row = 0; row < SIZE; row++)
+        {
+            for (col = 0; col < SIZE; col++)
+            {
+                mtxRslt[row][col] = kind1 == MATRIX_IDENTITY ? mtx2[row][col] : mtx1[row][col];
+            }
+        }
+        return MATRIX_IDENTITY;
+    }
+
+    if (kind1 == MATRIX_PERMUTATION)    // row 'row' of the result is row info1[row] of mtx2
+    {
+        for (row = 0; row < SIZE; row++)
+        {
+            for (col = 0; col < SIZE; col++)
+            {
+                mtxRslt[row][col] = mtx2[info1[row]][col];
+            }
+        }
+        return MATRIX_PERMUTATION;
+    }
+
+    if (kind2 == MATRIX_PERMUTATION)    // column temp of mtx1 moves to column info2[temp]
+    {
+        for (row = 0; row < SIZE; row++)
+        {
+            for (temp = 0; temp < SIZE; temp++)
+            {
+                mtxRslt[row][info2[temp]] = mtx1[row][temp];
+            }
+        }
+        return MATRIX_PERMUTATION;
+    }
+
+    if (kind1 == MATRIX_DIAGONAL || kind2 == MATRIX_DIAGONAL)      // rows or columns scaled
+    {
+        for (row = 0; row < SIZE; row++)
+        {
+            for (col = 0; col < SIZE; col++)
+            {
+                mtxRslt[row][col] = kind1 == MATRIX_DIAGONAL ? mtx1[row][row] * mtx2[row][col]
+                                                             : mtx1[row][col] * mtx2[col][col];
+            }
+        }
+        return MATRIX_DIAGONAL;
+    }
+
+    if (kind1 == MATRIX_CIRCULANT && kind2 == MATRIX_CIRCULANT)
+    {
+        // with mtx1 rows rotating by s1 and mtx2 rows by s2, row 'row' of the product is
+        // its row 0 rotated right by row * s1 * s2: one row of SIZE^2 multiply-adds
+        for (col = 0; col < SIZE; col++)
+        {
+            first[col] = 0;
+            for (temp = 0; temp < SIZE; temp++)
+            {
+                first[col] += mtx1[0][temp] * mtx2[temp][col];
+            }
+        }
+
+        shift = (unsigned short int)((info1[0] * info2[0]) % SIZE);
+        for (row = 0; row < SIZE; row++)
+        {
+            for (col = 0; col < SIZE; col++)
+            {
+                mtxRslt[row][(col + row * shift) % SIZE] = first[col];
+            }
+        }
+        return MATRIX_CIRCULANT;
+    }
+
+    MatrixMul(mtx1, mtx2, mtxRslt);
+
+    return MATRIX_DENSE;
+}
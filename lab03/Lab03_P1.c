@@ -12,6 +12,20 @@
  * Output:      LEDs: LED1 (P1.0) and LED2 (P4.7) on MSP430 micro-controller
  * Author(s):   Polickoski, Nick
  * Date:        September 2, 2023
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. Blink engine: N channels, each an LED with its own rate and
+ *                  phase, toggled by one Timer_A CCR0 interrupt that is re-armed
+ *                  for the earliest next toggle (BlinkInit/BlinkStart/BlinkStop)
+ *              2. Timer_A counts ACLK (32768 Hz), so the rates do not depend on
+ *                  the DCO; a remainder carried per channel keeps rates that do
+ *                  not divide 16384 ticks exact on average
+ *              3. The CPU sits in LPM3 between events: the switches wake it with
+ *                  port interrupts on either edge, the ~20ms debounce is a CCR1
+ *                  sleep (BlinkSleep) instead of a counting loop
  *----------------------------------------------------------------------------*/
 
 //// Preprocessor Directives
@@ -26,6 +40,31 @@
 #define S1 BIT1     // 0x01
 #define S2 BIT1     // 0x01
 
+#define SWITCH1     0x01                // ReadSwitches() bits, set while pressed
+#define SWITCH2     0x02
+
+#define ACLK_HZ         32768           // Timer_A clock: REFO/XT1, independent of the DCO
+#define BLINK_CHANNELS  2               // LEDs blinking at once
+#define BLINK_HZ_MAX    1000            // fastest blink: 16 ticks between toggles
+#define BLINK_LEAD      2               // ticks from now a toggle may be scheduled at the earliest
+#define DEBOUNCE_TICKS  655             // ~20ms of ACLK
+
+// Type Definitions
+typedef struct
+{
+    unsigned char port;                 // PxOUT of the LED (1..8), 0: channel stopped
+    unsigned char mask;                 // LED bit(s) in PxOUT
+    unsigned int hz;                    // blink rate: hz on/off periods per second
+    unsigned int step;                  // ticks between toggles: (ACLK_HZ / 2) / hz ...
+    unsigned int rem;                   // ... and its remainder, carried in err
+    unsigned int err;
+    unsigned int next;                  // TA0R of the next toggle (ticks compare as 16-bit
+                                        // differences, (short)(a - b), so they wrap with TA0R)
+} BlinkChannel;
+
+// Global Variables
+static volatile BlinkChannel blink[BLINK_CHANNELS];
+
 
 
 //// Function Prototypes
@@ -38,6 +77,36 @@ void FirstSwitch();
 void SecondSwitch();
 /* function for when only the second switch is activated
  */
+void NoSwitch();
+/* function for when no switch is activated (initial condition)
+ */
+unsigned char ReadSwitches();
+/* SWITCH1 | SWITCH2 bits of the switches pressed now
+ */
+void WaitForSwitch(unsigned char);
+/* LPM3 until a switch leaves the given ReadSwitches() state (returns at once if
+ * it already did): arms each switch's port interrupt on the edge away from its
+ * current level
+ */
+
+void BlinkInit();
+/* starts Timer_A 0 counting ACLK continuously, all channels stopped
+ */
+unsigned int BlinkNow();
+/* the current tick (TA0R), to place BlinkStart() toggles relative to it
+ */
+int BlinkStart(unsigned char, unsigned char, unsigned char, unsigned int, unsigned int);
+/* channel ch toggles 'mask' of port P<port>OUT hz times a second on and off,
+ * first at tick 'at' (BlinkNow() + phase, less than 32768 ticks ahead; channels
+ * given the same 'at' and rate toggle together). Returns 1 for a bad channel,
+ * port or rate (1 to BLINK_HZ_MAX), 0 when started
+ */
+void BlinkStop(unsigned char);
+/* channel ch stops toggling; its LED keeps the state it has
+ */
+void BlinkSleep(unsigned int);
+/* LPM3 for the given number of ticks (1 to 32767), blinking continues
+ */
 
 
 
@@ -53,11 +122,13 @@ int main(void)
     P2DIR &= ~S1;           // telling board to look for INPUT signal from S1 location (P2.1)
     P2REN |= S1;            // resistor for high V for S1 (P2.1)
     P2OUT |= S1;            // proper I/O for S1 (P2.1)
+    P2IE  |= S1;            // S1 wakes the CPU (edge set in WaitForSwitch())
 
     // Switch #2
     P1DIR &= ~S2;           // telling board to look for INPUT from S1 (P1.1)
     P1REN |= S2;            // resistor for high V for S2 (P1.1)
     P1OUT |= S2;            // proper I/O for S1 (P2.1)
+    P1IE  |= S2;            // S2 wakes the CPU
 
     // LED #1
     P1DIR |= LED1;          // telling board to look for OUTPUT from LED1 (P1.0)
@@ -67,30 +138,43 @@ int main(void)
     P4DIR |= LED2;          // telling board to look for OUTPUT signal from LED2 location (P4.7)
     P4OUT &= ~LED2;         // LED2 = OFF
 
+    BlinkInit();
+    __enable_interrupt();
+
 
     /// Switch Detection
+    unsigned char shown = 0;                                    // switches the LEDs show: none
     while (1)
     {
+        WaitForSwitch(shown);                                   // LPM3 until a switch changes
+        BlinkSleep(DEBOUNCE_TICKS);                             // ~20ms debounce
+
+        const unsigned char now = ReadSwitches();               // check again after debouncing
+        if (now == shown)
+        {
+            continue;                                           // bounce
+        }
+        shown = now;
+
         // S1 & S2 activation
-        if ( ((P2IN & S1) == 0) && ((P1IN & S2) == 0) )         // logical AND, not bitwise
+        if (now == (SWITCH1 | SWITCH2))
         {
             BothSwitches();                                     // Function Call: BothSwitches()
         }
         // If ONLY S1 is activated
-        else if ( ((P2IN & S1) == 0) && ((P1IN & S2) != 0) )
+        else if (now == SWITCH1)
         {
             FirstSwitch();                                      // Function Call: FirstSwitch()
         }
         // If ONLY S2 is activated
-        else if ( ((P2IN & S1) != 0) && ((P1IN & S2) == 0) )
+        else if (now == SWITCH2)
         {
             SecondSwitch();                                     // Function Call: SecondSwitch()
         }
         // Initial Condition if NO switch activation
         else
         {
-            P1OUT |= LED1;                                      // LED1 = ON
-            P4OUT &= ~LED2;                                     // LED2 = OFF
+            NoSwitch();                                         // Function Call: NoSwitch()
         }
     }
 
@@ -104,23 +188,15 @@ void BothSwitches()
 /* upon activation of both switches, both LEDs blink at 5Hz
  */
 {
-    unsigned int i;
-    for (i = 2000; i > 0; i--);                             // ~20ms debounce
+    BlinkStop(0);
+    BlinkStop(1);
 
-    if ( ((P2IN & S1) == 0) && ((P1IN & S2) == 0) )         // check again if switch 1 still activated between debouncing
-    {
-        P1OUT |= LED1;                                      // initally turn both on so both in synch
-        P4OUT |= LED2;                                      //
+    P1OUT |= LED1;                                          // initally turn both on so both in synch
+    P4OUT |= LED2;                                          //
 
-        while ( ((P2IN & S1) == 0) && ((P1IN & S2) == 0) )
-        {
-            unsigned int j;
-            for (j = 0; j < 10000; j++);                    // 5Hz LED blinking (5Hz -> T = 1/(5) * 1/2 = 1/10s per toggle)
-
-            P1OUT ^= LED1;                                  // LED1 blinking toggle
-            P4OUT ^= LED2;                                  // LED2 blinking toggle
-        }
-    }
+    const unsigned int at = BlinkNow() + (ACLK_HZ / 2) / 5; // one half period on, same tick for both
+    BlinkStart(0, 1, LED1, 5, at);                          // 5Hz LED blinking (5Hz -> T = 1/(5) * 1/2 = 1/10s per toggle)
+    BlinkStart(1, 4, LED2, 5, at);
 
     return;
 }
@@ -130,46 +206,291 @@ void FirstSwitch()
 /* upon activation of only the first switch, LED1 turns off and LED2 blinks at 7Hz
  */
 {
-    unsigned int i;
-    for (i = 2000; i > 0; i--);                             // ~20ms debounce
+    BlinkStop(0);
+    BlinkStop(1);
+
+    P1OUT &= ~LED1;                                         // LED1 = OFF
+    BlinkStart(1, 4, LED2, 7, BlinkNow() + (ACLK_HZ / 2) / 7);     // 7Hz LED2 blinking (7Hz -> T = 1/(7) * 1/2 = 1/14s per toggle)
+
+    return;
+}
+
+
+void SecondSwitch()
+/* upon activation of only the second switch, LED2 turns on and LED1 blinks at 2Hz
+ */
+{
+    BlinkStop(0);
+    BlinkStop(1);
+
+    P4OUT |= LED2;                                          // LED2 = ON
+    BlinkStart(0, 1, LED1, 2, BlinkNow() + (ACLK_HZ / 2) / 2);     // 2Hz LED1 blinking (2Hz -> T = 1/(2) * 1/2 = 1/4s per toggle)
+
+    return;
+}
+
+
+void NoSwitch()
+/* with no switch activated, LED1 is on and LED2 off
+ */
+{
+    BlinkStop(0);
+    BlinkStop(1);
+
+    P1OUT |= LED1;                                          // LED1 = ON
+    P4OUT &= ~LED2;                                         // LED2 = OFF
 
-    if ( ((P2IN & S1) == 0) && ((P1IN & S2) != 0) )         // check again if switch 1 still activated between debouncing
+    return;
+}
+
+
+unsigned char ReadSwitches()
+{
+    unsigned char pressed = 0;
+    if ((P2IN & S1) == 0)
+    {
+        pressed |= SWITCH1;
+    }
+    if ((P1IN & S2) == 0)
     {
-        P1OUT &= ~LED1;                                     // LED1 = OFF
+        pressed |= SWITCH2;
+    }
+    return pressed;
+}
 
-        while ( ((P2IN & S1) == 0) && ((P1IN & S2) != 0) )
-        {
-            unsigned int j;
-            for (j = 0; j < 7412; j++);                     // 7Hz LED2 blinking (7Hz -> T = 1/(7) * 1/2 = 1/14s per toggle)
 
-            P4OUT ^= LED2;                                  // LED2 blinking toggle
-        }
+void WaitForSwitch(unsigned char state)
+{
+    __disable_interrupt();
+
+    if (state & SWITCH1)                                    // pressed: wake on release (low to high)
+    {
+        P2IES &= ~S1;
+    }
+    else                                                    // released: wake on press (high to low)
+    {
+        P2IES |= S1;
+    }
+    if (state & SWITCH2)
+    {
+        P1IES &= ~S2;
+    }
+    else
+    {
+        P1IES |= S2;
     }
+    P2IFG &= ~S1;                                           // changing IES may set the flag
+    P1IFG &= ~S2;
 
+    if (ReadSwitches() == state)                            // no edge missed while arming
+    {
+        __bis_SR_register(LPM3_bits + GIE);                 // a port interrupt ends it
+    }
+
+    __enable_interrupt();
     return;
 }
 
 
-void SecondSwitch()
-/* upon activation of only the second switch, LED2 turns on and LED1 blinks at 2Hz
+static void port_toggle(unsigned char port, unsigned char mask)
+/* PxOUT ^= mask for port x
  */
 {
-    unsigned int i;
-    for (i = 2000; i > 0; i--);                             // ~20ms debounce
+    switch (port)
+    {
+    case 1: P1OUT ^= mask; break;
+    case 2: P2OUT ^= mask; break;
+    case 3: P3OUT ^= mask; break;
+    case 4: P4OUT ^= mask; break;
+    case 5: P5OUT ^= mask; break;
+    case 6: P6OUT ^= mask; break;
+    case 7: P7OUT ^= mask; break;
+    case 8: P8OUT ^= mask; break;
+    default: break;
+    }
+}
+
 
-    if ( ((P2IN & S1) != 0) && ((P1IN & S2) == 0) )         // check again if switch 2 still activated between debouncing
+static void blink_advance(volatile BlinkChannel* c)
+/* next toggle of c: step ticks, one more whenever the carried remainder reaches
+ * a whole tick (hz remainders), so hz toggle pairs take exactly ACLK_HZ ticks
+ */
+{
+    c->next += c->step;
+    c->err += c->rem;
+    if (c->err >= c->hz)
+    {
+        c->err -= c->hz;
+        c->next++;
+    }
+}
+
+
+void BlinkInit()
+{
+    unsigned char ch;
+    for (ch = 0; ch < BLINK_CHANNELS; ch++)
     {
-        P4OUT|= LED2;                                       // LED2 = ON
+        blink[ch].port = 0;
+    }
+
+    TA0CCTL0 = 0;                                           // no toggles scheduled
+    TA0CCTL1 = 0;                                           // no sleep
+    TA0CTL = TASSEL_1 | MC_2 | TACLR;                       // ACLK, continuous mode
 
-        while ( ((P2IN & S1) != 0) && ((P1IN & S2) == 0) )
+    return;
+}
+
+
+unsigned int BlinkNow()
+{
+    return TA0R;
+}
+
+
+int BlinkStart(unsigned char ch, unsigned char port, unsigned char mask, unsigned int hz, unsigned int at)
+{
+    if (ch >= BLINK_CHANNELS || port < 1 || port > 8 || hz < 1 || hz > BLINK_HZ_MAX)
+    {
+        return 1;
+    }
+
+    __disable_interrupt();
+
+    volatile BlinkChannel* c = &blink[ch];
+    const unsigned int now = TA0R;
+    if ((short)(at - now) < BLINK_LEAD)                     // too close (or past) to catch with CCR0
+    {
+        at = now + BLINK_LEAD;
+    }
+
+    c->mask = mask;
+    c->hz = hz;
+    c->step = (ACLK_HZ / 2) / hz;
+    c->rem = (ACLK_HZ / 2) % hz;
+    c->err = 0;
+    c->next = at;
+    c->port = port;
+
+    if (!(TA0CCTL0 & CCIE) || (short)(at - TA0CCR0) < 0)    // earlier than the toggle scheduled
+    {
+        TA0CCR0 = at;
+    }
+    TA0CCTL0 |= CCIE;                                       // keeps a pending CCIFG
+
+    __enable_interrupt();
+    return 0;
+}
+
+
+void BlinkStop(unsigned char ch)
+{
+    if (ch < BLINK_CHANNELS)
+    {
+        blink[ch].port = 0;                                 // the ISR skips it (and idles with none left)
+    }
+
+    return;
+}
+
+
+void BlinkSleep(unsigned int ticks)
+{
+    __disable_interrupt();
+
+    TA0CCR1 = TA0R + ticks;
+    TA0CCTL1 = CCIE;                                        // SleepTimerISR() clears it
+    while (TA0CCTL1 & CCIE)
+    {
+        __bis_SR_register(LPM3_bits + GIE);
+        __disable_interrupt();
+    }
+
+    __enable_interrupt();
+    return;
+}
+
+
+
+//// Interrupts Definitions
+// Blink Engine (CCR0)
+#pragma vector = TIMER0_A0_VECTOR
+__interrupt void BlinkTimerISR(void)
+{
+    unsigned int now = TA0CCR0;                             // tick of this event
+    unsigned int wait;
+    unsigned char ch, running;
+
+    do
+    {
+        wait = 0xFFFF;
+        running = 0;
+        for (ch = 0; ch < BLINK_CHANNELS; ch++)
         {
-            unsigned int j;
-            for (j = 0; j < 25000; j++);                    // 2Hz LED1 blinking (2Hz -> T = 1/(2) * 1/2 = 1/4s per toggle)
+            volatile BlinkChannel* c = &blink[ch];
+            if (c->port == 0)
+            {
+                continue;
+            }
+            running = 1;
+
+            if ((short)(c->next - now) <= 0)                // due
+            {
+                port_toggle(c->port, c->mask);
+                blink_advance(c);
+            }
+            if ((unsigned short)(c->next - now) < wait)
+            {
+                wait = (unsigned short)(c->next - now);
+            }
+        }
 
-            P1OUT ^= LED1;                                  // LED1 blinking toggle
+        if (!running)
+        {
+            TA0CCTL0 &= ~CCIE;                              // idle until BlinkStart()
+            return;
         }
-    }
+        now += wait;
+    } while ((short)(now - TA0R) <= 0);                     // the next toggle passed while toggling
 
+    if ((short)(now - TA0R) < BLINK_LEAD)                   // too close to catch with CCR0, as in BlinkStart()
+    {
+        now = TA0R + BLINK_LEAD;
+    }
+    TA0CCR0 = now;
     return;
 }
 
+
+// Sleep Timer (CCR1)
+#pragma vector = TIMER0_A1_VECTOR
+__interrupt void SleepTimerISR(void)
+{
+    switch (__even_in_range(TA0IV, TA0IV_TAIFG))
+    {
+    case TA0IV_TACCR1:
+        TA0CCTL1 &= ~CCIE;                                  // sleep over
+        LPM3_EXIT;
+        break;
+    default:
+        break;
+    }
+}
+
+
+// Switch #1 (P2.1)
+#pragma vector = PORT2_VECTOR
+__interrupt void Switch1ISR(void)
+{
+    P2IFG &= ~S1;                                           // clear interrupt P2.1 flag
+    LPM3_EXIT;                                              // main() debounces and reads the switches
+}
+
+
+// Switch #2 (P1.1)
+#pragma vector = PORT1_VECTOR
+__interrupt void Switch2ISR(void)
+{
+    P1IFG &= ~S2;                                           // clear interrupt P1.1 flag
+    LPM3_EXIT;
+}
@@ -0,0 +1,83 @@
+;------------------------------------------------------------------------------
+; Initial Build::
+; Sub File:   	AlnumFilter.asm
+; Function:		Table-driven version of the lab04 string filter: copies the
+;				alphanumeric bytes of a buffer and counts the rest
+;
+; Description:		charClass holds one class byte per character code (CC_x bits
+;				below, 0 for NUL), so classifying a byte is one indexed load and
+;				one test instead of a chain of compares. main.asm uses the table
+;				for myStr; AlnumFilter is the C-callable version for buffers of
+;				any length (NUL bytes count as special characters):
+;
+;					unsigned int AlnumFilter(const char* src, unsigned int length, char* dst);
+;
+;				dst gets the alphanumerics and a NUL (length + 1 bytes at most),
+;				the return value is the number of bytes left out
+;
+; Input:		R12 = src, R13 = length, R14 = dst
+; Output:		R12 = special character count, dst string
+; Author(s):   	Polickoski, Nick
+; Date:        	October 17, 2026
+;----------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    AlnumFilter             ; C-callable filter
+            .def    charClass               ; class of every character code
+
+CC_DIGIT	.equ	01h						; '0'..'9'
+CC_UPPER	.equ	02h						; 'A'..'Z'
+CC_LOWER	.equ	04h						; 'a'..'z'
+CC_ALNUM	.equ	08h						; any of the three (#8: constant generator)
+CC_SPECIAL	.equ	10h						; everything else but NUL
+
+;-------------------------------------------------------------------------------
+            .sect   ".const"                ; Class table in FLASH
+;-------------------------------------------------------------------------------
+charClass:									; 10h special, 09h digit, 0Ah upper, 0Ch lower
+			.byte	00h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; 00h..0Fh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; 10h..1Fh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; 20h..2Fh
+			.byte	09h,09h,09h,09h,09h,09h,09h,09h,09h,09h,10h,10h,10h,10h,10h,10h	; 30h..3Fh
+			.byte	10h,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah	; 40h..4Fh
+			.byte	0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,0Ah,10h,10h,10h,10h,10h	; 50h..5Fh
+			.byte	10h,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch	; 60h..6Fh
+			.byte	0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,0Ch,10h,10h,10h,10h,10h	; 70h..7Fh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; 80h..8Fh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; 90h..9Fh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; A0h..AFh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; B0h..BFh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; C0h..CFh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; D0h..DFh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; E0h..EFh
+			.byte	10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h,10h	; F0h..FFh
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutine
+;-------------------------------------------------------------------------------
+AlnumFilter:
+			mov.w	R13,	R11				; bytes left
+			clr.w	R13						; specCount = 0
+			tst.w	R11
+			jz		filterEnd
+
+filterLoop	mov.b	@R12+,	R15				; next byte
+			bit.b	#CC_ALNUM,	charClass(R15)	; one table load and test
+			jz		filterSpec
+			mov.b	R15,	0(R14)			; keep it
+			inc.w	R14
+			dec.w	R11
+			jnz		filterLoop
+			jmp		filterEnd
+
+filterSpec	inc.w	R13						; specCount++
+			dec.w	R11
+			jnz		filterLoop
+
+filterEnd	clr.b	0(R14)					; terminate dst
+			mov.w	R13,	R12				; return specCount
+			ret
+			.end
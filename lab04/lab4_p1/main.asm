@@ -15,12 +15,23 @@
 ; Output:		int number to P4OUT register of non-alphanumeric characters
 ; Author(s):   	Polickoski, Nick
 ; Date:        	September 6, 2023
+;
+;
+; Revisions::
+; Author:      	Polickoski, Nick
+; Date:        	October 17, 2026
+; Changes:		1. Characters are classified with the charClass table (one
+;				indexed load and test per byte, AlnumFilter.asm) instead of a
+;				chain of up to six compares
 ;----------------------------------------------------------------------------*/
             .cdecls C,LIST,"msp430.h"       ; Include device header file
             
 ;-------------------------------------------------------------------------------
             .def    RESET                   ; Export program entry-point to
                                             ; make it known to linker.
+            .ref    charClass               ; character classes (AlnumFilter.asm)
+
+CC_ALNUM	.equ	08h						; charClass bit of '0'..'9', 'A'..'Z', 'a'..'z'
 ;-------------------------------------------------------------------------------
 			.data
 myStr		.cstring "Welcome To MSP430 Assembly:)!"
@@ -49,27 +60,14 @@ main		mov.w 	#myStr,		R4	; pointer to first 2 bytes in myStr
 
 ; Conditional For-Loop
 for			mov.b 	@R4+, 		R7	; move each new byte section into R7
-			cmp.b 	#0, 		R7  ; while (myStr[i] != NULL)
-			jeq		loopEnd
-
-			; Conditional Checks for Special Characters (check ASCII charts)
-			cmp.b 	#30h, 		R7	; if myStr[i] < 0x30
-			jl 		isSpec
-
-			cmp.b 	#7Bh,		R7  ; if myStr[i] >= 0x7B
-			jge		isSpec
-
-			cmp.b	#3Ah,		R7	; if myStr[i] < 0x3A
-			jl		validChar
+			bit.b	#CC_ALNUM,	charClass(R7)	; alphanumeric? (table lookup)
+			jnz		validChar
 
-			cmp.b	#41h,		R7	; if myStr[i] < 0x41
-			jl 		isSpec
+			tst.b	R7				; while (myStr[i] != NULL)
+			jz		loopEnd
 
-			cmp.b 	#5Bh,		R7	; if myStr[i] < 0x5B
-			jl		validChar
-
-			cmp.b	#61h, 		R7	; if myStr[i] < 0x61
-			jl		isSpec
+isSpec		inc.b	R6				; specCount++
+			jmp 	for				; continue to next iteratoon of for-loop
 
 
 ;Adding Characters to newStr
@@ -87,9 +85,6 @@ upperByte	inc.b	R8				; increments byte flag to 1
 			incd.w	R5				; increment next word of newStr
 			jmp		for
 
-isSpec		inc.b	R6				; specCount++
-			jmp 	for				; continue to next iteratoon of for-loop
-
 
 ; End of Loop and Printing
 loopEnd		mov.b 	R7,		0(R5)	; add NULL character to newStr
@@ -0,0 +1,261 @@
+;------------------------------------------------------------------------------
+; Initial Build::
+; Sub File:   	Evaluate.asm
+; Function:		Shunting-yard evaluator for signed integer expressions
+;
+; Description:		Evaluates a line such as "-12*(7+30)/4" in one pass: numbers
+;				of any number of digits go on a value stack, operators on an
+;				operator stack, and an operator is applied when one of no
+;				higher precedence follows it. + - * / and parentheses, with
+;				unary minus (and plus) before any operand. * runs on the MPY32
+;				(MPYS, RESLO), / is a shift-subtract divide that truncates toward
+;				zero as C does. Arithmetic is 16-bit int and wraps. Blanks are
+;				skipped, and the line ends at length or at the first NUL, CR or
+;				LF, so a UART RX line buffer is passed as it is, without copying
+;				or terminating it. C prototype (status codes in evaluate.h):
+;
+;					unsigned int Evaluate(const char* line, unsigned int length, int* value);
+;
+;				Both stacks live in a frame on the system stack (EVAL_STACK
+;				entries each, the operator stack's bottom is a sentinel). An
+;				operator entry holds its precedence in the high byte and its
+;				character in the low byte, so "apply while the top binds at
+;				least as tightly" is one word compare against the precedence:
+;
+;					0000h sentinel, 0028h '(', 012Bh '+', 012Dh '-',
+;					022Ah '*', 022Fh '/', 0300h unary minus
+;
+; Input:		R12 = line, R13 = length, R14 = value
+; Output:		R12 = EVAL_OK (*value written) or an error code
+; Author(s):   	Polickoski, Nick
+; Date:        	October 17, 2026
+;----------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    Evaluate                ; C-callable evaluator
+
+EVAL_OK		.equ	0
+EVAL_SYNTAX	.equ	1						; misplaced token, unbalanced parenthesis
+EVAL_DIV0	.equ	2						; division by zero
+EVAL_DEPTH	.equ	3						; operator stack full
+
+EVAL_STACK	.equ	16						; entries per stack
+EVAL_FRAME	.equ	4*EVAL_STACK			; value stack, then operator stack
+
+OP_ADD		.equ	012Bh
+OP_SUB		.equ	012Dh
+OP_MUL		.equ	022Ah
+OP_DIV		.equ	022Fh
+OP_NEG		.equ	0300h
+OP_OPEN		.equ	0028h
+PREC_ADD	.equ	0100h					; lowest binary precedence
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutine
+;-------------------------------------------------------------------------------
+; R4 = value stack top (next free), R5 = operator stack top (next free),
+; R6 = number, R7 = character / operator, R8 = 1 after an operand,
+; R10 = operator stack end, R12 = line, R13 = line end
+Evaluate:
+			pushm.w	#7,		R10				; R4..R10
+			push.w	R14						; value
+			sub.w	#EVAL_FRAME, SP
+
+			mov.w	SP,		R4
+			mov.w	SP,		R5
+			add.w	#2*EVAL_STACK, R5
+			mov.w	R5,		R10
+			add.w	#2*EVAL_STACK, R10
+			clr.w	0(R5)					; sentinel
+			incd.w	R5
+			add.w	R12,	R13
+			clr.w	R8
+
+evalNext	cmp.w	R13,	R12				; end of the buffer
+			jhs		evalEnd
+			mov.b	@R12+,	R7
+			cmp.b	#' ',	R7
+			jeq		evalNext
+			tst.b	R7						; end of the line
+			jz		evalEnd
+			cmp.b	#0Dh,	R7
+			jeq		evalEnd
+			cmp.b	#0Ah,	R7
+			jeq		evalEnd
+			tst.w	R8
+			jnz		evalOperator
+
+; Operand expected: number, '(', unary sign
+			mov.w	R7,		R6
+			sub.w	#'0',	R6
+			cmp.w	#10,	R6
+			jlo		evalDigits
+			cmp.b	#'+',	R7				; unary plus: nothing to do
+			jeq		evalNext
+			mov.w	#OP_NEG, R6
+			cmp.b	#'-',	R7
+			jeq		evalPrefix
+			mov.w	#OP_OPEN, R6
+			cmp.b	#'(',	R7
+			jne		evalSyntax
+evalPrefix	mov.w	R6,		R7				; pushed without applying anything
+			jmp		evalPush
+
+evalDigits	cmp.w	R13,	R12
+			jhs		evalNumber
+			mov.b	@R12,	R15
+			sub.w	#'0',	R15
+			cmp.w	#10,	R15
+			jhs		evalNumber
+			inc.w	R12
+			rla.w	R6						; number * 10 + digit
+			mov.w	R6,		R11
+			rla.w	R6
+			rla.w	R6
+			add.w	R11,	R6
+			add.w	R15,	R6
+			jmp		evalDigits
+
+evalNumber	mov.w	R6,		0(R4)
+			incd.w	R4
+			mov.w	#1,		R8
+			jmp		evalNext
+
+; Operator expected: binary operator, ')'
+evalOperator
+			cmp.b	#')',	R7
+			jeq		evalClose
+			mov.w	#OP_ADD, R6
+			cmp.b	#'+',	R7
+			jeq		evalBinary
+			mov.w	#OP_SUB, R6
+			cmp.b	#'-',	R7
+			jeq		evalBinary
+			mov.w	#OP_MUL, R6
+			cmp.b	#'*',	R7
+			jeq		evalBinary
+			mov.w	#OP_DIV, R6
+			cmp.b	#'/',	R7
+			jne		evalSyntax
+
+evalBinary	mov.w	R6,		R7
+			mov.w	R6,		R11
+			and.w	#0FF00h, R11			; apply what binds at least as tightly
+			call	#evalReduce
+			tst.w	R15
+			jnz		evalFail
+
+evalPush	cmp.w	R10,	R5
+			jhs		evalFull
+			mov.w	R7,		0(R5)
+			incd.w	R5
+			clr.w	R8
+			jmp		evalNext
+
+evalClose	mov.w	#PREC_ADD, R11
+			call	#evalReduce
+			tst.w	R15
+			jnz		evalFail
+			cmp.w	#OP_OPEN, -2(R5)		; sentinel: no '(' to match
+			jne		evalSyntax
+			decd.w	R5
+			mov.w	#1,		R8
+			jmp		evalNext
+
+; End of the line: apply the rest, one value must be left
+evalEnd		tst.w	R8						; empty, or ends in an operator
+			jz		evalSyntax
+			mov.w	#PREC_ADD, R11
+			call	#evalReduce
+			tst.w	R15
+			jnz		evalFail
+			tst.w	-2(R5)					; '(' left open
+			jnz		evalSyntax
+			mov.w	EVAL_FRAME(SP), R14
+			mov.w	-2(R4),	0(R14)
+			mov.w	#EVAL_OK, R12
+			jmp		evalExit
+
+evalSyntax	mov.w	#EVAL_SYNTAX, R12
+			jmp		evalExit
+evalFull	mov.w	#EVAL_DEPTH, R12
+			jmp		evalExit
+evalFail	mov.w	R15,	R12
+
+evalExit	add.w	#EVAL_FRAME+2, SP		; frame and value
+			popm.w	#7,		R10
+			ret
+
+;-------------------------------------------------------------------------------
+; evalReduce: applies operators off the operator stack while the top entry is
+; at least R11; R15 = EVAL_OK or EVAL_DIV0. Uses R6, R8, R9, R15
+;-------------------------------------------------------------------------------
+evalReduce:
+			mov.w	-2(R5),	R9
+			cmp.w	R11,	R9
+			jlo		reduceDone
+			decd.w	R5
+			cmp.w	#OP_NEG, R9
+			jlo		reduceBinary
+			inv.w	-2(R4)					; unary minus
+			inc.w	-2(R4)
+			jmp		evalReduce
+
+reduceBinary
+			decd.w	R4
+			mov.w	@R4,	R15				; right operand; left at -2(R4)
+			cmp.b	#'+',	R9
+			jne		reduceSub
+			add.w	R15,	-2(R4)
+			jmp		evalReduce
+reduceSub	cmp.b	#'-',	R9
+			jne		reduceMul
+			sub.w	R15,	-2(R4)
+			jmp		evalReduce
+reduceMul	cmp.b	#'*',	R9
+			jne		reduceDiv
+			mov.w	-2(R4),	&MPYS
+			mov.w	R15,	&OP2
+			mov.w	&RESLO,	-2(R4)			; read after its 3 cycles, no nop
+			jmp		evalReduce
+
+reduceDiv	tst.w	R15
+			jz		reduceDiv0
+			mov.w	-2(R4),	R6				; |left| / |right|, sign of left ^ right
+			mov.w	R6,		R8
+			xor.w	R15,	R8
+			tst.w	R6
+			jge		divRight
+			inv.w	R6
+			inc.w	R6
+divRight	tst.w	R15
+			jge		divStart
+			inv.w	R15
+			inc.w	R15
+divStart	clr.w	R9						; remainder
+			push.w	R11
+			mov.w	#16,	R11
+divLoop		rla.w	R6						; next dividend bit into the remainder,
+			rlc.w	R9						; quotient bit in at the bottom
+			cmp.w	R15,	R9
+			jlo		divNext
+			sub.w	R15,	R9
+			bis.w	#1,		R6
+divNext		dec.w	R11
+			jnz		divLoop
+			pop.w	R11
+			tst.w	R8
+			jge		divStore
+			inv.w	R6
+			inc.w	R6
+divStore	mov.w	R6,		-2(R4)
+			jmp		evalReduce
+
+reduceDiv0	mov.w	#EVAL_DIV0, R15
+			ret
+reduceDone	clr.w	R15
+			ret
+			.end
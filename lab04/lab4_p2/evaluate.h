@@ -0,0 +1,30 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        evaluate.h
+ * Description:     Prototype and status codes of Evaluate (Evaluate.asm), the
+ *              shunting-yard evaluator for signed integer expressions with
+ *              + - * / and parentheses. A line received over the UART goes in
+ *              as it sits in the RX buffer: the line ends at length or at the
+ *              first NUL, CR or LF
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef EVALUATE_H_
+#define EVALUATE_H_
+
+// Macros (status)
+#define EVAL_OK         0
+#define EVAL_SYNTAX     1                           // misplaced token, unbalanced parenthesis
+#define EVAL_DIV0       2                           // division by zero
+#define EVAL_DEPTH      3                           // more than 15 operators and '(' pending
+
+// Function Prototypes
+unsigned int Evaluate(const char* line, unsigned int length, int* value);
+/* evaluates the expression in line[0..length) with 16-bit int arithmetic
+ * (wrapping, / truncating toward zero) and stores it in *value; returns
+ * EVAL_OK or the error, *value untouched on an error
+ */
+
+#endif /* EVALUATE_H_ */
@@ -11,12 +11,23 @@
 ; Output:		int product of 'a' and 'b' outputted to P2OUT
 ; Author(s):   	Polickoski, Nick
 ; Date:        	September 7, 2023
+;
+;
+; Revisions::
+; Author:      	Polickoski, Nick
+; Date:        	October 17, 2026
+; Changes:		1. The expression is evaluated by Evaluate (Evaluate.asm), a
+;				shunting-yard evaluator: multi-digit signed operands, + - * /,
+;				parentheses, products on the MPY32 instead of up to nine add.b
+;				iterations. P2OUT gets the low byte of the value, 0xFF for an
+;				expression Evaluate rejects as before
 ;----------------------------------------------------------------------------
             .cdecls C,LIST,"msp430.h"       ; Include device header file
             
 ;-------------------------------------------------------------------------------
             .def    RESET                   ; Export program entry-point to
                                             ; make it known to linker.
+            .ref    Evaluate                ; shunting-yard evaluator (Evaluate.asm)
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
             .retain                         ; Override ELF conditional linking
@@ -26,7 +37,9 @@
 
 ;-------------------------------------------------------------------------------
 			.data
-product		.cstring 	"4*6"				; takes form of "a*b"
+product		.cstring 	"4*6"				; any expression: "-12*(7+30)/4", ...
+productEnd									; one past the NULL
+value		.word		0
 
 ;-------------------------------------------------------------------------------
 RESET       mov.w   #__STACK_END,SP         ; Initialize stackpointer
@@ -37,73 +50,14 @@ StopWDT     mov.w   #WDTPW|WDTHOLD,&WDTCTL  ; Stop watchdog timer
 ; Main loop here
 ;-------------------------------------------------------------------------------
 ; Call to Main
-main		mov.w	#product,	R4			; take in "product" string
-			mov.b	#0xFF,		R9			; initialize total = 0xFF
-
-
-; Taking/Validating Values from String
-			mov.b	@R4,		R5			; takes contents of 'a'
-
-			; if (a < 0x30)					; num. chars 0-9
-			cmp.b 	#30h, 		R5			; ASCII: 0x30 - 0x39
-			jl 		output
-
-			; if (a >= 0x3A)
-			cmp.b 	#0x3A,		R5
-			jge		output
-
-			inc.w	R4						; increment to 2nd byte
-			mov.b	@R4,		R6			; takes in '*'
-
-			; if (R6 != '*')
-			cmp		#0x2A,		R6
-			jne		output
-
-			inc.w	R4						; increment to 3rd byte
-			mov.b	@R4,		R6			; takes contents of 'b'
-
-
-			; if (b < 0x30)
-			cmp.b 	#30h, 		R6
-			jl 		output
-
-			; if (b >= 0x3A)
-			cmp.b 	#0x3A,		R6
-			jge		output
-
-			inc.w	R4						; increment to 4th byte
-			mov.b	@R4,		R7			; takes contents of 'NULL'
-
-			; if (R7 != NULL)
-			cmp.b	#0x00,		R7
-			jne		output
-
-
-; ASCII to int Conversion
-			sub.b	#30h,		R5			; subtracting 0x30 from ASCII .
-			sub.b	#30h,		R6			;		num value = binary rep.
-			clr		R9						; total = 0
-
-; Find Smaller Number
-			cmp.b	R5,			R6			; compares a and b
-			jn		negNum					;
-
-			; if (b > a)
-			mov.b	R5, 		R7			; iter = a
-			mov.b	R6,			R8			; base = b
-			jmp 	Multi
-
-			; else if (a >= b)
-negNum		mov.b 	R6,			R7			; iter = b
-			mov.b	R5,			R8			; base = a
-
-
-; Multiplication Loop
-Multi		cmp.b	#0h,		R7			; if (iter != 0)
-			jeq 	output
-			add.b	R8,			R9			; total += base
-			dec.b	R7						; iter--
-			jmp 	Multi
+main		mov.w	#product,	R12			; take in "product" string
+			mov.w	#productEnd-product-1, R13	; characters before the NULL
+			mov.w	#value,		R14
+			call	#Evaluate
+			mov.b	#0xFF,		R9			; invalid: total = 0xFF
+			tst.w	R12
+			jnz		output
+			mov.b	&value,		R9
 
 
 ; Output
@@ -0,0 +1,92 @@
+;------------------------------------------------------------------------------
+; Initial Build::
+; Sub File:   	Translate.asm
+; Function:		In-place byte translation through a 256-byte map (XLAT)
+;
+; Description:		Replaces every byte of a buffer with map[byte]. Bytes are
+;				read and written as words, two per iteration: the low and high
+;				byte are looked up separately and the word is stored back once.
+;				A byte before the first word boundary and a last odd byte are
+;				done on their own, so any chunk (of a UART RX buffer as it fills,
+;				say) can be passed as it is. digitRotate is the lab's map: '9'
+;				-> '0', other digits + 1, every other byte unchanged. C prototype:
+;
+;					void Translate(char* buf, unsigned int length, const unsigned char* map);
+;
+; Input:		R12 = buf, R13 = length, R14 = map
+; Output:		buf translated in place
+; Author(s):   	Polickoski, Nick
+; Date:        	October 17, 2026
+;----------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    Translate               ; C-callable translation
+            .def    digitRotate             ; lab4_p3 map
+
+;-------------------------------------------------------------------------------
+            .sect   ".const"                ; Maps in FLASH
+;-------------------------------------------------------------------------------
+digitRotate:
+			.byte	00h,01h,02h,03h,04h,05h,06h,07h,08h,09h,0Ah,0Bh,0Ch,0Dh,0Eh,0Fh	; 00h..0Fh
+			.byte	10h,11h,12h,13h,14h,15h,16h,17h,18h,19h,1Ah,1Bh,1Ch,1Dh,1Eh,1Fh	; 10h..1Fh
+			.byte	20h,21h,22h,23h,24h,25h,26h,27h,28h,29h,2Ah,2Bh,2Ch,2Dh,2Eh,2Fh	; 20h..2Fh
+			.byte	31h,32h,33h,34h,35h,36h,37h,38h,39h,30h,3Ah,3Bh,3Ch,3Dh,3Eh,3Fh	; 30h..3Fh
+			.byte	40h,41h,42h,43h,44h,45h,46h,47h,48h,49h,4Ah,4Bh,4Ch,4Dh,4Eh,4Fh	; 40h..4Fh
+			.byte	50h,51h,52h,53h,54h,55h,56h,57h,58h,59h,5Ah,5Bh,5Ch,5Dh,5Eh,5Fh	; 50h..5Fh
+			.byte	60h,61h,62h,63h,64h,65h,66h,67h,68h,69h,6Ah,6Bh,6Ch,6Dh,6Eh,6Fh	; 60h..6Fh
+			.byte	70h,71h,72h,73h,74h,75h,76h,77h,78h,79h,7Ah,7Bh,7Ch,7Dh,7Eh,7Fh	; 70h..7Fh
+			.byte	80h,81h,82h,83h,84h,85h,86h,87h,88h,89h,8Ah,8Bh,8Ch,8Dh,8Eh,8Fh	; 80h..8Fh
+			.byte	90h,91h,92h,93h,94h,95h,96h,97h,98h,99h,9Ah,9Bh,9Ch,9Dh,9Eh,9Fh	; 90h..9Fh
+			.byte	0A0h,0A1h,0A2h,0A3h,0A4h,0A5h,0A6h,0A7h,0A8h,0A9h,0AAh,0ABh,0ACh,0ADh,0AEh,0AFh	; A0h..AFh
+			.byte	0B0h,0B1h,0B2h,0B3h,0B4h,0B5h,0B6h,0B7h,0B8h,0B9h,0BAh,0BBh,0BCh,0BDh,0BEh,0BFh	; B0h..BFh
+			.byte	0C0h,0C1h,0C2h,0C3h,0C4h,0C5h,0C6h,0C7h,0C8h,0C9h,0CAh,0CBh,0CCh,0CDh,0CEh,0CFh	; C0h..CFh
+			.byte	0D0h,0D1h,0D2h,0D3h,0D4h,0D5h,0D6h,0D7h,0D8h,0D9h,0DAh,0DBh,0DCh,0DDh,0DEh,0DFh	; D0h..DFh
+			.byte	0E0h,0E1h,0E2h,0E3h,0E4h,0E5h,0E6h,0E7h,0E8h,0E9h,0EAh,0EBh,0ECh,0EDh,0EEh,0EFh	; E0h..EFh
+			.byte	0F0h,0F1h,0F2h,0F3h,0F4h,0F5h,0F6h,0F7h,0F8h,0F9h,0FAh,0FBh,0FCh,0FDh,0FEh,0FFh	; F0h..FFh
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutine
+;-------------------------------------------------------------------------------
+Translate:
+			tst.w	R13
+			jz		xlatDone
+
+			bit.w	#1,		R12				; odd start: one byte to the word boundary
+			jz		xlatEven
+			mov.b	@R12,	R15
+			add.w	R14,	R15
+			mov.b	@R15,	0(R12)
+			inc.w	R12
+			dec.w	R13
+
+xlatEven	bit.w	#1,		R13				; odd length: the last byte first
+			jz		xlatPairs
+			mov.w	R12,	R11
+			add.w	R13,	R11
+			mov.b	-1(R11), R15
+			add.w	R14,	R15
+			mov.b	@R15,	-1(R11)
+
+xlatPairs	clrc
+			rrc.w	R13						; words
+			jz		xlatDone
+
+xlatLoop	mov.w	@R12+,	R15				; two bytes
+			mov.b	R15,	R11				; low byte
+			add.w	R14,	R11
+			swpb	R15
+			mov.b	R15,	R15				; high byte
+			add.w	R14,	R15
+			mov.b	@R15,	R15
+			swpb	R15
+			mov.b	@R11,	R11
+			bis.w	R11,	R15
+			mov.w	R15,	-2(R12)			; both back with one store
+			dec.w	R13
+			jnz		xlatLoop
+
+xlatDone	ret
+			.end
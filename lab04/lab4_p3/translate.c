@@ -0,0 +1,63 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        translate.c
+ * Description:     C side of the byte-translation engine (translate.h): the
+ *              byte-at-a-time fallback and the ring-buffer chunking for text
+ *              streamed in over the UART. Chunks go to Translate (Translate.asm)
+ *              unless TRANSLATE_NO_ASM is defined
+ *
+ * Input:       buffer or ring chunk, 256-byte map
+ * Output:      bytes translated in place
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+//// Preprocessor Directives
+// Libraries
+#include "translate.h"
+
+// Macros
+#ifdef TRANSLATE_NO_ASM
+#define TRANSLATE TranslateC                        // no Translate.asm in the build
+#else
+#define TRANSLATE Translate
+#endif
+
+
+
+//// Function Definitions
+void TranslateC(char* buf, unsigned int length, const unsigned char* map)
+{
+    for (; length > 0; length--, buf++)
+    {
+        *buf = (char)map[(unsigned char)*buf];
+    }
+
+    return;
+}
+
+
+unsigned int TranslateRing(char* ring, unsigned int mask, unsigned int from, unsigned int to,
+                           const unsigned char* map)
+{
+    if ((unsigned int)(to - from) > mask + 1)
+    {
+        from = to - (mask + 1);                     // overrun: the older bytes were written over
+    }
+
+    const unsigned int start = from & mask;
+    const unsigned int count = to - from;
+    const unsigned int first = mask + 1 - start;    // bytes up to the end of the ring
+
+    if (count <= first)
+    {
+        TRANSLATE(ring + start, count, map);
+    }
+    else
+    {
+        TRANSLATE(ring + start, first, map);        // the chunk wraps
+        TRANSLATE(ring, count - first, map);
+    }
+
+    return to;
+}
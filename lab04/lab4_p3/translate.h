@@ -0,0 +1,35 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        translate.h
+ * Description:     Prototypes of the byte-translation engine: Translate and the
+ *              digitRotate map (Translate.asm, the fast path), TranslateC (the
+ *              C fallback, translate.c) and TranslateRing for chunks of a UART
+ *              RX ring buffer
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef TRANSLATE_H_
+#define TRANSLATE_H_
+
+// Maps
+extern const unsigned char digitRotate[256];        // '9' -> '0', other digits + 1
+
+// Function Prototypes
+void Translate(char* buf, unsigned int length, const unsigned char* map);
+/* buf[i] = map[buf[i]] for length bytes, in place; two bytes per word access
+ */
+void TranslateC(char* buf, unsigned int length, const unsigned char* map);
+/* the same a byte at a time, for builds without Translate.asm
+ */
+unsigned int TranslateRing(char* ring, unsigned int mask, unsigned int from, unsigned int to,
+                           const unsigned char* map);
+/* translates the bytes received into a ring buffer of mask + 1 bytes (a power
+ * of two) between the indices from and to (free-running, as an RX ISR counts
+ * them), in one span or two where the chunk wraps; returns to, where the next
+ * chunk starts. After an RX overrun (more than mask + 1 bytes) only the last
+ * mask + 1, the ones still in the ring, are translated
+ */
+
+#endif /* TRANSLATE_H_ */
@@ -3,6 +3,11 @@
             
 ;-------------------------------------------------------------------------------
             .def    HW_dot                  ; hardware dot product formula
+            .def    HW_dot_eabi             ; same, R12-R15, result in R12 (dot.h)
+            .def    HW_dot40                ; exact sum, 64-bit result (dot.h)
+            .def    HW_dot32                ; sum saturated to 32 bits
+            .def    HW_dotQ15               ; Q15 vectors, saturated Q15 result
+            .def    HW_fir                  ; Q15 FIR filter (dot.h)
 
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
@@ -38,4 +43,159 @@ endMainLoop:
 			pop		R4						; pop unknown
 
 			ret
+
+;-------------------------------------------------------------------------------
+; EABI version: R12 = arr1, R13 = arr2, R14 = length; returns the result in
+; R12 (int HW_dot_eabi(const int*, const int*, unsigned int) in dot.h)
+;-------------------------------------------------------------------------------
+HW_dot_eabi:
+			clr		&RESLO					; for proper instantiation of accumulation multiplication
+
+eabiLoop:
+			tst.w	R14						; for (length > 0)
+			jeq		eabiDone
+
+			mov.w	@R12+,	&MACS			; operand #1: arr1[i]
+			mov.w	@R13+,	&OP2			; operand #2: arr2[i]
+
+			dec.w	R14						; length-- (the loop test covers the 3cc)
+			jmp		eabiLoop
+
+eabiDone:
+			mov.w	&RESLO,	R12				; return result
+			ret
+
+;-------------------------------------------------------------------------------
+; Wide dot products for long vectors: R12 = arr1, R13 = arr2, R14 = length.
+; dotSum runs the MACS chain over RESHI:RESLO and counts in R11 how often the
+; 32-bit sum wrapped: after each MACS, SUMEXT holds the sign of the true sum and
+; bit 15 of RESHI the sign of what was kept, so they differ exactly when it
+; wrapped, upward if SUMEXT is 0. The sum is the count times 2^32 plus
+; RESHI:RESLO as a signed long, which dotSum returns as 48 bits in R11:R13:R12
+; (4096 products of -8000h * -8000h take 43). Two elements per pass. The MPY32
+; must be in its reset mode (no MPYFRAC/MPYSAT)
+;-------------------------------------------------------------------------------
+HW_dot40:
+			call	#dotSum
+			mov.w	R11,	R14				; R15:R14:R13:R12 = the sum
+			mov.w	R11,	R15				; sign of the guard word:
+			rla.w	R15						; C = sign
+			subc.w	R15,	R15				; C - 1
+			inv.w	R15
+			ret
+
+HW_dot32:
+			call	#dotSum
+			cmp.w	#8000h,	R13				; C = sign of RESHI
+			addc.w	#0,		R11				; 0: R11 is its sign extension
+			jz		dot32Done
+			rla.w	R11						; C = sign: 7FFFFFFFh or 80000000h
+			mov.w	#-1,	R12
+			mov.w	#7FFFh,	R13
+			addc.w	#0,		R12
+			addc.w	#0,		R13
+dot32Done	ret
+
+HW_dotQ15:
+			call	#dotSum					; Q30 sum
+			rla.w	R12						; >> 15: R11:R13 = sum bits 46..15,
+			rlc.w	R13						; C = bit 31, now the guard's bit 0
+			addc.w	R11,	R11
+			cmp.w	#8000h,	R13
+			addc.w	#0,		R11				; 0: fits in Q15
+			jz		dotQ15Done
+			rla.w	R11
+			mov.w	#7FFFh,	R13
+			addc.w	#0,		R13
+dotQ15Done	mov.w	R13,	R12
+			ret
+
+; dotSum: R12 = arr1, R13 = arr2, R14 = length -> R11:R13:R12 = sum
+dotSum:
+			clr.w	&RESLO
+			clr.w	&RESHI
+			clr.w	R11
+			bit.w	#1,		R14				; odd length: one element first
+			jz		dotPairs
+			mov.w	@R12+,	&MACS
+			mov.w	@R13+,	&OP2
+			mov.w	&SUMEXT, R15
+			xor.w	&RESHI,	R15
+			jn		dotWrapOdd
+
+dotPairs	clrc
+			rrc.w	R14
+			jz		dotDone
+
+dotLoop		mov.w	@R12+,	&MACS			; element 0
+			mov.w	@R13+,	&OP2
+			mov.w	&SUMEXT, R15
+			xor.w	&RESHI,	R15
+			jn		dotWrap0
+dotNext		mov.w	@R12+,	&MACS			; element 1
+			mov.w	@R13+,	&OP2
+			mov.w	&SUMEXT, R15
+			xor.w	&RESHI,	R15
+			jn		dotWrap1
+dotCount	dec.w	R14
+			jnz		dotLoop
+
+dotDone		mov.w	&RESLO,	R12
+			mov.w	&RESHI,	R13
+			tst.w	R13						; the count times 2^32 plus RESHI:RESLO as
+			jge		dotSumRet				; a signed long: top word one less when
+			dec.w	R11						; RESHI is negative
+dotSumRet	ret
+
+dotWrapOdd	inc.w	R11						; wrapped: +1, or -1 below -2^31
+			tst.w	&SUMEXT
+			jge		dotPairs
+			decd.w	R11
+			jmp		dotPairs
+dotWrap0	inc.w	R11
+			tst.w	&SUMEXT
+			jge		dotNext
+			decd.w	R11
+			jmp		dotNext
+dotWrap1	inc.w	R11
+			tst.w	&SUMEXT
+			jge		dotCount
+			decd.w	R11
+			jmp		dotCount
+
+;-------------------------------------------------------------------------------
+; Q15 FIR filter: R12 = x, R13 = h, R14 = y, R15 = taps, outputs on the stack.
+; y[k] = sum of h[j] * x[k + j] for j < taps, k < outputs (x holds outputs +
+; taps - 1 samples): one MACS chain per output, read from RESHI with MPYFRAC and
+; MPYSAT set, so a sum outside Q15 saturates. HW_fir_dma (HW_dot_dma.asm) is
+; the same filter with the operands moved in by DMA
+;-------------------------------------------------------------------------------
+HW_fir:
+			tst.w	R15						; no taps: y is left alone
+			jz		firRet
+			pushm.w	#3,		R10				; R8..R10
+			mov.w	8(SP),	R11				; outputs
+			tst.w	R11
+			jz		firDone
+
+firOutput	mov.w	R12,	R9				; x[k]
+			mov.w	R13,	R10				; h[0]
+			mov.w	R15,	R8
+			clr.w	&RESLO
+			clr.w	&RESHI
+firTap		mov.w	@R9+,	&MACS
+			mov.w	@R10+,	&OP2
+			dec.w	R8						; the loop test covers the 3cc
+			jnz		firTap
+
+			mov.w	#MPYSAT|MPYFRAC, &MPY32CTL0	; for the read only
+			mov.w	&RESHI,	0(R14)
+			clr.w	&MPY32CTL0
+			incd.w	R14
+			incd.w	R12						; window one sample on
+			dec.w	R11
+			jnz		firOutput
+
+firDone		popm.w	#3,		R10
+firRet		ret
 			.end
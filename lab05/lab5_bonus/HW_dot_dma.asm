@@ -0,0 +1,130 @@
+;------------------------------------------------------------------------------
+; Initial Build::
+; File:        	HW_dot_dma.asm
+; Subroutine:	Dot product and FIR filter with the MPY32 operands moved in by DMA
+;
+; Description:		HW_dot's MACS chain without the CPU: DMA channel 0 moves
+;				arr1[i] into MACS and channel 1 arr2[i] into OP2, both
+;				triggered by "multiplier ready" (DMAxTSEL 29), so each completed
+;				MAC starts the next pair and channel 0 always goes first. A
+;				0 * 0 through MPYS clears the sum and sets the chain off, and
+;				the CPU sleeps in LPM0 until DMA_ISR sees DMA1IFG after the last
+;				pair. HW_fir_dma runs one such sum per output over a window
+;				that slides one sample at a time: DMA_ISR stores each output
+;				and re-arms the channels for the next, the CPU wakes once per
+;				output instead of working through every tap. Uses DMA0/DMA1
+;				and the DMA vector; GIE is restored as the caller had it
+;
+; Input:		HW_dot_dma: R12 = arr1, R13 = arr2, R14 = length
+;				HW_fir_dma: R12 = x, R13 = h, R14 = y, R15 = taps, outputs on
+;				the stack
+; Output:		HW_dot_dma: R13:R12 = sum (RESHI:RESLO); HW_fir_dma: y[]
+; Author(s):   	Polickoski, Nick
+; Date:        	October 17, 2026
+;----------------------------------------------------------------------------
+            .cdecls C,LIST,"msp430.h"       ; Include device header file
+
+;-------------------------------------------------------------------------------
+            .def    HW_dot_dma              ; DMA-fed dot product (dot.h)
+            .def    HW_fir_dma              ; DMA-fed FIR filter (dot.h)
+            .def    DMA_ISR                 ; end of a DMA-fed sum
+
+DMA_MPY_TSEL	.equ	DMA0TSEL__MPY|DMA1TSEL__MPY		; both channels on "multiplier ready"
+DMA_MPY_CTL		.equ	DMADT_0|DMASRCINCR_3|DMAEN		; single word transfers, source incremented
+
+;-------------------------------------------------------------------------------
+			.bss	firX, 2					; window of the running output
+			.bss	firY, 2					; where it goes
+			.bss	firLeft, 2				; outputs not stored yet, 0: dot product
+
+;-------------------------------------------------------------------------------
+            .text                           ; Assemble into program memory.
+;-------------------------------------------------------------------------------
+; Subroutine
+;-------------------------------------------------------------------------------
+HW_dot_dma:
+			tst.w	R14						; nothing to move: the sum is 0
+			jz		dotDmaEmpty
+			clr.w	&firLeft				; DMA_ISR: no output to store
+			call	#dmaSum
+			mov.w	&RESLO,	R12
+			mov.w	&RESHI,	R13
+			ret
+dotDmaEmpty	clr.w	R12
+			clr.w	R13
+			ret
+
+;-------------------------------------------------------------------------------
+; FIR filter: y[k] = sum of h[j] * x[k + j] for j < taps, k < outputs (x holds
+; outputs + taps - 1 samples), each the Q30 sum read from RESHI as a saturated
+; Q15 value (DMA_ISR). No taps: y is left alone
+;-------------------------------------------------------------------------------
+HW_fir_dma:
+			tst.w	R15
+			jz		firDmaRet
+			tst.w	2(SP)					; outputs
+			jz		firDmaRet
+			mov.w	R12,	&firX
+			mov.w	R14,	&firY
+			mov.w	2(SP),	&firLeft
+			mov.w	R15,	R14				; x[k + j] -> MACS, h[j] -> OP2, taps each
+			call	#dmaSum
+firDmaRet	ret
+
+; dmaSum: R12 -> MACS, R13 -> OP2, R14 words each; returns when DMA_ISR has
+; taken the last sum
+dmaSum:
+			push.w	SR						; GIE as the caller had it
+			dint							; no DMA_ISR before the CPU is asleep
+			nop
+			mov.w	#DMA_MPY_TSEL, &DMACTL0
+			mov.w	R12,	&DMA0SA
+			mov.w	#MACS,	&DMA0DA
+			mov.w	R14,	&DMA0SZ
+			mov.w	R13,	&DMA1SA
+			mov.w	#OP2,	&DMA1DA
+			mov.w	R14,	&DMA1SZ
+			mov.w	#DMA_MPY_CTL, &DMA0CTL
+			mov.w	#DMA_MPY_CTL|DMAIE, &DMA1CTL	; interrupt after the last pair
+			clr.w	&MPYS					; 0 * 0: sum cleared, and its completion
+			clr.w	&OP2					; triggers the first pair
+			bis.w	#LPM0_bits|GIE, SR		; the DMA runs the sum
+			nop								; required
+			pop.w	SR
+			ret
+
+;-------------------------------------------------------------------------------
+; Interrupts
+;-------------------------------------------------------------------------------
+DMA_ISR:
+			tst.w	&DMAIV					; clears DMA1IFG (DMA0 has no DMAIE)
+			tst.w	&firLeft
+			jz		dmaWake					; dot product: done
+
+			push.w	R15						; FIR: store y[k]
+			mov.w	&firY,	R15
+			mov.w	#MPYSAT|MPYFRAC, &MPY32CTL0	; for the read only
+			mov.w	&RESHI,	0(R15)
+			clr.w	&MPY32CTL0
+			pop.w	R15
+			incd.w	&firY
+			dec.w	&firLeft
+			jz		dmaWake					; that was the last output
+
+			incd.w	&firX					; next window: x[k + 1] on
+			mov.w	&firX,	&DMA0SA
+			bis.w	#DMAEN,	&DMA0CTL		; reloads DMAxSA/SZ: h[] from the start
+			bis.w	#DMAEN,	&DMA1CTL
+			clr.w	&MPYS					; next sum
+			clr.w	&OP2
+			reti
+
+dmaWake		bic.w	#LPM0_bits, 0(SP)		; back in dmaSum on RETI
+			reti
+
+;-------------------------------------------------------------------------------
+; Interrupt Vectors
+;-------------------------------------------------------------------------------
+            .sect	".int50"				; DMA Vector
+            .short	DMA_ISR
+            .end
@@ -3,6 +3,7 @@
             
 ;-------------------------------------------------------------------------------
             .def    SW_dot                  ; software dot product formula
+            .def    SW_dot_eabi             ; same, R12-R15, result in R12 (dot.h)
 
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
@@ -70,4 +71,44 @@ endMainLoop:
 			pop		R4						; pop unknown
 
 			ret
+
+;-------------------------------------------------------------------------------
+; EABI version: R12 = arr1, R13 = arr2, R14 = length; returns the result in
+; R12. R15 holds the result, R11 bitNum, R4/R5 (callee-saved) the operands
+;-------------------------------------------------------------------------------
+SW_dot_eabi:
+			pushm.w	#2,		R5				; R4, R5
+			clr		R15						; result = 0
+
+eabiLoop:
+			tst.w	R14						; for (length > 0)
+			jeq		eabiDone
+			dec.w	R14						; length--
+
+			mov.w	@R12+,	R4				; arr1[i]
+			mov.w	@R13+,	R5				; arr2[i]
+			clr		R11						; bitNum = 0
+
+eabiBit:
+			cmp.w	#8,		R11				; for (8 > bitNum)
+			jeq		eabiStep4
+			bit.w	#0x01,	R5				; if (0001 & arr2[i] == 1)
+			jz		eabiShift
+			add.w	R4,		R15				; result += arr1[i]
+eabiShift:
+			rla.w	R4						; arr1[i] << 1
+			rra.w	R5						; arr2[i] >> 1
+			add.b	#1,		R11				; bitNum++
+			jmp		eabiBit
+
+eabiStep4:
+			bit.w	#0x01,	R5
+			jz		eabiLoop
+			sub.w	R4,		R15				; result -= arr1[i]
+			jmp		eabiLoop
+
+eabiDone:
+			mov.w	R15,	R12				; return result
+			popm.w	#2,		R5
+			ret
 			.end
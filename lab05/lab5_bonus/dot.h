@@ -0,0 +1,51 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        dot.h
+ * Description:     C prototypes of the register-argument (MSP430 EABI) versions
+ *              of the lab05 dot products: SW_dot_eabi (shift-and-add, SW_dot.asm)
+ *              and HW_dot_eabi (MPY32 MACS, HW_dot.asm). The arrays and length
+ *              arrive in R12-R14 and the result is returned in R12. SW_dot and
+ *              HW_dot take every argument on the stack and cannot be called
+ *              from C. HW_dot32/HW_dot40/HW_dotQ15 keep the whole MACS sum
+ *              (RESHI, and SUMEXT to count the wraps of the 32-bit
+ *              accumulator), for vectors of thousands of elements. HW_dot_dma
+ *              and HW_fir_dma (HW_dot_dma.asm) have DMA0/DMA1 move the operands
+ *              into the MPY32 while the CPU sleeps in LPM0; HW_fir is the
+ *              CPU-driven filter they are measured against
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef DOT_H_
+#define DOT_H_
+
+// Function Prototypes
+int SW_dot_eabi(const int* arr1, const int* arr2, unsigned int length);
+int HW_dot_eabi(const int* arr1, const int* arr2, unsigned int length);
+/* sum of arr1[i] * arr2[i], 16-bit (SW_: arr1[i] times the low 9 bits of
+ * arr2[i], as the lab's shift-and-add)
+ */
+long long HW_dot40(const int* arr1, const int* arr2, unsigned int length);
+/* the exact sum (48 bits are enough for any length), sign-extended to 64
+ */
+long HW_dot32(const int* arr1, const int* arr2, unsigned int length);
+/* the exact sum saturated to -2^31..2^31 - 1
+ */
+int HW_dotQ15(const int* arr1, const int* arr2, unsigned int length);
+/* Q15 vectors: the Q30 sum shifted down to Q15 (toward minus infinity) and
+ * saturated to -1..1 - 2^-15; the MPY32 must be in its reset mode for all
+ * three (no MPYFRAC/MPYSAT)
+ */
+long HW_dot_dma(const int* arr1, const int* arr2, unsigned int length);
+/* the sum modulo 2^32, from RESHI:RESLO; uses DMA0, DMA1 and the DMA vector
+ * (DMA_ISR), sleeps in LPM0 and returns with GIE as it was
+ */
+void HW_fir(const int* x, const int* h, int* y, unsigned int taps, unsigned int outputs);
+void HW_fir_dma(const int* x, const int* h, int* y, unsigned int taps, unsigned int outputs);
+/* Q15 FIR filter: y[k] = sum of h[j] * x[k + j] for j < taps, k < outputs,
+ * rounded toward minus infinity and saturated to Q15 as the MPY32 does with
+ * MPYFRAC/MPYSAT (x holds outputs + taps - 1 samples)
+ */
+
+#endif /* DOT_H_ */
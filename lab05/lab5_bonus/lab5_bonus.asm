@@ -5,8 +5,8 @@
             .def    RESET                   ; Export program entry-point to
                                             ; make it known to linker.
 
-          	.ref	SW_dot					; software dot product formula
-          	.ref	HW_dot					; hardware dot product formula
+          	.ref	SW_dot_eabi				; software dot product formula
+          	.ref	HW_dot_eabi				; hardware dot product formula
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
             .retain                         ; Override ELF conditional linking
@@ -30,24 +30,19 @@ StopWDT     mov.w   #WDTPW|WDTHOLD,&WDTCTL  ; Stop watchdog timer
 ; Main loop here
 ;-------------------------------------------------------------------------------
 main:
-			push 	#grandma				; base address of array #1
-			push 	#grandpa				; base address of array #2
-			push 	length					; length of arrays
-
 funcSWdot:
-			push 	#resultSW				; memory for resultSW
-			call	#SW_dot					; function call: SW_dot
-			mov.w   #0x4400,	SP			; pop base addreses of array #1, #2, as well as the result, and length
-
+			mov.w	#grandma,	R12			; base address of array #1
+			mov.w	#grandpa,	R13			; base address of array #2
+			mov.w	length,		R14			; length of arrays
+			call	#SW_dot_eabi			; function call: SW_dot_eabi
+			mov.w	R12,		resultSW	; store resultSW
 
-			push 	#grandma				; base address of array #1
-			push 	#grandpa				; base address of array #2
-			push 	length					; length of arrays
-                                            
 funcHWdot:
-			push 	#resultHW				; memory for resultHW
-			call 	#HW_dot					; function call: HW_dot
-			mov.w	#0x4400,	SP			; pop base addreses of array #1, #2, as well as the result, and length
+			mov.w	#grandma,	R12			; base address of array #1
+			mov.w	#grandpa,	R13			; base address of array #2
+			mov.w	length,		R14			; length of arrays
+			call	#HW_dot_eabi			; function call: HW_dot_eabi
+			mov.w	R12,		resultHW	; store resultHW
 
 end:
 			nop								; for debugging
@@ -12,11 +12,25 @@
 ; Output:		16-bit integer array arrHW
 ; Author(s):   	Polickoski, Nick
 ; Date:        	September 17, 2023
+;
+;
+; Revisions::
+; Author:      	Polickoski, Nick
+; Date:        	October 17, 2026
+; Changes:		1. HW_linear_eabi: the same loop with the arguments in R12-R15
+;				and arrHW on the stack per the MSP430 EABI, callable from C
+;				(linear.h); HW_linear keeps the lab's all-on-the-stack convention
+;				2. HW_linear_block for long blocks (ADC samples): in place, the
+;				slope written to MPYS once, four elements per pass with @R12+,
+;				and m*x + C formed at 32 bits from RESLO/RESHI and saturated to
+;				16 on the store
 ;----------------------------------------------------------------------------
             .cdecls C,LIST,"msp430.h"       ; Include device header file
             
 ;-------------------------------------------------------------------------------
             .def    HW_linear               ; software linear formula
+            .def    HW_linear_eabi          ; same, arguments in R12-R15 (linear.h)
+            .def    HW_linear_block         ; in place, 4x unrolled, saturating
 
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
@@ -53,4 +67,126 @@ endMainLoop:
 			pop		R4						; pop unknown
 
 			ret								; return to main
+
+;-------------------------------------------------------------------------------
+; EABI version: R12 = arrIn, R13 = length, R14 = m, R15 = C, arrHW[] on the
+; stack (2(SP)); only the caller-saved R11-R15 are used, so nothing is saved
+;-------------------------------------------------------------------------------
+HW_linear_eabi:
+			mov.w	2(SP),	R11				; base address of arrHW[]
+
+eabiLoop:
+			tst.w	R13						; for (length > 0)
+			jeq		eabiDone
+
+			mov.w	R14,	&MPYS			; initialize 'm'
+			mov.w	@R12+,	&OP2			; inialize 'x' <- arrIn[i]
+
+			dec.w	R13						; length-- (RESLO is ready after it)
+			add.w	R15,	&RESLO			; arrHW[i] + C
+			mov.w	&RESLO,	0(R11)			; write arrHW[] to memory
+			incd.w	R11						; iterate to next element in arrHW[]
+			jmp		eabiLoop
+
+eabiDone:
+			ret
+
+;-------------------------------------------------------------------------------
+; HW_linear_block: buf[i] = m * buf[i] + C in place, R12 = buf, R13 = length,
+; R14 = m, R15 = C. MPYS is written once: every OP2 write after it multiplies
+; by the same m. RESHI:RESLO + C (sign-extended in R11) is 32 bits, so nothing
+; wraps; a sum outside -8000h..7FFFh is stored as 8000h or 7FFFh. It fits 16
+; bits when RESHI plus bit 15 of RESLO is 0 (RESHI = 0 with RESLO < 8000h, or
+; RESHI = FFFFh with RESLO >= 8000h), one cmp and addc. The MPY32 must be in its
+; reset mode (no MPYFRAC/MPYSAT). R9 (saved) holds 8000h, R10 (saved) the high
+; word
+;-------------------------------------------------------------------------------
+HW_linear_block:
+			pushm.w	#2,		R10				; R9, R10
+			mov.w	#8000h,	R9				; for the range test
+			mov.w	R14,	&MPYS			; m, for every element
+			clr.w	R11						; C high word
+			tst.w	R15
+			jge		blockOdd
+			mov.w	#-1,	R11
+
+blockOdd	bit.w	#3,		R13				; length % 4 one at a time
+			jz		blockQuads
+			mov.w	@R12+,	&OP2
+			mov.w	&RESLO,	R14
+			mov.w	&RESHI,	R10
+			add.w	R15,	R14				; + C, 32 bits
+			addc.w	R11,	R10
+			cmp.w	R9,		R14				; C = bit 15 of the low word
+			addc.w	#0,		R10				; 0: fits in 16 bits
+			jz		blockOddSt
+			rla.w	R10						; C = sign: 7FFFh or 8000h
+			mov.w	#7FFFh,	R14
+			addc.w	#0,		R14
+blockOddSt	mov.w	R14,	-2(R12)
+			dec.w	R13
+			jmp		blockOdd
+
+blockQuads	clrc							; length / 4 (a multiple of 4 here)
+			rrc.w	R13
+			rra.w	R13
+			jz		blockDone
+
+blockLoop	mov.w	@R12+,	&OP2			; element 0
+			mov.w	&RESLO,	R14
+			mov.w	&RESHI,	R10
+			add.w	R15,	R14
+			addc.w	R11,	R10
+			cmp.w	R9,		R14
+			addc.w	#0,		R10
+			jz		blockSt0
+			rla.w	R10
+			mov.w	#7FFFh,	R14
+			addc.w	#0,		R14
+blockSt0	mov.w	R14,	-2(R12)
+
+			mov.w	@R12+,	&OP2			; element 1
+			mov.w	&RESLO,	R14
+			mov.w	&RESHI,	R10
+			add.w	R15,	R14
+			addc.w	R11,	R10
+			cmp.w	R9,		R14
+			addc.w	#0,		R10
+			jz		blockSt1
+			rla.w	R10
+			mov.w	#7FFFh,	R14
+			addc.w	#0,		R14
+blockSt1	mov.w	R14,	-2(R12)
+
+			mov.w	@R12+,	&OP2			; element 2
+			mov.w	&RESLO,	R14
+			mov.w	&RESHI,	R10
+			add.w	R15,	R14
+			addc.w	R11,	R10
+			cmp.w	R9,		R14
+			addc.w	#0,		R10
+			jz		blockSt2
+			rla.w	R10
+			mov.w	#7FFFh,	R14
+			addc.w	#0,		R14
+blockSt2	mov.w	R14,	-2(R12)
+
+			mov.w	@R12+,	&OP2			; element 3
+			mov.w	&RESLO,	R14
+			mov.w	&RESHI,	R10
+			add.w	R15,	R14
+			addc.w	R11,	R10
+			cmp.w	R9,		R14
+			addc.w	#0,		R10
+			jz		blockSt3
+			rla.w	R10
+			mov.w	#7FFFh,	R14
+			addc.w	#0,		R14
+blockSt3	mov.w	R14,	-2(R12)
+
+			dec.w	R13
+			jnz		blockLoop
+
+blockDone	popm.w	#2,		R10
+			ret
 			.end
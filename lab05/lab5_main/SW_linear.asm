@@ -12,11 +12,19 @@
 ; Output:		16-bit integer array arrHW
 ; Author(s):   	Polickoski, Nick
 ; Date:        	September 17, 2023
+;
+;
+; Revisions::
+; Author:      	Polickoski, Nick
+; Date:        	October 17, 2026
+; Changes:		1. SW_linear_eabi: the same shift-and-add with the arguments in
+;				R12-R15 and arrSW on the stack per the MSP430 EABI (linear.h)
 ;----------------------------------------------------------------------------
             .cdecls C,LIST,"msp430.h"       ; Include device header file
             
 ;-------------------------------------------------------------------------------
             .def    SW_linear               ; software linear formula
+            .def    SW_linear_eabi          ; same, arguments in R12-R15 (linear.h)
 
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
@@ -84,6 +92,50 @@ endMainLoop:
 			pop		R4						; pop unknown
 
 			ret								; return to main
+
+;-------------------------------------------------------------------------------
+; EABI version: R12 = arrIn, R13 = length, R14 = m, R15 = C, arrSW[] on the
+; stack; R4..R7 (callee-saved) hold x, m << i, bitNum and the sum
+;-------------------------------------------------------------------------------
+SW_linear_eabi:
+			pushm.w	#4,		R7				; R4..R7
+			mov.w	10(SP),	R11				; base address of arrSW[]
+
+eabiLoop:
+			tst.w	R13						; for (length > 0)
+			jeq		eabiDone
+			dec.w	R13						; length--
+
+			mov.w	@R12+,	R5				; arrIn[i]
+			clr		R7						; arrSW[i] = 0
+			clr		R6						; bitNum = 0
+			mov.w	R14,	R4				; initialize 'm'
+
+eabiBit:
+			cmp.w	#8,		R6				; for (8 > bitNum)
+			jeq		eabiStep4
+			bit.w	#0x01,	R5				; if (0001 & arrIn[i] == 1)
+			jz		eabiShift
+			add.w	R4,		R7				; arrSW[i] += m
+eabiShift:
+			rla.w	R4						; m << 1
+			rra.w	R5						; arrIn[i] >> 1
+			add.b	#1,		R6				; bitNum++
+			jmp		eabiBit
+
+eabiStep4:
+			bit.w	#0x01,	R5
+			jz		eabiStore
+			sub.w	R4,		R7				; arrSW[i] -= m
+eabiStore:
+			add.w	R15,	R7				; arrSW[i] + C
+			mov.w	R7,		0(R11)			; write arrSW[] to memory
+			incd.w	R11
+			jmp		eabiLoop
+
+eabiDone:
+			popm.w	#4,		R7
+			ret
 			.end
 
 
@@ -12,6 +12,14 @@
 ; Output:		Two 16-bit integer arrays: arrSW and arrHW
 ; Author(s):   	Polickoski, Nick
 ; Date:        	September 17, 2023
+;
+;
+; Revisions::
+; Author:      	Polickoski, Nick
+; Date:        	October 17, 2026
+; Changes:		1. The routines are called with the MSP430 EABI: arrIn, length,
+;				m and C in R12-R15, only the output array pushed and popped
+;				again, instead of five pushes and SP reset to 0x4400
 ;----------------------------------------------------------------------------
             .cdecls C,LIST,"msp430.h"       ; Include device header file
             
@@ -19,8 +27,8 @@
             .def    RESET                   ; Export program entry-point to
                                             ; make it known to linker.
 
-    		.ref	SW_linear				; software linear formula
-    		.ref	HW_linear				; hardware linear formula
+    		.ref	SW_linear_eabi			; software linear formula
+    		.ref	HW_linear_eabi			; hardware linear formula
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
             .retain                         ; Override ELF conditional linking
@@ -43,26 +51,23 @@ StopWDT     mov.w   #WDTPW|WDTHOLD,&WDTCTL  ; Stop watchdog timer
 ; Main loop here
 ;-------------------------------------------------------------------------------
 main:
-			push	#arrIn					; base address of arrIn
-			push	length					; length
-			push	slope					; m
-			push	constant				; C
-
 funcSWLinear:
-			push	#arrSW					; base address of arrSW
-			call	#SW_linear				; function call: SW_linear
-			mov.w   #0x4400,	SP			; pop base address arrSW[], C, m, length, and base address arrIn[]
-
-
-			push	#arrIn					; base address of arrIn
-			push	length					; length
-			push	slope					; m
-			push	constant				; C
+			push	#arrSW					; base address of arrSW (5th argument)
+			mov.w	#arrIn,		R12			; base address of arrIn
+			mov.w	length,		R13			; length
+			mov.w	slope,		R14			; m
+			mov.w	constant,	R15			; C
+			call	#SW_linear_eabi			; function call: SW_linear_eabi
+			incd.w	SP						; pop base address arrSW[]
 
 funcHWlinear:
-			push	#arrHW					; base address of arrHW
-			call	#HW_linear				; function call: HW_linear
-			mov.w   #0x4400,	SP			; pop base address arrHW[], C, m, length, and base address arrIn[]
+			push	#arrHW					; base address of arrHW (5th argument)
+			mov.w	#arrIn,		R12			; base address of arrIn
+			mov.w	length,		R13			; length
+			mov.w	slope,		R14			; m
+			mov.w	constant,	R15			; C
+			call	#HW_linear_eabi			; function call: HW_linear_eabi
+			incd.w	SP						; pop base address arrHW[]
 
 end:
             nop								; for debugger
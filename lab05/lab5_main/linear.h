@@ -0,0 +1,31 @@
+/*------------------------------------------------------------------------------
+ * Initial Build::
+ * File:        linear.h
+ * Description:     C prototypes of the register-argument (MSP430 EABI) versions
+ *              of the lab05 linear routines, Y = mX + C over an array:
+ *              SW_linear_eabi (shift-and-add, SW_linear.asm) and HW_linear_eabi
+ *              (MPY32, HW_linear.asm). arrIn, length, m and C arrive in
+ *              R12-R15 and arrOut on the stack, which the caller pops. SW_linear
+ *              and HW_linear take every argument on the stack and cannot be
+ *              called from C. HW_linear_block is the in-place kernel for long
+ *              blocks (ADC samples)
+ *
+ * Author(s):   Polickoski, Nick
+ * Date:        October 17, 2026
+ *----------------------------------------------------------------------------*/
+
+#ifndef LINEAR_H_
+#define LINEAR_H_
+
+// Function Prototypes
+void SW_linear_eabi(const int* arrIn, unsigned int length, int slope, int constant, int* arrOut);
+void HW_linear_eabi(const int* arrIn, unsigned int length, int slope, int constant, int* arrOut);
+/* arrOut[i] = slope * arrIn[i] + constant, 16-bit (SW_: slope times the low 9
+ * bits of arrIn[i], as the lab's shift-and-add)
+ */
+void HW_linear_block(int* buf, unsigned int length, int slope, int constant);
+/* buf[i] = slope * buf[i] + constant in place, formed at 32 bits and saturated
+ * to -32768..32767; the MPY32 must be in its reset mode (no MPYFRAC/MPYSAT)
+ */
+
+#endif /* LINEAR_H_ */
@@ -8,6 +8,18 @@
 ; Output:
 ; Author(s):   	Polickoski, Nick
 ; Date:        	September 24, 2023
+;
+;
+; Revisions::
+; Author:		Polickoski, Nick
+; Date:			October 17, 2026
+; Changes:		1. Debounce service: a 5ms Timer_A CCR0 tick (TICK_ISR) shifts each
+;					switch into a history byte; four equal samples (~20ms) change
+;					its state and post a press or release event. No interrupt
+;					spins through a 20000-cycle debounce loop any more
+;				2. The port interrupts are gone: main sleeps in LPM3 and toggles
+;					the LEDs for the posted events (SW1 on press and release,
+;					SW2 on press, as before)
 ;-------------------------------------------------------------------------------
             .cdecls C,LIST,"msp430.h"       ; Include device header file
 
@@ -15,10 +27,20 @@
             .def    RESET                   ; Export program entry-point to
                                             ; make it known to linker.
 
-            .def	SW1_ISR					; SW1 interrupt
-            .def	SW2_ISR					; SW2 interrupt
+            .def	TICK_ISR				; debounce tick interrupt
+;-------------------------------------------------------------------------------
+DEBOUNCE_MASK	.equ	0x0F				; samples that must agree: 4 * 5ms = ~20ms
+TICK_PERIOD		.equ	163					; CCR0: 164 ACLK ticks = 5ms
+
+SW1				.equ	0x01				; switch bits of the debounce service
+SW2				.equ	0x02
+
 ;-------------------------------------------------------------------------------
 			.data
+swHist		.byte	0, 0					; sample history of SW1, SW2 (newest in bit 0)
+swState		.byte	0						; debounced: bit set while pressed
+swPressed	.byte	0						; posted events: bit per switch, taken by main
+swReleased	.byte	0
 
 ;-------------------------------------------------------------------------------
             .text                           ; Assemble into program memory.
@@ -55,128 +77,109 @@ main:
 			bic.b	#0x80,	&P4OUT			; LED2 = off
 
 
-			;; Interrupts Setup
-			nop								; required
-			bis.w 	#GIE, 	SR 				; Enable Global Interrupts
-			nop								; required
+			;; Debounce Tick Setup
+			mov.w	#TICK_PERIOD, &TA0CCR0	; 5ms period
+			mov.w	#CCIE,	&TA0CCTL0		; CCR0 interrupt = debounce tick
+			mov.w	#TASSEL_1|MC_1|TACLR, &TA0CTL	; ACLK, up mode
 
-			; Switch #2
- 			bis.b 	#0x02, 	&P1IE 			; enable port P1.1 interrupt
-			bis.b 	#0x02, 	&P1IES 			; Set interrupt P1.1 to call from hi to low
-			bic.b 	#0x02, 	&P1IFG 			; Clear interrupt P1.1 flag
 
-			; Switch #1
-			bis.b 	#0x02, 	&P2IE 			; enable port P2.1 interrupt
-			bis.b 	#0x02, 	&P2IES 			; Set interrupt P2.1 to call from hi to low
-			bic.b 	#0x02, 	&P2IFG 			; Clear interrupt P2.1 flag
+;; Event Loop
+eventLoop:
+			dint							; test and sleep without a gap for a post
+			nop								; required
+			mov.b	&swPressed,	R12
+			bis.b	&swReleased, R12
+			tst.b	R12						; (BIS leaves the flags alone)
+			jnz		takeEvents				; posted while handling the last ones
+			bis.w	#LPM3_bits|GIE, SR			; sleep until the tick posts an event
+			nop								; required
+			jmp		eventLoop
 
+takeEvents:
+			mov.b	&swPressed,	R12			; take the events (interrupts still off)
+			mov.b	&swReleased, R13
+			clr.b	&swPressed
+			clr.b	&swReleased
+			nop								; required
+			eint
+			nop								; required
 
-endingLoop:
-			jmp		$
-			nop								; for debugger
+			; SW1 acts as a button: LED1 toggles on press and on release
+			bit.b	#SW1,	R12
+			jz		SW1Released
+			xor.b	#0x01,	&P1OUT			; toggle LED1
+SW1Released:
+			bit.b	#SW1,	R13
+			jz		SW2Pressed
+			xor.b	#0x01,	&P1OUT			; toggle LED1
+
+			; SW2 acts as a lever: LED2 toggles on press
+SW2Pressed:
+			bit.b	#SW2,	R12
+			jz		eventLoop
+			xor.b	#0x80,	&P4OUT			; toggle LED2
+			jmp		eventLoop
 
 ;-------------------------------------------------------------------------------
 ; Interrupts
 ;-------------------------------------------------------------------------------
-SW1_ISR:
-			bic.b 	#0x02, 	&P2IFG 			; Clear interrupt P2.1 flag within iterrupt
-
-
-; 1st Check for Rising/Falling Edge Status
-;	- needed bc switch #1 acts as a button (pulse signal) vs a lever (continuous signal)
-;	- different outputs for falling edge and rising edge of button press
-
-			; if (P2IES == 0)       		; check if switch press on rising or falling edge
-			bit.b	#0x02,	&P2IES			; 0 = rising, 1 = falling
-			jz		SW1CheckRising1			; if on rising edge
-
-			; if on falling edge
-			bit.b	#0x02,	&P2IN			; check for switch #1 press
-			jnz		endSW1					; return to main if NOT pressed
-			jmp		debounceSW1
-
-SW1CheckRising1:
-			; if on rising edge
-			bit.b	#0x02,	&P2IN			; check for switch #1 release
-			jz		endSW1					; return to main if pressed
-
-
-; Debouncing Initialization and Delay Loop
-debounceSW1:
-			mov.w	#5000,	R4				; debounce decrementor (iter)
-											; 5000 decrementor * 4cc total delay = 20000 -> ~20ms
-SW1dLoop:
-			nop								; nop (1cc delay)
-			dec.w	R4						; iter-- (1cc delay)
-			jnz		SW1dLoop				; continue loop until 20ms have passed (2cc delay)
-											; ----------------------------
-											; = total delay per loop iteration = 4cc
-
-
-; 2nd Check for Rising/Falling Edge Status
-			; if (P2IES == 0)       		; check if switch press on rising or falling edge
-			bit.b	#0x02,	&P2IES
-			jz		SW1checkRising2			; if on rising edge
-
-			; if on falling edge
-			bit.b	#0x02,	&P2IN			; check for switch #1 press
-			jnz		endSW1					; return to main if NOT pressed
-			jmp		toggleSW1				; jump to switch output
-
-SW1checkRising2:
-			; if on rising edge
-			bit.b	#0x02,	&P2IN			; check for switch #1 release
-			jz		endSW1					; return to main if pressed
-
-
-; Actual Switch #1 Output
-toggleSW1:
-			xor.b	#0x01, 	&P1OUT			; toggle LED1
-			xor.b	#0x02,	&P2IES			; toggle edge selection
-
-
-; Exit SW2 Interrupt - Return to Main
-endSW1:
-			reti							; return to main
-
-;-------------------------------------------------------------------------------
-SW2_ISR:
-			bic.b 	#0x02, 	&P1IFG 			; Clear interrupt P1.1 flag within iterrupt
-
-
-; 1st Check for Button Press
-;	- needed bc switch #2 acts as a lever (continuous singal) vs a button (pulse signal)
-
-			; if (P1IN & 0x02 == 0)       	; check if switch is pressed
-			bit.b	#0x02,	&P1IN
-			jnz		endSW2					; if released, return to main
-
-
-; Debouncing Initialization and Delay Loop
-debounceSW2:
-			mov.w	#5000,	R5				; debounce decrementor (iter)
-											; 5000 decrementor * 4cc total delay = 20000 -> ~20ms
-SW2dLoop:
-			nop								; nop (1cc delay)
-			dec.w	R5						; iter-- (1cc delay)
-			jnz		SW2dLoop				; continue loop until 20ms have passed (2cc delay)
-											; ----------------------------
-											; = total delay per loop iteration = 4cc
-
-
-; 2nd Check for Rising/Falling Edge Status
-			; if (P1IN & 0x02 == 0)       	; check if switch is pressed
-			bit.b	#0x02,	&P1IN
-			jnz		endSW2					; if released, return to main
-
-
-; Actual Switch #2 Output
-			xor.b	#0x80, 	&P4OUT			; toggle LED2
-
-
-; Exit SW2 Interrupt - Return to Main
-endSW2:
-			reti							; return to main
+TICK_ISR:
+			push.w	R12
+			push.w	R13
+			push.w	R14
+			push.w	R15						; saved SR now at 8(SP)
+
+			; Sample: bit per switch set while pressed (inputs are active low)
+			clr.b	R15
+			bit.b	#0x02,	&P2IN			; switch #1 (P2.1)
+			jnz		tickSample2
+			bis.b	#SW1,	R15
+tickSample2:
+			bit.b	#0x02,	&P1IN			; switch #2 (P1.1)
+			jnz		tickFilter
+			bis.b	#SW2,	R15
+
+
+; Shift-register Filter: one history byte and state bit per switch
+tickFilter:
+			mov.w	#swHist, R12			; history of SW1, then SW2
+			mov.b	#SW1,	R13				; its state bit
+tickSwitch:
+			clrc
+			rrc.b	R15						; this switch's sample into C
+			rlc.b	0(R12)					; history = history << 1 | sample
+			mov.b	@R12+,	R14
+			and.b	#DEBOUNCE_MASK,	R14		; the last samples
+			cmp.b	#DEBOUNCE_MASK,	R14
+			jne		tickNotPressed
+
+			bit.b	R13,	&swState		; all pressed
+			jnz		tickNext				; already down
+			bis.b	R13,	&swState
+			bis.b	R13,	&swPressed		; post press
+			jmp		tickWake
+
+tickNotPressed:
+			tst.b	R14
+			jnz		tickNext				; still bouncing
+			bit.b	R13,	&swState		; all released
+			jz		tickNext				; already up
+			bic.b	R13,	&swState
+			bis.b	R13,	&swReleased		; post release
+
+tickWake:
+			bic.w	#LPM3_bits, 8(SP)			; main takes the event on RETI
+
+tickNext:
+			rla.b	R13						; next switch
+			cmp.b	#0x04,	R13				; past SW2
+			jne		tickSwitch
+
+			pop.w	R15
+			pop.w	R14
+			pop.w	R13
+			pop.w	R12
+			reti							; CCR0 flag clears on entry
 
 ;-------------------------------------------------------------------------------
 ; Stack Pointer definition
@@ -189,10 +192,8 @@ endSW2:
 ;-------------------------------------------------------------------------------
             .sect   ".reset"                ; MSP430 RESET Vector
             .short  RESET
-            .sect	".int42"				; P2.X Vector
-            .short	SW1_ISR
-            .sect	".int47"				; P1.X Vector
-            .short	SW2_ISR
+            .sect	".int53"				; TIMER0_A0 Vector
+            .short	TICK_ISR
             .end
 
 
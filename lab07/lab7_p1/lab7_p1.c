@@ -8,6 +8,21 @@
  * Output:
  * Author(s):   Polickoski, Nick
  * Date:        September 30, 2023
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. Debounce service: the Timer_A CCR0 tick (~3.4ms) samples both
+ *                  switches into integrator filters and posts press, release and
+ *                  long-press events; no interrupt waits out a bounce any more
+ *              2. The switch port interrupts and the 1s watchdog interval are
+ *                  gone: main() sleeps in LPM3 and handles the posted events
+ *              3. Both switches held ~2s (a long press of the two together)
+ *                  toggles the LED1 off-time, as the watchdog check did
+ *              4. A switch counts as pressed alone by the switches held when the
+ *                  tick detected the press (buttonPressedState), not when main
+ *                  gets to it
  *----------------------------------------------------------------------------*/
 
 //// Preprocessor Directives
@@ -19,18 +34,48 @@
 #define SW1 (P2IN & BIT1)
 #define SW2 (P1IN & BIT1)
 
+#define BUTTON1             0x01        // debounce service bits: S1 (P2.1)
+#define BUTTON2             0x02        //                        S2 (P1.1)
+#define BUTTON_COUNT        2
+#define DEBOUNCE_SAMPLES    6           // integrator range: 6 ticks * 3.4ms = ~20ms to change
+#define LONG_PRESS_TICKS    590         // ~2s of ticks with the same buttons held
+
+
+
+//// Global Variables
+static unsigned char buttonLevel[BUTTON_COUNT];     // integrators: 0 released .. DEBOUNCE_SAMPLES pressed
+static unsigned int buttonHeld;                     // ticks since buttonState changed
+static volatile unsigned char buttonState;          // debounced, bit set while held
+static volatile unsigned char buttonPressed;        // posted events, a bit per button,
+static volatile unsigned char buttonReleased;       // taken by ButtonTake()
+static volatile unsigned char buttonLong;
+static volatile unsigned char buttonPressedState;   // buttonState at the last press, taken with buttonPressed
+
+
+
+//// Function Prototypes
+unsigned char ReadButtons(void);
+/* raw sample: BUTTONx bits of the switches down now
+ */
+int ButtonTick(void);
+/* one debounce step of every button, run from the timer tick: moves each
+ * integrator one count toward the raw level, posts a press (with buttonState in
+ * buttonPressedState) or release when it reaches an end, and a long press of
+ * buttonState when the same buttons stay held LONG_PRESS_TICKS. Never waits;
+ * returns 1 when it posted an event
+ */
+unsigned char ButtonTake(volatile unsigned char*);
+/* the buttons posted in an event set (buttonPressed, buttonReleased or
+ * buttonLong), which is cleared
+ */
+
 
 
 //// Call to Main
 void main(void)
 {
     // Stop Watchdog Timer
-    WDTCTL = WDT_ADLY_1000;         // set watchdog timer to go off every 1s
-    //WDTCTL = WDTPW + WDTHOLD;
-
-    // Enable Interrupts
-    _EINT();                        // enable global interrupts
-    SFRIE1 |= WDTIE;                // enable watchdog timer interrupts
+    WDTCTL = WDTPW + WDTHOLD;
 
 
     //// Switch Interfacing
@@ -39,19 +84,11 @@ void main(void)
     P2REN |=  BIT1;                 // enable P2.1 resistor
     P2OUT |=  BIT1;                 // setup proper I/O
 
-    P2IE  |=  BIT1;                 // enable port P2.1 interrupt
-    P2IES |=  BIT1;                 // set interrupt P2.1 to call from high to low
-    P2IFG &= ~BIT1;                 // clear interrupt P2.1 flag
-
     // Switch #2
     P1DIR &= ~BIT1;                 // set P1.1 as input (switch #2)
     P1REN |=  BIT1;                 // enable P1.1 resistor
     P1OUT |=  BIT1;                 // setup proper I/O
 
-    P1IE  |=  BIT1;                 // enable port P1.1 interrupt
-    P1IES |=  BIT1;                 // set interrupt P1.1 to call from high to low
-    P1IFG &= ~BIT1;                 // clear interrupt P1.1 flag
-
 
     // LED1 Interfacing
     P1DIR |= BIT0;                  // set P1.0 as output
@@ -60,7 +97,7 @@ void main(void)
 
     // Timer A shit
     TA0CTL |= TASSEL_1 | MC_1;      // ACLK is clock source; UP mode
-    TA0CCTL0 |= CCIE;               // CCR0 triggers interrupt
+    TA0CCTL0 |= CCIE;               // CCR0 triggers interrupt (and the debounce tick)
     TA0CCTL1 |= CCIE;               // CCR1 triggers interrupt
 
     TA0CCR0 = 110;                  // Set TA0 (and maximum) count value
@@ -70,99 +107,135 @@ void main(void)
     TA0CCTL1 &= ~CCIFG;             // clear CCR1 interrupt flag
 
 
-    // Microcontroller Enters Sleep Mode
-    _BIS_SR(LPM3 + GIE);            // Enter Low Power Mode 3
-
-    return;
-}
-
-
-
-//// Interrupts Definitions
-// Switch #1 (P2.1)
-#pragma vector = PORT2_VECTOR
-__interrupt void switch1ISR(void)
-{
-    P2IFG &= ~BIT1;                     // clear interrupt P2.1 flag
-
-    if (!SW1 && SW2)
+    while (1)
     {
-        unsigned int i;
-        for (i = 2000; i > 0; i--);     // ~20ms debounce
+        // Microcontroller Enters Sleep Mode until the tick posts an event
+        __disable_interrupt();
+        if (!(buttonPressed | buttonReleased | buttonLong))
+        {
+            __bis_SR_register(LPM3_bits + GIE);     // Enter Low Power Mode 3
+        }
+        __enable_interrupt();
+
+        __disable_interrupt();                      // a press and its snapshot are taken together
+        const unsigned char chord = buttonPressedState;
+        const unsigned char pressed = ButtonTake(&buttonPressed);   // enables interrupts again
+        const unsigned char held = ButtonTake(&buttonLong);
+        ButtonTake(&buttonReleased);                // nothing happens on release
 
-        if (!SW1 && SW2)                // 2nd check for switch #1 press
+        if ((pressed & BUTTON1) && !(chord & BUTTON2))          // switch #1 alone
         {
             if (TA0CCR1 < 100)          // if upper bound is met
             {
-                TA0CCR1 += 10;          // increase brightness322q
+                TA0CCR1 += 10;          // increase brightness
+            }
+        }
+        if ((pressed & BUTTON2) && !(chord & BUTTON1))          // switch #2 alone
+        {
+            if (TA0CCR1 > 10)           // if lower bound is met
+            {
+                TA0CCR1 -= 10;          // decrease brightness
             }
         }
+        if (held == (BUTTON1 | BUTTON2))                        // both held ~2s
+        {
+            TA0CCTL1 ^= CCIE;           // Toggle interrupt enable for LED1 on interrupt
+        }
     }
-
-    return;
 }
 
 
-// Switch #2 (P1.1)
-#pragma vector = PORT1_VECTOR
-__interrupt void switch2ISR(void)
+
+//// Function Definitions
+unsigned char ReadButtons(void)
 {
-    P1IFG &= ~BIT1;                         // clear interrupt P2.1 flag
+    unsigned char raw = 0;
 
-    if (SW1 && !SW2)
+    if (!SW1)
     {
-        unsigned int i;
-        for (i = 2000; i > 0; i--);     // ~20ms debounce
-
-        if (SW1 && !SW2)                // 2nd check for switch #1 press
-        {
-            if (TA0CCR1 > 10)           // if lower bound is met
-            {
-                TA0CCR1 -= 10;          // decrease brightness
-            }
-        }
+        raw |= BUTTON1;
+    }
+    if (!SW2)
+    {
+        raw |= BUTTON2;
     }
 
-    return;
+    return raw;
 }
 
 
-// Watch Dog Timer
-#pragma vector = WDT_VECTOR
-__interrupt void BtimerISR(void)
+int ButtonTick(void)
 {
-    SFRIFG1 &= ~WDTIFG;                     // Clear the flag
-
-    static int i = 0;                       // Initialize counter for determining wait time
+    const unsigned char raw = ReadButtons();
+    unsigned char state = buttonState;
+    unsigned char pressed = 0;
+    unsigned char b, bit;
+    int posted = 0;
 
-    if (i == 2)                             // i is two -> 2 (s) wait reached | 0 (wait) 1 (wait) 2
+    for (b = 0, bit = 0x01; b < BUTTON_COUNT; b++, bit <<= 1)
     {
-        i = 0;                              // Reset counter
-
-        if (!SW1 && !SW2)                   // Check if both switches pressed
+        if (raw & bit)
         {
-            unsigned int i;
-            for (i = 2000; i > 0; i--);     // ~20ms debounce
-
-            if (!SW1 && !SW2)               // Check if both still pressed
+            if (buttonLevel[b] < DEBOUNCE_SAMPLES && ++buttonLevel[b] == DEBOUNCE_SAMPLES && !(state & bit))
             {
-                TA0CCTL1 ^= CCIE;           // Toggle interrupt enable for LED1 on interrupt
+                state |= bit;               // press
+                pressed |= bit;
             }
         }
+        else if (buttonLevel[b] > 0 && --buttonLevel[b] == 0 && (state & bit))
+        {
+            state &= ~bit;                  // release
+            buttonReleased |= bit;
+            posted = 1;
+        }
     }
 
-    i++;
+    if (pressed)
+    {
+        buttonPressedState = state;         // with every press of this tick
+        buttonPressed |= pressed;
+        posted = 1;
+    }
 
-    return;
+    if (state != buttonState)
+    {
+        buttonState = state;
+        buttonHeld = 0;
+    }
+    else if (state && buttonHeld < LONG_PRESS_TICKS && ++buttonHeld == LONG_PRESS_TICKS)
+    {
+        buttonLong |= state;                // long press, once per hold
+        posted = 1;
+    }
+
+    return posted;
 }
 
 
+unsigned char ButtonTake(volatile unsigned char* events)
+{
+    __disable_interrupt();
+    const unsigned char taken = *events;
+    *events = 0;
+    __enable_interrupt();
+
+    return taken;
+}
+
+
+
+//// Interrupts Definitions
 // Timer A0
 #pragma vector = TIMER0_A0_VECTOR
 __interrupt void Timer_A0()
 {
     TA0CCTL0 &= ~CCIFG;                 // Clear the flag
     P1OUT |= BIT0;                      // turn on LED1
+
+    if (ButtonTick())                   // debounce tick
+    {
+        __bic_SR_register_on_exit(LPM3_bits);   // wake main for the event
+    }
     return;
 }
 
@@ -175,8 +248,3 @@ __interrupt void Timer_A1()
     P1OUT &= ~BIT0;                     // turn off LED1
     return;
 }
-
-
-
-
-
@@ -11,6 +11,19 @@
  * Date:        October 12, 2023
  *
  * lacasauah.edu <- Dr. Mel website
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. Commands reach main through a single-producer/single-consumer
+ *                  queue of command bytes (lab10_p1's event queue, without the
+ *                  record types) instead of the DutyValue global: a command sent
+ *                  while main was still busy with the last one used to be
+ *                  overwritten, now it waits its turn (or is counted as dropped)
+ *              2. No interrupt masking on the queue's fast path: the USI ISR
+ *                  only writes eventHead, main only writes eventTail, and each
+ *                  is a single 16-bit store
  *----------------------------------------------------------------------------*/
 
 //// Preprocessor Directives
@@ -26,9 +39,20 @@
 #define SET_LED() P1OUT |= 0x01
 #define RESET_LED() P1OUT &= ~0x01
 
+#define EVENT_QUEUE_SIZE 8                          // command bytes, a power of two
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE - 1)
+
+
+
+// Global Variables
 unsigned char blinkNumber = 0;                      // total number of blinks (caps at 127)
 unsigned char DutyValue;                            // change in duty cycle value that gets set over
 
+static volatile unsigned char eventQueue[EVENT_QUEUE_SIZE];  // ring of commands from the USI ISR to main
+volatile unsigned int eventHead;                    // commands posted: written by the ISR only
+volatile unsigned int eventTail;                    // commands taken: written by main only
+volatile unsigned int eventDrops;                   // commands posted to a full queue
+
 
 
 
@@ -38,6 +62,8 @@ void SPI_initComm();
 void initLED();
 void initSystem();
 void initTimerA();
+int EventPost(unsigned char command);               // lab10_p1's EventPost/EventTake, for command bytes
+int EventTake(unsigned char* command);
 
 
 
@@ -55,7 +81,21 @@ void main(void)
     // Conditions Check
     for (;;)
     {
-        _BIS_SR(LPM0_bits + GIE);                  // Enter LPM0 with interrupt
+        unsigned char command;
+
+        _DINT();
+        if (eventHead == eventTail)                 // nothing queued: a post now would be missed
+        {
+            RESET_BUSY_FLAG();                      // Clears busy flag - ready for new communication
+            _BIS_SR(LPM0_bits + GIE);              // Enter LPM0 with interrupt
+        }
+        _EINT();
+
+        if (!EventTake(&command))
+        {
+            continue;
+        }
+        DutyValue = command;
 
         switch (DutyValue)
         {
@@ -88,8 +128,6 @@ void main(void)
         }
 
         USISRL = blinkNumber;                       // proper updating so no value is skipped
-
-        RESET_BUSY_FLAG();                          // Clears busy flag - ready for new communication
     }
 
     return;
@@ -104,7 +142,7 @@ __interrupt void USI_ISR(void)
 {
     SET_BUSY_FLAG();                                // Set busy flag - busy with new communication
 
-    DutyValue = USISRL;                             // Read new command
+    EventPost(USISRL);                              // Queue new command
     USICNT = 8;                                     // Load bit counter for next TX
 
     _BIC_SR_IRQ(LPM0_bits);                         // Exit from LPM0 on RETI
@@ -144,6 +182,39 @@ __interrupt void Timer_A1()
 
 
 // Function Definitions
+int EventPost(unsigned char command)
+{
+    const unsigned int head = eventHead;
+
+    if ((unsigned int)(head - eventTail) >= EVENT_QUEUE_SIZE)
+    {
+        eventDrops++;
+        return 1;
+    }
+
+    eventQueue[head & EVENT_QUEUE_MASK] = command;
+    eventHead = head + 1;                           // one store publishes the command
+
+    return 0;
+}
+
+
+int EventTake(unsigned char* command)
+{
+    const unsigned int tail = eventTail;
+
+    if (tail == eventHead)
+    {
+        return 0;
+    }
+
+    *command = eventQueue[tail & EVENT_QUEUE_MASK]; // copied before the slot is handed back
+    eventTail = tail + 1;
+
+    return 1;
+}
+
+
 void SPI_setup()
 {
     USICTL0 |= USISWRST;                            // Set UCSWRST -- needed for re-configuration process
@@ -9,6 +9,25 @@
  * Output:      2D Graph/blinking LED
  * Author(s):   Polickoski, Nick
  * Date:        October 22, 2023
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. Debounce service: the watchdog interval (~15.6ms) samples switch
+ *                  #2 into an integrator filter (lab7_p1's, for the one switch)
+ *                  and posts its long press instead of waiting out bounces in
+ *                  the ISR
+ *              2. Holding switch #2 ~2s (a long press) after a crash turns the
+ *                  warning LED off, handled in main() between conversions
+ *              3. The ISRs hand main typed records through a single-producer/
+ *                  single-consumer event queue: samples (EVENT_SAMPLE) replace
+ *                  the ADCXval/ADCYval/ADCZval globals shared with the ADC ISR,
+ *                  and the debounce events are queued too. The Timer A tick
+ *                  starts the conversions and main sends each sample as it
+ *                  arrives instead of sending 13 UART bytes inside the ISR, so
+ *                  the crash check always sees the sample of that tick. Only the ISRs write eventHead and only main writes
+ *                  eventTail, so neither side masks interrupts to post or take
  *----------------------------------------------------------------------------*/
 
 // Preprocessor Directives
@@ -17,6 +36,27 @@
 #include <string.h>
 #include <math.h>
 
+// Macros
+#define BUTTON2             0x01                        // debounce service bit: switch #2 (P1.1)
+#define DEBOUNCE_SAMPLES    2                           // integrator range: 2 ticks = ~31ms to change
+#define LONG_PRESS_TICKS    128                         // ~2s of ticks with the switch held
+
+#define EVENT_QUEUE_SIZE    8                           // records, a power of two
+#define EVENT_QUEUE_MASK    (EVENT_QUEUE_SIZE - 1)
+
+#define EVENT_SAMPLE        1                           // ADC12 sequence done: value[] = X, Y, Z, to send
+#define EVENT_LONG          2                           // code buttons held LONG_PRESS_TICKS
+
+
+
+// Type Definitions
+typedef struct
+{
+    unsigned char type;                                 // EVENT_x
+    unsigned char code;                                 // BUTTONx bits for the button events
+    unsigned int value[3];                              // ADC12 codes for EVENT_SAMPLE
+} Event;
+
 
 
 // Function Prototypes
@@ -31,15 +71,37 @@ void TimerB_setup(void);
 void UART_putCharacter(char c);
 void sendData(void);
 
+int ButtonTick(void);                                   // one debounce step (lab7_p1's ButtonTick), posts the
+                                                        // long press only; 1 when it posted
+
+int EventPost(unsigned char type, unsigned char code, unsigned int x, unsigned int y, unsigned int z);
+/* queues a record from interrupt context, returns 1 (and counts a drop) when
+ * the queue is full. Single producer, single consumer: only the ISRs write
+ * eventHead and only main writes eventTail, each with one 16-bit store, so
+ * neither side masks interrupts (lab9_2013 and lab10_p3 carry reduced copies)
+ */
+int EventTake(Event* e);
+/* the oldest record into e for main, returns 0 when the queue is empty
+ */
+
 
 
 // Global Variables
-volatile long int ADCXval = 0, ADCYval = 0, ADCZval = 0;// position values
+long int ADCXval = 0, ADCYval = 0, ADCZval = 0;         // position values, last EVENT_SAMPLE
 volatile float aX = 0, aY = 0, aZ = 0;                  // acceleration values
 
 volatile unsigned char crashFlag = 0;                   // for crashes
 volatile double magnitude = 0;                          // for part #2
 
+static unsigned char buttonLevel;                       // integrator: 0 released .. DEBOUNCE_SAMPLES pressed
+static unsigned char buttonDown;                        // debounced state
+static unsigned int buttonHeld;                         // ticks since buttonDown changed
+
+static volatile Event eventQueue[EVENT_QUEUE_SIZE];     // ring of records from the ISRs to main
+volatile unsigned int eventHead;                        // records posted: written by the ISRs only
+volatile unsigned int eventTail;                        // records taken: written by main only
+volatile unsigned int eventDrops;                       // records posted to a full queue
+
 
 
 // Call to Main
@@ -59,8 +121,41 @@ void main(void)
 
     while (1)
     {
-        ADC12CTL0 |= ADC12SC;                           // Start conversions
-        __bis_SR_register(LPM0_bits + GIE);             // Enter LPM0
+        Event e;
+
+        __disable_interrupt();
+        if (eventHead == eventTail)                     // nothing queued: a post now would be missed
+        {
+            __bis_SR_register(LPM0_bits + GIE);         // Enter LPM0
+        }
+        __enable_interrupt();
+
+        while (EventTake(&e))
+        {
+            switch (e.type)
+            {
+                case EVENT_SAMPLE:
+                    ADCXval = e.value[0];
+                    ADCYval = e.value[1];
+                    ADCZval = e.value[2];
+                    sendData();                         // Send data to serial app
+                    break;
+
+                case EVENT_LONG:                        // Switch #2 held ~2s after a crash
+                    if ((e.code & BUTTON2) && crashFlag)
+                    {
+                        TB0CCTL0 &= ~CCIE;              // clear Timer B interrupt flag
+
+                        P2OUT &= ~BIT1;                 // turn off LED
+
+                        crashFlag = 0;                  // reset crash flag for next detection
+                    }
+                    break;
+
+                default:
+                    break;
+            }
+        }
     }
 
 	return;
@@ -73,9 +168,8 @@ void main(void)
 #pragma vector = ADC12_VECTOR
 __interrupt void ADC12_ISR(void)
 {
-    ADCXval = ADC12MEM0;                                // Move results, IFG is cleared
-    ADCYval = ADC12MEM1;                                //
-    ADCZval = ADC12MEM2;                                //
+    EventPost(EVENT_SAMPLE, 0,                          // Move results, IFG is cleared
+              ADC12MEM0, ADC12MEM1, ADC12MEM2);
 
     __bic_SR_register_on_exit(LPM0_bits);               // Exit LPM0
 
@@ -87,8 +181,7 @@ __interrupt void ADC12_ISR(void)
 #pragma vector = TIMERA0_VECTOR
 __interrupt void TA0_ISR()
 {
-    sendData();                                         // Send data to serial app
-    __bic_SR_register_on_exit(LPM0_bits);               // Exit LPM0
+    ADC12CTL0 |= ADC12SC;                               // Start conversions: main sends the sample
 
     return;
 }
@@ -111,53 +204,10 @@ __interrupt void TB0_ISR()
 __interrupt void WDT_ISR()
 {
     IFG1 &= ~WDTIFG;
-    static unsigned char count = 0;
-
-
-    // If crash flag hasn't been activated -> do nothing
-    if (!crashFlag)
-    {
-        return;
-    }
-
-
-    // If 3 secs pass
-    if (count == 2)
-    {
-        TB0CCTL0 &= ~CCIE;                          // clear Timer B interrupt flag
-
-        P2OUT &= ~BIT1;                             // turn off LED
-
-        count = 0;                                  // reset counter and crash flag for next detection
-        crashFlag = 0;
-
-        return;
-    }
-
-
-    // If Switch #2 = pressed
-    if (!(P1IN & BIT1))
-    {
-        unsigned int i;
-        for (i = 2000; i > 0; i--);                 // ~20ms debounce
-
-        if (!(P1IN & BIT1))                         // 2nd switch #2 check
-        {
-            count++;
-        }
-    }
 
-
-    // If Switch #2 = not pressed
-    if (P1IN & BIT1)
+    if (ButtonTick())                                   // debounce tick: main takes the events
     {
-        unsigned int i;
-        for (i = 2000; i > 0; i--);                 // ~20ms debounce
-
-        if (P1IN & BIT1)                            // 2nd switch #2 check
-        {
-            count = 0;
-        }
+        __bic_SR_register_on_exit(LPM0_bits);           // Exit LPM0
     }
 
     return;
@@ -217,7 +267,7 @@ void ADC_setup(void)
 
 void WatchdogTimer_setup()
 {
-    WDTCTL = WDTPW | WDT_ADLY_1000;                     // set WDT to go off every 1 sec
+    WDTCTL = WDTPW | WDT_ADLY_16;                       // set WDT to go off every ~15.6ms (debounce tick)
 
     IE1 |= WDTIE;                                       // enable WDT interrupts
     IFG1 &= ~WDTIFG;                                    // clear interrupt flag
@@ -305,3 +355,78 @@ void sendData(void)
     return;
 }
 
+
+int ButtonTick(void)
+{
+    unsigned char down = buttonDown;
+
+    if (!(P1IN & BIT1))
+    {
+        if (buttonLevel < DEBOUNCE_SAMPLES && ++buttonLevel == DEBOUNCE_SAMPLES)
+        {
+            down = 1;                                   // press
+        }
+    }
+    else if (buttonLevel > 0 && --buttonLevel == 0)
+    {
+        down = 0;                                       // release
+    }
+
+    if (down != buttonDown)
+    {
+        buttonDown = down;
+        buttonHeld = 0;
+    }
+    else if (down && buttonHeld < LONG_PRESS_TICKS && ++buttonHeld == LONG_PRESS_TICKS)
+    {
+        EventPost(EVENT_LONG, BUTTON2, 0, 0, 0);        // long press, once per hold
+        return 1;
+    }
+
+    return 0;
+}
+
+
+int EventPost(unsigned char type, unsigned char code, unsigned int x, unsigned int y, unsigned int z)
+{
+    const unsigned int head = eventHead;
+    volatile Event* e;
+
+    if ((unsigned int)(head - eventTail) >= EVENT_QUEUE_SIZE)
+    {
+        eventDrops++;
+        return 1;
+    }
+
+    e = &eventQueue[head & EVENT_QUEUE_MASK];
+    e->type = type;
+    e->code = code;
+    e->value[0] = x;
+    e->value[1] = y;
+    e->value[2] = z;
+    eventHead = head + 1;                               // one store publishes the record
+
+    return 0;
+}
+
+
+int EventTake(Event* e)
+{
+    const unsigned int tail = eventTail;
+    const volatile Event* slot;
+
+    if (tail == eventHead)
+    {
+        return 0;
+    }
+
+    slot = &eventQueue[tail & EVENT_QUEUE_MASK];
+    e->type = slot->type;                               // copied before the slot is handed back
+    e->code = slot->code;
+    e->value[0] = slot->value[0];
+    e->value[1] = slot->value[1];
+    e->value[2] = slot->value[2];
+    eventTail = tail + 1;
+
+    return 1;
+}
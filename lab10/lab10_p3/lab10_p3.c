@@ -7,6 +7,22 @@
  * Output:      Change to wave (triangle, sine, double amplitude)
  * Author(s):   Polickoski, Nick
  * Date:        October 22, 2023
+ *
+ *
+ * Revisions::
+ * Author:      Polickoski, Nick
+ * Date:        October 17, 2026
+ * Changes:     1. Debounce service: every 128th sample tick (~5.1ms) samples both
+ *                  switches into integrator filters (lab7_p1's, without the long
+ *                  press) and posts press and release events; the port interrupt
+ *                  and its ~20ms waits are gone, so no samples are lost to a
+ *                  switch bounce
+ *              2. FirstSwtich()/SecondSwtich() handle the posted events in main(),
+ *                  with the switch states as they were when the event was posted
+ *              3. The debounce events reach main through lab10_p1's single-
+ *                  producer/single-consumer event queue, so wavePtr and
+ *                  amplitudeConst are only ever written by main and taking an
+ *                  event no longer masks interrupts (one 16-bit store each side)
  *----------------------------------------------------------------------------*/
 
 // Preprocessor Directives
@@ -14,6 +30,29 @@
 #include "TriangleWaveLUT_512.h"                    // triangle-wave input file
 #include "SineWaveLUT_512.h"                        // sine-wave input file
 
+// Macros
+#define BUTTON1             0x01                    // debounce service bits: switch #1 (P1.0)
+#define BUTTON2             0x02                    //                        switch #2 (P1.1)
+#define BUTTON_COUNT        2
+#define DEBOUNCE_DIVIDE     128                     // samples per debounce tick: ~5.1ms
+#define DEBOUNCE_SAMPLES    4                       // integrator range: 4 ticks = ~20ms to change
+
+#define EVENT_QUEUE_SIZE    8                       // records, a power of two
+#define EVENT_QUEUE_MASK    (EVENT_QUEUE_SIZE - 1)
+
+#define EVENT_PRESS         1                       // debounced press of the code buttons
+#define EVENT_RELEASE       2                       // debounced release
+
+
+
+// Type Definitions
+typedef struct
+{
+    unsigned char type;                             // EVENT_x
+    unsigned char code;                             // BUTTONx bits
+    unsigned char state;                            // BUTTONx bits held, this event included
+} Event;
+
 
 
 // Function Prototypes
@@ -21,8 +60,14 @@ void TimerA_setup(void);
 void DAC_setup(void);
 void Switch_setup(void);
 
-void FirstSwtich(void);
-void SecondSwtich(void);
+void FirstSwtich(const Event*);                     // switch #1 events: sine/triangle wave
+void SecondSwtich(const Event*);                    // switch #2 events: double/normal amplitude
+
+unsigned char ReadButtons(void);                    // raw sample: BUTTONx bits of the switches down now
+void ButtonTick(void);                              // one debounce step (lab7_p1's ButtonTick), posts events
+
+int EventPost(unsigned char type, unsigned char code, unsigned char state);     // lab10_p1's EventPost/EventTake, for button records
+int EventTake(Event* e);
 
 
 
@@ -30,6 +75,14 @@ void SecondSwtich(void);
 unsigned int* wavePtr = TriangleWaveLUT;            // initalize pointer to triangle-wave values (will change)
 int amplitudeConst = 1;                             // for change in amplitude
 
+static unsigned char buttonLevel[BUTTON_COUNT];     // integrators: 0 released .. DEBOUNCE_SAMPLES pressed
+static unsigned char buttonState;                   // debounced, bit set while held (tick only)
+
+static volatile Event eventQueue[EVENT_QUEUE_SIZE]; // ring of records from the ISRs to main
+volatile unsigned int eventHead;                    // records posted: written by the ISRs only
+volatile unsigned int eventTail;                    // records taken: written by main only
+volatile unsigned int eventDrops;                   // records posted to a full queue
+
 
 
 // Call to Main
@@ -47,6 +100,13 @@ void main(void)
         __bis_SR_register(LPM0_bits + GIE);         // Enter LPM0, interrupts enabled
 
         DAC12_0DAT = amplitudeConst * (wavePtr[i] / 2);     // display triangle-wave
+
+        Event e;
+        while (EventTake(&e))                       // posted by the debounce tick
+        {
+            FirstSwtich(&e);
+            SecondSwtich(&e);
+        }
     }
 
     return;
@@ -59,71 +119,14 @@ void main(void)
 #pragma vector = TIMERA0_VECTOR
 __interrupt void TA0_ISR(void)
 {
-    __bic_SR_register_on_exit(LPM0_bits);           // Exit LPMx, interrupts enabled
-
-    return;
-}
-
-
-// Switches
-#pragma vector = PORT1_VECTOR
-__interrupt void Switches_ISR(void)
-{
-    // Switch #1
-    if (!(P1IN & BIT0))                             // if (switch #1 = ON) (falling edge)
-    {
-        P1IFG &= ~BIT0;                             // clear interrupt flag
-
-        unsigned int i;
-        for (i = 2000; i > 0; i--);                 // ~20ms debounce
+    static unsigned char tick = 0;
 
-        if (!(P1IN & BIT0) && (P1IN & BIT1))        // 2nd switch check - switch #1
-        {
-            wavePtr = SineWaveLUT;                  // change to sine-wave
-            P1IES &= ~BIT0;                         // change interrupt to go from low to high
-        }
-    }
-    else if (P1IN & BIT0)                           // if (switch #1 = OFF) (rising edge)
-    {
-        P1IFG &= ~BIT0;                             // clear interrupt flag
-
-        unsigned int i;
-        for (i = 2000; i > 0; i--);                 // ~20ms debounce
-
-        if ((P1IN & BIT0) && (P1IN & BIT1))         // 2nd switch check - switch #2
-        {
-            wavePtr = TriangleWaveLUT;              // reset pointer to triangle-wave values
-            P1IES |= BIT0;                          // change interrupt to go from high to low
-        }
-    }
-
-
-    // Switch #2
-    if (!(P1IN & BIT1))                             // if (switch #2 = ON)
-    {
-        P1IFG &= ~BIT1;                             // clear interrupt flag
-
-        unsigned int i;
-        for (i = 2000; i > 0; i--);                 // ~20ms debounce
+    __bic_SR_register_on_exit(LPM0_bits);           // Exit LPMx, interrupts enabled
 
-        if (!(P1IN & BIT1))                         // 2nd switch check - switch #2
-        {
-            amplitudeConst = 2;                     // double ampiltude
-            P1IES &= ~BIT1;                         // change interrupt to go from low to high
-        }
-    }
-    else if (P1IN & BIT1)                           // if (switch #2 = OFF)
+    if (++tick == DEBOUNCE_DIVIDE)                  // debounce tick (main wakes every sample anyway)
     {
-        P1IFG &= ~BIT1;                             // clear interrupt flag
-
-        unsigned int i;
-        for (i = 2000; i > 0; i--);                 // ~20ms debounce
-
-        if (P1IN & BIT1)                            // 2nd switch check - switch #2
-        {
-            amplitudeConst = 1;                     // reset amplitude
-            P1IES |= BIT1;                          // change interrupt to go from high to low
-        }
+        tick = 0;
+        ButtonTick();
     }
 
     return;
@@ -160,15 +163,134 @@ void Switch_setup(void)
     // Switch #1
     P1DIR &= ~BIT0;                                 // input selection
     P1OUT |= BIT0;                                  // formatting shit (proper I/O)
-    P1IE |= BIT0;                                   // enable interrupts
-    P1IES |= BIT0;                                  // initialize interrupt from high to low
 
     // Switch #2
     P1DIR &= ~BIT1;                                 // input selection
     P1OUT |= BIT1;                                  // formatting shit (proper I/O)
-    P1IE |= BIT1;                                   // enable interrupts
-    P1IES |= BIT1;                                  // initialize interrupt from high to low
+
+    return;                                         // sampled by the debounce tick, no port interrupts
+}
+
+
+void FirstSwtich(const Event* e)
+{
+    if (!(e->code & BUTTON1) || (e->state & BUTTON2))
+    {
+        return;                                     // only switch #1 with #2 up
+    }
+
+    if (e->type == EVENT_PRESS)                     // switch #1 down, #2 up
+    {
+        wavePtr = SineWaveLUT;                      // change to sine-wave
+    }
+    if (e->type == EVENT_RELEASE)                   // switch #1 up, #2 up
+    {
+        wavePtr = TriangleWaveLUT;                  // reset pointer to triangle-wave values
+    }
+
+    return;
+}
+
+
+void SecondSwtich(const Event* e)
+{
+    if (!(e->code & BUTTON2))
+    {
+        return;
+    }
+
+    if (e->type == EVENT_PRESS)
+    {
+        amplitudeConst = 2;                         // double ampiltude
+    }
+    if (e->type == EVENT_RELEASE)
+    {
+        amplitudeConst = 1;                         // reset amplitude
+    }
+
+    return;
+}
+
+
+unsigned char ReadButtons(void)
+{
+    unsigned char raw = 0;
+
+    if (!(P1IN & BIT0))
+    {
+        raw |= BUTTON1;
+    }
+    if (!(P1IN & BIT1))
+    {
+        raw |= BUTTON2;
+    }
+
+    return raw;
+}
+
+
+void ButtonTick(void)
+{
+    const unsigned char raw = ReadButtons();
+    unsigned char b, bit;
+
+    for (b = 0, bit = 0x01; b < BUTTON_COUNT; b++, bit <<= 1)
+    {
+        if (raw & bit)
+        {
+            if (buttonLevel[b] < DEBOUNCE_SAMPLES && ++buttonLevel[b] == DEBOUNCE_SAMPLES && !(buttonState & bit))
+            {
+                buttonState |= bit;         // press
+                EventPost(EVENT_PRESS, bit, buttonState);
+            }
+        }
+        else if (buttonLevel[b] > 0 && --buttonLevel[b] == 0 && (buttonState & bit))
+        {
+            buttonState &= ~bit;            // release
+            EventPost(EVENT_RELEASE, bit, buttonState);
+        }
+    }
 
     return;
 }
 
+
+int EventPost(unsigned char type, unsigned char code, unsigned char state)
+{
+    const unsigned int head = eventHead;
+    volatile Event* e;
+
+    if ((unsigned int)(head - eventTail) >= EVENT_QUEUE_SIZE)
+    {
+        eventDrops++;
+        return 1;
+    }
+
+    e = &eventQueue[head & EVENT_QUEUE_MASK];
+    e->type = type;
+    e->code = code;
+    e->state = state;
+    eventHead = head + 1;                           // one store publishes the record
+
+    return 0;
+}
+
+
+int EventTake(Event* e)
+{
+    const unsigned int tail = eventTail;
+    const volatile Event* slot;
+
+    if (tail == eventHead)
+    {
+        return 0;
+    }
+
+    slot = &eventQueue[tail & EVENT_QUEUE_MASK];
+    e->type = slot->type;                           // copied before the slot is handed back
+    e->code = slot->code;
+    e->state = slot->state;
+    eventTail = tail + 1;
+
+    return 1;
+}